@@ -46,6 +46,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <stddef.h>
+#include <new>
 #include "StdAllocator.hpp"
 
 /******************************************************************************
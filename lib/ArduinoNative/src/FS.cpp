@@ -34,6 +34,7 @@
  * Includes
  *****************************************************************************/
 #include "FS.h"
+#include <sys/stat.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -61,6 +62,23 @@ FS NativeFS;
  * Public Methods
  *****************************************************************************/
 
+size_t File::write(uint8_t data)
+{
+    return write(&data, 1U);
+}
+
+size_t File::write(const uint8_t* buf, size_t size)
+{
+    size_t written = 0U;
+
+    if (nullptr != m_fd)
+    {
+        written = fwrite(buf, 1, size, m_fd);
+    }
+
+    return written;
+}
+
 size_t File::size() const
 {
     size_t fileSize = 0U;
@@ -81,6 +99,19 @@ size_t File::size() const
     return fileSize;
 }
 
+time_t File::getLastWrite()
+{
+    time_t      timestamp = 0;
+    struct stat fileStat;
+
+    if ((nullptr != m_fd) && (0 == fstat(fileno(m_fd), &fileStat)))
+    {
+        timestamp = fileStat.st_mtime;
+    }
+
+    return timestamp;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -47,7 +47,10 @@
 #include <stdint.h>
 #include "BaseGfx.hpp"
 #include "BaseGfxBrush.hpp"
+#include "BaseGlyphCache.hpp"
 #include "gfxfont.h"
+#include "gfxfontaa.h"
+#include "gfxunicode.h"
 
 /******************************************************************************
  * Macros
@@ -59,6 +62,13 @@
 
 /**
  * A graphical font, providing simple single character drawing functionality.
+ * Supported are fonts in the 1 bit per pixel Adafruit GFXfont format and
+ * anti-aliased fonts in the GFXfontAA format.
+ *
+ * The characters are addressed by their Unicode code point. Without a
+ * unicode map, the code point is the character code of the font. With a
+ * unicode map, the glyph is located by a binary search over its sparse code
+ * point ranges.
  *
  * @tparam TColor Color type, which is used to draw the characters.
  */
@@ -72,7 +82,10 @@ public:
      * Note, until no GFXfont is assigned, it can not draw any character.
      */
     BaseFont() :
-        m_gfxFont(nullptr)
+        m_gfxFont(nullptr),
+        m_bitsPerPixel(1U),
+        m_glyphCache(nullptr),
+        m_unicodeMap(nullptr)
     {
     }
 
@@ -82,20 +95,44 @@ public:
      * @param[in] font  Font, which to copy.
      */
     BaseFont(const BaseFont& font) :
-        m_gfxFont(font.m_gfxFont)
+        m_gfxFont(font.m_gfxFont),
+        m_bitsPerPixel(font.m_bitsPerPixel),
+        m_glyphCache(font.m_glyphCache),
+        m_unicodeMap(font.m_unicodeMap)
     {
     }
 
     /**
      * Constructs a font with the given GFXfont.
      *
-     * @param[in] gfxFont   GFXfont
+     * @param[in] gfxFont       GFXfont
+     * @param[in] glyphCache    Glyph cache, which is optional.
+     * @param[in] unicodeMap    Unicode map, which is optional.
      */
-    BaseFont(const GFXfont* gfxFont) :
-        m_gfxFont(gfxFont)
+    BaseFont(const GFXfont* gfxFont, BaseGlyphCache* glyphCache = nullptr, const GFXunicodeMap* unicodeMap = nullptr) :
+        m_gfxFont(gfxFont),
+        m_bitsPerPixel(1U),
+        m_glyphCache(glyphCache),
+        m_unicodeMap(unicodeMap)
     {
     }
 
+    /**
+     * Constructs an anti-aliased font.
+     * The glyph cache is not used by anti-aliased fonts.
+     *
+     * @param[in] aaFont        Anti-aliased font
+     * @param[in] unicodeMap    Unicode map, which is optional.
+     */
+    BaseFont(const GFXfontAA* aaFont, const GFXunicodeMap* unicodeMap = nullptr) :
+        m_gfxFont(nullptr),
+        m_bitsPerPixel(1U),
+        m_glyphCache(nullptr),
+        m_unicodeMap(nullptr)
+    {
+        setGfxFont(aaFont, unicodeMap);
+    }
+
     /**
      * Destroys the font.
      */
@@ -114,7 +151,10 @@ public:
     {
         if (&font != this)
         {
-            m_gfxFont = font.m_gfxFont;
+            m_gfxFont      = font.m_gfxFont;
+            m_bitsPerPixel = font.m_bitsPerPixel;
+            m_glyphCache   = font.m_glyphCache;
+            m_unicodeMap   = font.m_unicodeMap;
         }
 
         return *this;
@@ -133,11 +173,77 @@ public:
     /**
      * Set GFXfont.
      *
-     * @param[in] gfxFont   GFXfont
+     * @param[in] gfxFont       GFXfont
+     * @param[in] unicodeMap    Unicode map, which is optional.
+     */
+    void setGfxFont(const GFXfont* gfxFont, const GFXunicodeMap* unicodeMap = nullptr)
+    {
+        m_gfxFont      = gfxFont;
+        m_bitsPerPixel = 1U;
+        m_unicodeMap   = unicodeMap;
+    }
+
+    /**
+     * Set anti-aliased font. If the number of bits per pixel is not
+     * supported, no font will be set.
+     *
+     * @param[in] aaFont        Anti-aliased font
+     * @param[in] unicodeMap    Unicode map, which is optional.
      */
-    void setGfxFont(const GFXfont* gfxFont)
+    void setGfxFont(const GFXfontAA* aaFont, const GFXunicodeMap* unicodeMap = nullptr)
     {
-        m_gfxFont = gfxFont;
+        m_gfxFont      = nullptr;
+        m_bitsPerPixel = 1U;
+        m_unicodeMap   = unicodeMap;
+
+        if ((nullptr != aaFont) &&
+            ((2U == aaFont->bitsPerPixel) ||
+             (4U == aaFont->bitsPerPixel) ||
+             (8U == aaFont->bitsPerPixel)))
+        {
+            m_gfxFont      = &aaFont->gfxFont;
+            m_bitsPerPixel = aaFont->bitsPerPixel;
+        }
+    }
+
+    /**
+     * Get number of bits per pixel of the glyph bitmaps.
+     *
+     * @return 1 for a GFXfont, otherwise the number of coverage bits of the anti-aliased font.
+     */
+    uint8_t getBitsPerPixel() const
+    {
+        return m_bitsPerPixel;
+    }
+
+    /**
+     * Get unicode map.
+     *
+     * @return Unicode map or nullptr, if the code point is the character code of the font.
+     */
+    const GFXunicodeMap* getUnicodeMap() const
+    {
+        return m_unicodeMap;
+    }
+
+    /**
+     * Get glyph cache.
+     *
+     * @return Glyph cache or nullptr, if the glyphs are not cached.
+     */
+    BaseGlyphCache* getGlyphCache() const
+    {
+        return m_glyphCache;
+    }
+
+    /**
+     * Set glyph cache. The glyph cache must exist as long as the font uses it.
+     *
+     * @param[in] glyphCache    Glyph cache or nullptr to disable caching.
+     */
+    void setGlyphCache(BaseGlyphCache* glyphCache)
+    {
+        m_glyphCache = glyphCache;
     }
 
     /**
@@ -161,24 +267,21 @@ public:
     /**
      * Get a glyph object from the font for the choosen character.
      *
-     * @param[in] singleChar    Character for what the glyph is requested.
+     * @param[in] codePoint Unicode code point of the character, for what the glyph is requested.
      *
      * @return If glyph is found, it will be returned otherwise nullptr.
      */
-    const GFXglyph* getGlyph(char singleChar) const
+    const GFXglyph* getGlyph(uint32_t codePoint) const
     {
-        const GFXglyph* glyph = nullptr;
-        uint8_t         uChar = static_cast<uint8_t>(singleChar);
+        const GFXglyph* glyph      = nullptr;
+        uint16_t        glyphIndex = 0U;
 
         if ((nullptr != m_gfxFont) &&
-            (m_gfxFont->first <= uChar) &&
-            (m_gfxFont->last >= uChar) &&
-            ('\n' != singleChar) &&
-            ('\r' != singleChar))
+            ('\n' != codePoint) &&
+            ('\r' != codePoint) &&
+            (true == getGlyphIndex(codePoint, glyphIndex)))
         {
-            uint8_t glyphIndex = uChar - m_gfxFont->first;
-
-            glyph              = &(m_gfxFont->glyph[glyphIndex]);
+            glyph = &(m_gfxFont->glyph[glyphIndex]);
         }
 
         return glyph;
@@ -187,16 +290,16 @@ public:
     /**
      * Get bounding box of single character.
      *
-     * @param[in]   singleChar  Single character
+     * @param[in]   codePoint   Unicode code point of the character
      * @param[out]  width       Width in pixel
      * @param[out]  height      Height in pixel
      *
      * @return If character is valid, it will return true otherwise false.
      */
-    bool getCharBoundingBox(char singleChar, uint16_t& width, uint16_t& height) const
+    bool getCharBoundingBox(uint32_t codePoint, uint16_t& width, uint16_t& height) const
     {
         bool            status = false;
-        const GFXglyph* glyph  = getGlyph(singleChar);
+        const GFXglyph* glyph  = getGlyph(codePoint);
 
         if (nullptr != glyph)
         {
@@ -220,20 +323,18 @@ public:
      * @param[in]       gfx         Graphics interface
      * @param[in,out]   cursorX     The cursor position x-coordinate.
      * @param[in,out]   cursorY     The cursor position y-coordinate.
-     * @param[in]       singleChar  Single character which to draw.
+     * @param[in]       codePoint   Unicode code point of the character which to draw.
      * @param[in]       brush       Brush to draw the character.
      */
-    void drawChar(BaseGfx<TColor>& gfx, int16_t& cursorX, int16_t& cursorY, char singleChar, const BaseGfxBrush<TColor>& brush)
+    void drawChar(BaseGfx<TColor>& gfx, int16_t& cursorX, int16_t& cursorY, uint32_t codePoint, const BaseGfxBrush<TColor>& brush)
     {
-        uint8_t uChar = static_cast<uint8_t>(singleChar);
-
         if (nullptr == m_gfxFont)
         {
             return;
         }
 
         /* Set cursor to next line? */
-        if ('\n' == singleChar)
+        if ('\n' == codePoint)
         {
             /* Move cursor to begin and one row down. */
             cursorX  = 0;
@@ -241,43 +342,25 @@ public:
         }
         else
         {
-            const GFXglyph* glyph = getGlyph(singleChar);
+            const GFXglyph* glyph = getGlyph(codePoint);
 
             /* Is character available in the font? Note, carriage return is skipped. */
             if (nullptr != glyph)
             {
                 /* Handle character only, if it is really drawn on the screen. */
-                if (0 <= (cursorX + glyph->xAdvance))
+                if ((0 <= (cursorX + glyph->xAdvance)) &&
+                    (static_cast<int32_t>(gfx.getWidth()) > (cursorX + glyph->xOffset)))
                 {
-                    int16_t  x             = 0;
-                    int16_t  y             = 0;
-                    uint16_t bitmapOffset  = glyph->bitmapOffset;
-                    uint8_t  bitmapRowBits = 0U;
-                    uint8_t  bitCnt        = 0U;
+                    int16_t xStart = cursorX + glyph->xOffset;
+                    int16_t yStart = cursorY + glyph->yOffset;
 
-                    for (y = 0U; y < glyph->height; ++y)
+                    if (true == brush.isSolid())
+                    {
+                        drawGlyph(gfx, *glyph, xStart, yStart, brush.getColor(xStart, yStart));
+                    }
+                    else
                     {
-                        for (x = 0U; x < glyph->width; ++x)
-                        {
-                            /* Every 8 bit, the bitmap offset must be increased. */
-                            if (0U == (bitCnt & 0x07))
-                            {
-                                bitmapRowBits = m_gfxFont->bitmap[bitmapOffset];
-                                ++bitmapOffset;
-                            }
-                            ++bitCnt;
-
-                            /* A 1b in the bitmap row bits must be drawn as single pixel. */
-                            if (0U != (bitmapRowBits & 0x80U))
-                            {
-                                int16_t xPos = cursorX + x + glyph->xOffset;
-                                int16_t yPos = cursorY + y + glyph->yOffset;
-
-                                gfx.drawPixel(xPos, yPos, brush.getColor(xPos, yPos));
-                            }
-
-                            bitmapRowBits <<= 1U;
-                        }
+                        drawGlyph(gfx, *glyph, xStart, yStart, brush);
                     }
                 }
 
@@ -293,7 +376,277 @@ public:
 
 private:
 
-    const GFXfont* m_gfxFont; /**< Current selected graphics font, based on Adafruit GFXfont format. */
+    /**
+     * Min. number of consecutive pixels in a glyph row, which are drawn as
+     * horizontal line with a solid color. Shorter runs are drawn pixel by pixel.
+     */
+    static const uint16_t MIN_SPAN_LENGTH = 4U;
+
+    /**
+     * Get the glyph array index of a character.
+     *
+     * Without unicode map, the code point must be in the character code range
+     * of the font. With unicode map, the code point range is searched binary.
+     * In both cases the glyph index must be inside the glyph array.
+     *
+     * @param[in]   codePoint   Unicode code point of the character
+     * @param[out]  glyphIndex  Glyph array index
+     *
+     * @return If the font contains a glyph for the character, it will return true otherwise false.
+     */
+    bool getGlyphIndex(uint32_t codePoint, uint16_t& glyphIndex) const
+    {
+        bool     isFound  = false;
+        uint32_t index    = 0U;
+        uint16_t glyphCnt = m_gfxFont->last - m_gfxFont->first + 1U;
+
+        if (nullptr == m_unicodeMap)
+        {
+            if (m_gfxFont->first <= codePoint)
+            {
+                index   = codePoint - m_gfxFont->first;
+                isFound = true;
+            }
+        }
+        else
+        {
+            uint16_t low  = 0U;
+            uint16_t high = m_unicodeMap->rangeCount;
+
+            while ((false == isFound) && (low < high))
+            {
+                uint16_t               mid   = low + ((high - low) / 2U);
+                const GFXunicodeRange& range = m_unicodeMap->ranges[mid];
+
+                if (range.first > codePoint)
+                {
+                    high = mid;
+                }
+                else if (range.last < codePoint)
+                {
+                    low = mid + 1U;
+                }
+                else
+                {
+                    index   = range.glyphIndex + (codePoint - range.first);
+                    isFound = true;
+                }
+            }
+        }
+
+        /* The glyph must be part of the glyph array. */
+        if ((true == isFound) &&
+            (glyphCnt > index))
+        {
+            glyphIndex = static_cast<uint16_t>(index);
+        }
+        else
+        {
+            isFound = false;
+        }
+
+        return isFound;
+    }
+
+    /**
+     * Calls the handler for every run of consecutive pixels with the same
+     * coverage in the glyph bitmap. Not covered pixels are skipped. The run
+     * coordinates are relative to the glyph origin.
+     *
+     * For a GFXfont every run is fully covered. The runs are taken from the
+     * glyph cache if available, otherwise the glyph bitmap is decoded.
+     *
+     * @tparam TRunHandler  Handler type with signature void(int16_t x, int16_t y, uint16_t length, uint8_t alpha).
+     *
+     * @param[in] glyph     Glyph
+     * @param[in] handler   Handler, which is called per run.
+     */
+    template < typename TRunHandler >
+    void forEachGlyphRun(const GFXglyph& glyph, TRunHandler handler) const
+    {
+        const BaseGlyphRun* runs     = nullptr;
+        uint16_t            runCount = 0U;
+
+        if (1U < m_bitsPerPixel)
+        {
+            decodeCoverageRuns(glyph, handler);
+        }
+        else if ((nullptr != m_glyphCache) &&
+                 (true == m_glyphCache->getRuns(*m_gfxFont, glyph, runs, runCount)))
+        {
+            uint16_t idx;
+
+            for (idx = 0U; idx < runCount; ++idx)
+            {
+                handler(runs[idx].x, runs[idx].y, runs[idx].length, UINT8_MAX);
+            }
+        }
+        else
+        {
+            BaseGlyphCache::decodeRuns(*m_gfxFont, glyph, [&handler](int16_t x, int16_t y, uint16_t length) {
+                handler(x, y, length, UINT8_MAX);
+            });
+        }
+    }
+
+    /**
+     * Decodes the glyph bitmap of an anti-aliased font and calls the handler
+     * for every run of consecutive pixels with the same coverage.
+     *
+     * @tparam TRunHandler  Handler type with signature void(int16_t x, int16_t y, uint16_t length, uint8_t alpha).
+     *
+     * @param[in] glyph     Glyph
+     * @param[in] handler   Handler, which is called per run.
+     */
+    template < typename TRunHandler >
+    void decodeCoverageRuns(const GFXglyph& glyph, TRunHandler handler) const
+    {
+        const uint8_t* row         = &m_gfxFont->bitmap[glyph.bitmapOffset];
+        const uint8_t  maxCoverage = (1U << m_bitsPerPixel) - 1U;
+        const uint8_t  alphaFactor = UINT8_MAX / maxCoverage;
+        const uint16_t rowSize     = ((glyph.width * m_bitsPerPixel) + 7U) / 8U;
+        int16_t        y;
+
+        for (y = 0; y < glyph.height; ++y)
+        {
+            int16_t  x;
+            int16_t  runStart    = 0;
+            uint8_t  runCoverage = 0U;
+            uint16_t bitPos      = 0U;
+
+            for (x = 0; x < glyph.width; ++x)
+            {
+                uint8_t shift    = 8U - m_bitsPerPixel - (bitPos & 0x07U);
+                uint8_t coverage = (row[bitPos >> 3U] >> shift) & maxCoverage;
+
+                if (runCoverage != coverage)
+                {
+                    if (0U < runCoverage)
+                    {
+                        handler(runStart, y, x - runStart, runCoverage * alphaFactor);
+                    }
+
+                    runStart    = x;
+                    runCoverage = coverage;
+                }
+
+                bitPos += m_bitsPerPixel;
+            }
+
+            if (0U < runCoverage)
+            {
+                handler(runStart, y, glyph.width - runStart, runCoverage * alphaFactor);
+            }
+
+            row += rowSize;
+        }
+    }
+
+    /**
+     * Draw a glyph with a solid color.
+     *
+     * @param[in] gfx       Graphics interface
+     * @param[in] glyph     Glyph
+     * @param[in] xStart    x-coordinate of the glyph origin
+     * @param[in] yStart    y-coordinate of the glyph origin
+     * @param[in] color     Color
+     */
+    void drawGlyph(BaseGfx<TColor>& gfx, const GFXglyph& glyph, int16_t xStart, int16_t yStart, const TColor& color) const
+    {
+        forEachGlyphRun(glyph, [&gfx, xStart, yStart, &color](int16_t x, int16_t y, uint16_t length, uint8_t alpha) {
+            /* Partly covered pixels are blended into the existing pixels. */
+            if (UINT8_MAX > alpha)
+            {
+                uint16_t idx;
+
+                for (idx = 0U; idx < length; ++idx)
+                {
+                    gfx.blendPixel(xStart + x + idx, yStart + y, color, alpha);
+                }
+            }
+            /* Short runs are cheaper to draw pixel by pixel. */
+            else if (MIN_SPAN_LENGTH > length)
+            {
+                uint16_t idx;
+
+                for (idx = 0U; idx < length; ++idx)
+                {
+                    gfx.drawPixel(xStart + x + idx, yStart + y, color);
+                }
+            }
+            else
+            {
+                gfx.drawHLine(xStart + x, yStart + y, length, color);
+            }
+        });
+    }
+
+    /**
+     * Draw a glyph with the colors of a brush. The brush colors are
+     * requested once per glyph row, if the glyph fits into the span buffer.
+     *
+     * @param[in] gfx       Graphics interface
+     * @param[in] glyph     Glyph
+     * @param[in] xStart    x-coordinate of the glyph origin
+     * @param[in] yStart    y-coordinate of the glyph origin
+     * @param[in] brush     Brush
+     */
+    void drawGlyph(BaseGfx<TColor>& gfx, const GFXglyph& glyph, int16_t xStart, int16_t yStart, const BaseGfxBrush<TColor>& brush) const
+    {
+        if (BaseGfx<TColor>::SPAN_BUFFER_SIZE >= glyph.width)
+        {
+            TColor  rowColors[BaseGfx<TColor>::SPAN_BUFFER_SIZE];
+            int16_t rowColorsY = -1;
+
+            forEachGlyphRun(glyph, [&](int16_t x, int16_t y, uint16_t length, uint8_t alpha) {
+                if (y != rowColorsY)
+                {
+                    brush.getColors(xStart, yStart + y, glyph.width, rowColors);
+                    rowColorsY = y;
+                }
+
+                if (UINT8_MAX > alpha)
+                {
+                    uint16_t idx;
+
+                    for (idx = 0U; idx < length; ++idx)
+                    {
+                        gfx.blendPixel(xStart + x + idx, yStart + y, rowColors[x + idx], alpha);
+                    }
+                }
+                else
+                {
+                    gfx.drawHLine(xStart + x, yStart + y, length, &rowColors[x]);
+                }
+            });
+        }
+        else
+        {
+            forEachGlyphRun(glyph, [&gfx, xStart, yStart, &brush](int16_t x, int16_t y, uint16_t length, uint8_t alpha) {
+                if (UINT8_MAX > alpha)
+                {
+                    uint16_t idx;
+
+                    for (idx = 0U; idx < length; ++idx)
+                    {
+                        int16_t pixelX = xStart + x + idx;
+                        int16_t pixelY = yStart + y;
+
+                        gfx.blendPixel(pixelX, pixelY, brush.getColor(pixelX, pixelY), alpha);
+                    }
+                }
+                else
+                {
+                    gfx.drawHLine(xStart + x, yStart + y, length, brush);
+                }
+            });
+        }
+    }
+
+    const GFXfont*       m_gfxFont;      /**< Current selected graphics font, based on Adafruit GFXfont format. */
+    uint8_t              m_bitsPerPixel; /**< Number of bits per pixel of the glyph bitmaps. */
+    BaseGlyphCache*      m_glyphCache;   /**< Glyph cache, which is optional. */
+    const GFXunicodeMap* m_unicodeMap;   /**< Unicode map, which is optional. */
 };
 
 /******************************************************************************
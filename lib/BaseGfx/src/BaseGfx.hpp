@@ -47,8 +47,12 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <math.h>
 #include <algorithm>
 
+#include "BaseGfxDirtyArea.hpp"
+#include "BaseGfxBrush.hpp"
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -60,6 +64,15 @@
 template < typename TColor >
 class BaseGfxBitmap;
 
+/**
+ * A point, e.g. a corner of a polygon.
+ */
+struct BaseGfxPoint
+{
+    int16_t x; /**< x-coordinate */
+    int16_t y; /**< y-coordinate */
+};
+
 /**
  * This class provides the base graphic functions, which are
  * color format agnostic. This way it can be used for different
@@ -72,6 +85,24 @@ class BaseGfx
 {
 public:
 
+    /** Max. number of corners of a polygon. */
+    static const uint8_t  MAX_POLYGON_POINTS = 16U;
+
+    /** Number of colors, which are requested from a brush at once. */
+    static const uint16_t SPAN_BUFFER_SIZE   = 32U;
+
+    /**
+     * Blend modes, which define how a source pixel is combined with the
+     * destination pixel. The result is always mixed with the destination
+     * according to the source alpha.
+     */
+    enum BlendMode
+    {
+        BLEND_MODE_SRC_OVER = 0, /**< Source over destination. */
+        BLEND_MODE_ADD,          /**< Source is added to the destination, saturated. */
+        BLEND_MODE_MULTIPLY      /**< Source is multiplied with the destination. */
+    };
+
     /**
      * Destroys the base graphics functionality object.
      */
@@ -187,6 +218,26 @@ public:
      */
     virtual const TColor* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) const = 0;
 
+    /**
+     * Mark a rectangle as changed. It is called by the drawing functions
+     * for every area, where at least one pixel color really changed.
+     * The default implementation doesn't track anything. Derived classes,
+     * which own a framebuffer, shall record it to be able to process only
+     * the changed area later.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    virtual void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height)
+    {
+        (void)x;
+        (void)y;
+        (void)width;
+        (void)height;
+    }
+
     /**
      * Copy from source, starting at upper left corner (0, 0).
      *
@@ -200,29 +251,44 @@ public:
      */
     void copy(const BaseGfx<TColor>& gfx)
     {
-        uint16_t minWidth  = std::min(getWidth(), gfx.getWidth());
-        uint16_t minHeight = std::min(getHeight(), gfx.getHeight());
+        uint16_t         minWidth  = std::min(getWidth(), gfx.getWidth());
+        uint16_t         minHeight = std::min(getHeight(), gfx.getHeight());
+        BaseGfxDirtyArea changedArea;
 
-        /* For better performance choose larger side for the internal
-         * copy operation.
-         */
-        if (minWidth >= minHeight)
-        {
-            int16_t y;
+        internalCopyRect(0, 0, minWidth, minHeight, gfx, 0, 0, changedArea);
+        markDirtyArea(changedArea);
+    }
 
-            for (y = 0; y < minHeight; ++y)
-            {
-                internalCopyX(0, y, minWidth, gfx, 0, y);
-            }
-        }
-        else
+    /**
+     * Copy a rectangle from source to the same position in the destination.
+     * Only pixels which differ will be written. The rectangle is clipped
+     * to source and destination.
+     *
+     * Use it together with the dirty area of the source to transfer only
+     * the changed part of a framebuffer.
+     *
+     * @param[in] gfx   Graphics interface of source
+     * @param[in] area  Rectangle which to copy
+     */
+    void copy(const BaseGfx<TColor>& gfx, const BaseGfxDirtyArea& area)
+    {
+        int32_t x1 = std::max(static_cast<int32_t>(area.getX()), static_cast<int32_t>(0));
+        int32_t y1 = std::max(static_cast<int32_t>(area.getY()), static_cast<int32_t>(0));
+        int32_t x2 = std::min(static_cast<int32_t>(area.getX()) + area.getWidth(), static_cast<int32_t>(std::min(getWidth(), gfx.getWidth())));
+        int32_t y2 = std::min(static_cast<int32_t>(area.getY()) + area.getHeight(), static_cast<int32_t>(std::min(getHeight(), gfx.getHeight())));
+
+        /* Anything to copy? */
+        if ((x1 < x2) &&
+            (y1 < y2))
         {
-            int16_t x;
-
-            for (x = 0; x < minWidth; ++x)
-            {
-                internalCopyY(x, 0, minHeight, gfx, x, 0);
-            }
+            int16_t          x      = static_cast<int16_t>(x1);
+            int16_t          y      = static_cast<int16_t>(y1);
+            uint16_t         width  = static_cast<uint16_t>(x2 - x1);
+            uint16_t         height = static_cast<uint16_t>(y2 - y1);
+            BaseGfxDirtyArea changedArea;
+
+            internalCopyRect(x, y, width, height, gfx, x, y, changedArea);
+            markDirtyArea(changedArea);
         }
     }
 
@@ -247,13 +313,30 @@ public:
 
             if (nullptr != dstAddress)
             {
-                uint16_t idx = 0U;
+                uint16_t idx   = 0U;
+                uint16_t first = height;
+                uint16_t last  = 0U;
 
                 while (height > idx)
                 {
-                    dstAddress[idx * dstOffset] = color;
+                    TColor& dstColor = dstAddress[idx * dstOffset];
+
+                    /* Write only on change to keep the dirty area small. */
+                    if (color != dstColor)
+                    {
+                        dstColor = color;
+
+                        first    = std::min(first, idx);
+                        last     = idx;
+                    }
+
                     ++idx;
                 }
+
+                if (height > first)
+                {
+                    markDirty(x, y + first, 1U, last - first + 1U);
+                }
             }
         }
     }
@@ -277,19 +360,148 @@ public:
             uint16_t dstOffset  = 0U;
             TColor*  dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
 
-            if (nullptr != dstAddress)
+            /* Contiguous pixels are filled as one span. */
+            if ((nullptr != dstAddress) &&
+                (1U == dstOffset))
+            {
+                uint32_t first = 0U;
+                uint32_t last  = 0U;
+
+                if (true == fillSpan(dstAddress, width, color, first, last))
+                {
+                    markDirty(x + first, y, last - first + 1U, 1U);
+                }
+            }
+            else if (nullptr != dstAddress)
             {
-                uint16_t idx = 0U;
+                uint16_t idx   = 0U;
+                uint16_t first = width;
+                uint16_t last  = 0U;
 
                 while (width > idx)
                 {
-                    dstAddress[idx * dstOffset] = color;
+                    TColor& dstColor = dstAddress[idx * dstOffset];
+
+                    /* Write only on change to keep the dirty area small. */
+                    if (color != dstColor)
+                    {
+                        dstColor = color;
+
+                        first    = std::min(first, idx);
+                        last     = idx;
+                    }
+
                     ++idx;
                 }
+
+                if (width > first)
+                {
+                    markDirty(x + first, y, last - first + 1U, 1U);
+                }
+            }
+            else
+            {
+                uint16_t idx;
+
+                /* No direct framebuffer access, draw pixel by pixel. */
+                for (idx = 0U; idx < width; ++idx)
+                {
+                    drawPixel(x + idx, y, color);
+                }
             }
         }
     }
 
+    /**
+     * Draw horizontal line with individual colors.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] width     Horizontal line width in pixel
+     * @param[in] colors    Colors of the line pixels, at least width elements.
+     */
+    void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor* colors)
+    {
+        int16_t srcX = 0;
+
+        clipAxis(x, srcX, width, getWidth());
+
+        /* Anything to draw? */
+        if ((nullptr != colors) &&
+            (0U < width))
+        {
+            uint16_t dstOffset  = 0U;
+            TColor*  dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
+
+            /* Contiguous pixels are copied as one span. */
+            if ((nullptr != dstAddress) &&
+                (1U == dstOffset))
+            {
+                uint32_t first = 0U;
+                uint32_t last  = 0U;
+
+                if (true == copySpan(dstAddress, &colors[srcX], width, first, last))
+                {
+                    markDirty(x + first, y, last - first + 1U, 1U);
+                }
+            }
+            else
+            {
+                uint16_t idx;
+
+                for (idx = 0U; idx < width; ++idx)
+                {
+                    drawPixel(x + idx, y, colors[srcX + idx]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Draw horizontal line with the colors of a brush.
+     * The brush colors are requested span wise, a solid brush results in
+     * a single color fill.
+     *
+     * @param[in] x     x-coordinate of start point
+     * @param[in] y     y-coordinate of start point
+     * @param[in] width Horizontal line width in pixel
+     * @param[in] brush Brush, which provides the colors
+     */
+    void drawHLine(int16_t x, int16_t y, uint16_t width, const BaseGfxBrush<TColor>& brush)
+    {
+        adaptCoordAndLength(x, width, getWidth());
+
+        if (true == brush.isSolid())
+        {
+            drawHLine(x, y, width, brush.getColor(x, y));
+        }
+        else if (0U < width)
+        {
+            TColor   colors[SPAN_BUFFER_SIZE];
+            uint16_t pos = 0U;
+
+            while (width > pos)
+            {
+                uint16_t chunkLength = width - pos;
+
+                if (SPAN_BUFFER_SIZE < chunkLength)
+                {
+                    chunkLength = SPAN_BUFFER_SIZE;
+                }
+
+                brush.getColors(x + pos, y, chunkLength, colors);
+                drawHLine(x + pos, y, chunkLength, colors);
+
+                pos += chunkLength;
+            }
+        }
+        else
+        {
+            /* Nothing to draw. */
+            ;
+        }
+    }
+
     /**
      * Draw a line.
      *
@@ -418,10 +630,28 @@ public:
         if ((0U < width) &&
             (0U < height))
         {
+            TColor* dstAddress = nullptr;
+
+            /* Complete rows of a contiguous framebuffer are filled as one span. */
+            if (getWidth() == width)
+            {
+                dstAddress = getContiguousRows(y, height);
+            }
+
+            if (nullptr != dstAddress)
+            {
+                uint32_t first = 0U;
+                uint32_t last  = 0U;
+
+                if (true == fillSpan(dstAddress, static_cast<uint32_t>(width) * height, color, first, last))
+                {
+                    markDirtySpan(y, width, first, last);
+                }
+            }
             /* For better performance choose larger side for the draw
              * operation.
              */
-            if (width >= height)
+            else if (width >= height)
             {
                 int16_t yIndex;
 
@@ -442,6 +672,34 @@ public:
         }
     }
 
+    /**
+     * Fill a rectangle with the colors of a brush.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     * @param[in] brush     Brush, which provides the colors
+     */
+    void fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height, const BaseGfxBrush<TColor>& brush)
+    {
+        if (true == brush.isSolid())
+        {
+            fillRect(x, y, width, height, brush.getColor(x, y));
+        }
+        else
+        {
+            uint16_t row;
+
+            adaptCoordAndLength(y, height, getHeight());
+
+            for (row = 0U; row < height; ++row)
+            {
+                drawHLine(x, y + row, width, brush);
+            }
+        }
+    }
+
     /**
      * Fill screen with a specific color.
      *
@@ -492,137 +750,940 @@ public:
     }
 
     /**
-     * Draw bitmap at specified location by given upper left point.
-     *
-     * If the bitmap size is lower or equal than the destination, the
-     * bitmap will be copied complete.
-     *
-     * If the bitmap size is greater than the destination, the bitmap
-     * will be copied partly.
+     * Draw a triangle outline with a specific color.
      *
-     * @param[in] x         x-coordinate of upper left point
-     * @param[in] y         y-coordinate of upper left point
-     * @param[in] bitmap    Bitmap pixel buffer
+     * @param[in] x0    x-coordinate of the 1st corner
+     * @param[in] y0    y-coordinate of the 1st corner
+     * @param[in] x1    x-coordinate of the 2nd corner
+     * @param[in] y1    y-coordinate of the 2nd corner
+     * @param[in] x2    x-coordinate of the 3rd corner
+     * @param[in] y2    y-coordinate of the 3rd corner
+     * @param[in] color Color
      */
-    void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap)
+    void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, const TColor& color)
     {
-        uint16_t minWidth  = std::min(bitmap.getWidth(), getWidth());
-        uint16_t minHeight = std::min(bitmap.getHeight(), getHeight());
-
-        adaptCoordAndLength(x, minWidth, getWidth());
-        adaptCoordAndLength(y, minHeight, getHeight());
-
-        /* Anything to draw? */
-        if ((0U < minWidth) &&
-            (0U < minHeight))
-        {
-            /* For better performance choose larger side for the internal
-             * copy operation.
-             */
-            if (minWidth >= minHeight)
-            {
-                int16_t yIndex;
+        drawLine(x0, y0, x1, y1, color);
+        drawLine(x1, y1, x2, y2, color);
+        drawLine(x2, y2, x0, y0, color);
+    }
 
-                for (yIndex = 0; yIndex < minHeight; ++yIndex)
-                {
-                    internalCopyX(x, y + yIndex, minWidth, bitmap, 0, yIndex);
-                }
-            }
-            else
-            {
-                int16_t xIndex;
+    /**
+     * Fill a triangle with a specific color.
+     * The filled pixels follow the same rules like fillPolygon().
+     *
+     * @param[in] x0    x-coordinate of the 1st corner
+     * @param[in] y0    y-coordinate of the 1st corner
+     * @param[in] x1    x-coordinate of the 2nd corner
+     * @param[in] y1    y-coordinate of the 2nd corner
+     * @param[in] x2    x-coordinate of the 3rd corner
+     * @param[in] y2    y-coordinate of the 3rd corner
+     * @param[in] color Color
+     */
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, const TColor& color)
+    {
+        const FixedPoint CORNERS[3U] = {
+            { toFixed(x0), toFixed(y0) },
+            { toFixed(x1), toFixed(y1) },
+            { toFixed(x2), toFixed(y2) }
+        };
 
-                for (xIndex = 0; xIndex < minWidth; ++xIndex)
-                {
-                    internalCopyY(x + xIndex, y, minHeight, bitmap, xIndex, 0);
-                }
-            }
-        }
+        internalFillPolygon(CORNERS, 3U, color);
     }
 
     /**
-     * Draw bitmap at specified location by given upper left point.
+     * Fill a polygon with a specific color. Self-intersecting polygons are
+     * filled with the even-odd rule.
      *
-     * If the bitmap size is lower or equal than the destination, the
-     * bitmap will be copied complete.
+     * A pixel is filled, if its coordinates are inside the polygon. The
+     * right and bottom edges are exclusive, like for fillRect(). Therefore
+     * the polygon (0, 0), (4, 0), (4, 4), (0, 4) fills the same pixels as
+     * fillRect(0, 0, 4U, 4U) and adjacent polygons don't overlap.
      *
-     * If the bitmap size is greater than the destination, the bitmap
-     * will be copied partly.
+     * The polygon is rasterized row by row and every row is written as
+     * horizontal spans.
      *
-     * @param[in] x                 x-coordinate of upper left point
-     * @param[in] y                 y-coordinate of upper left point
-     * @param[in] bitmap            Bitmap pixel buffer
-     * @param[in] transparentColor  Color which shall be treated as transparent.
+     * @param[in] points    List of corners
+     * @param[in] count     Number of corners [3; MAX_POLYGON_POINTS]
+     * @param[in] color     Color
      */
-    void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap, const TColor& transparentColor)
+    void fillPolygon(const BaseGfxPoint* points, uint8_t count, const TColor& color)
     {
-        uint16_t minWidth  = std::min(bitmap.getWidth(), getWidth());
-        uint16_t minHeight = std::min(bitmap.getHeight(), getHeight());
-
-        adaptCoordAndLength(x, minWidth, getWidth());
-        adaptCoordAndLength(y, minHeight, getHeight());
-
-        /* Anything to draw? */
-        if ((0U < minWidth) &&
-            (0U < minHeight))
+        if ((nullptr != points) &&
+            (MAX_POLYGON_POINTS >= count))
         {
-            /* For better performance choose larger side for the internal
-             * copy operation.
-             */
-            if (minWidth >= minHeight)
-            {
-                int16_t yIndex;
+            FixedPoint corners[MAX_POLYGON_POINTS];
+            uint8_t    idx;
 
-                for (yIndex = 0; yIndex < minHeight; ++yIndex)
-                {
-                    internalCopyX(x, y + yIndex, minWidth, bitmap, 0, yIndex, transparentColor);
-                }
-            }
-            else
+            for (idx = 0U; idx < count; ++idx)
             {
-                int16_t xIndex;
-
-                for (xIndex = 0; xIndex < minWidth; ++xIndex)
-                {
-                    internalCopyY(x + xIndex, y, minHeight, bitmap, xIndex, 0, transparentColor);
-                }
+                corners[idx].x = toFixed(points[idx].x);
+                corners[idx].y = toFixed(points[idx].y);
             }
-        }
-    }
-
-protected:
 
-    /* Constructs the graphic functionality. */
-    BaseGfx()
-    {
+            internalFillPolygon(corners, count, color);
+        }
     }
 
-private:
-
     /**
-     * Adapts the coordinate and the length for a axis to ensure that
-     * the coordinate is inside the valid canvas border and
-     * the length, calculated from the coord on, will be inside the valid canvas too.
-     *
-     * Example for x-axis:
-     *      Line shall be drawn from -10 with a length of 80.
-     *      The canvas width is 32.
-     *      After adaption, the x-coordinate will be 0 and the length will be 32.
+     * Draw a line with a specific thickness.
+     * The end points are included, like for drawLine(). The line ends are
+     * cut off perpendicular to the line direction.
      *
-     * @param[in,out] coord     x- or y-coordinate, depends on the choosen axis.
-     * @param[in,out] length    Width or height which is requested, starting from coord.
-     * @param[in] maxLength     Max. length of the choosen axis.
+     * @param[in] xs        x-coordinate of start point
+     * @param[in] ys        y-coordinate of start point
+     * @param[in] xe        x-coordinate of end point
+     * @param[in] ye        y-coordinate of end point
+     * @param[in] thickness Line thickness in pixel
+     * @param[in] color     Color
      */
-    void adaptCoordAndLength(int16_t& coord, uint16_t& length, uint16_t maxLength)
+    void drawThickLine(int16_t xs, int16_t ys, int16_t xe, int16_t ye, uint16_t thickness, const TColor& color)
     {
-        /* Positive? */
-        if (0 <= coord)
+        if (1U == thickness)
         {
-            /* Out of bounds? */
-            if (maxLength < coord)
+            drawLine(xs, ys, xe, ye, color);
+        }
+        else if (1U < thickness)
+        {
+            const int32_t DX     = xe - xs;
+            const int32_t DY     = ye - ys;
+            float         length = sqrtf(static_cast<float>(DX * DX + DY * DY));
+            float         dirX   = 1.0F;
+            float         dirY   = 0.0F;
+            int32_t       normalX;
+            int32_t       normalY;
+            int32_t       extendX;
+            int32_t       extendY;
+
+            if (0.0F < length)
             {
-                length = 0U;
-                coord  = 0;
+                dirX = DX / length;
+                dirY = DY / length;
+            }
+
+            /* Half the thickness to both sides and half a pixel beyond
+             * both end points, which includes the end points.
+             */
+            normalX = static_cast<int32_t>(lroundf(-dirY * thickness * (FIXED_POINT_ONE / 2)));
+            normalY = static_cast<int32_t>(lroundf(dirX * thickness * (FIXED_POINT_ONE / 2)));
+            extendX = static_cast<int32_t>(lroundf(dirX * (FIXED_POINT_ONE / 2)));
+            extendY = static_cast<int32_t>(lroundf(dirY * (FIXED_POINT_ONE / 2)));
+
+            {
+                const FixedPoint CORNERS[4U] = {
+                    { toFixed(xs) - extendX + normalX, toFixed(ys) - extendY + normalY },
+                    { toFixed(xe) + extendX + normalX, toFixed(ye) + extendY + normalY },
+                    { toFixed(xe) + extendX - normalX, toFixed(ye) + extendY - normalY },
+                    { toFixed(xs) - extendX - normalX, toFixed(ys) - extendY - normalY }
+                };
+
+                internalFillPolygon(CORNERS, 4U, color);
+            }
+        }
+        else
+        {
+            /* Nothing to draw. */
+            ;
+        }
+    }
+
+    /**
+     * Draw a rectangle with rounded corners with a specific color.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     * @param[in] radius    Corner radius in pixel, limited to half of the smaller side.
+     * @param[in] color     Color
+     */
+    void drawRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t radius, const TColor& color)
+    {
+        radius = std::min(radius, static_cast<uint16_t>(std::min(width, height) / 2U));
+
+        if (0U == radius)
+        {
+            drawRectangle(x, y, width, height, color);
+        }
+        else
+        {
+            const int16_t RIGHT     = x + width - 1;
+            const int16_t BOTTOM    = y + height - 1;
+            uint16_t      prevInset = radius;
+            uint16_t      row;
+
+            for (row = 0U; row < radius; ++row)
+            {
+                uint16_t inset = getRoundCornerInset(radius, row);
+                uint16_t last  = inset;
+
+                /* The first row continues to the other corner, the others
+                 * connect to the row above.
+                 */
+                if (0U == row)
+                {
+                    last = width - 1U - inset;
+                }
+                else if (inset < prevInset)
+                {
+                    last = prevInset - 1U;
+                }
+                else
+                {
+                    /* Nothing to do. */
+                    ;
+                }
+
+                drawHLine(x + inset, y + row, last - inset + 1U, color);
+                drawHLine(x + inset, BOTTOM - row, last - inset + 1U, color);
+
+                if (0U < row)
+                {
+                    drawHLine(RIGHT - last, y + row, last - inset + 1U, color);
+                    drawHLine(RIGHT - last, BOTTOM - row, last - inset + 1U, color);
+                }
+
+                prevInset = inset;
+            }
+
+            if ((2U * radius) < height)
+            {
+                drawVLine(x, y + radius, height - (2U * radius), color);
+                drawVLine(RIGHT, y + radius, height - (2U * radius), color);
+            }
+        }
+    }
+
+    /**
+     * Fill a rectangle with rounded corners with a specific color.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     * @param[in] radius    Corner radius in pixel, limited to half of the smaller side.
+     * @param[in] color     Color
+     */
+    void fillRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t radius, const TColor& color)
+    {
+        uint16_t row;
+
+        radius = std::min(radius, static_cast<uint16_t>(std::min(width, height) / 2U));
+
+        for (row = 0U; row < radius; ++row)
+        {
+            uint16_t inset = getRoundCornerInset(radius, row);
+
+            drawHLine(x + inset, y + row, width - (2U * inset), color);
+            drawHLine(x + inset, y + height - 1 - row, width - (2U * inset), color);
+        }
+
+        fillRect(x, y + radius, width, height - (2U * radius), color);
+    }
+
+    /**
+     * Draw an anti-aliased line with a specific color.
+     * https://en.wikipedia.org/wiki/Xiaolin_Wu%27s_line_algorithm
+     *
+     * The line is blended into the existing pixels. The end points are
+     * drawn with full coverage.
+     *
+     * @param[in] xs    x-coordinate of start point
+     * @param[in] ys    y-coordinate of start point
+     * @param[in] xe    x-coordinate of end point
+     * @param[in] ye    y-coordinate of end point
+     * @param[in] color Color
+     */
+    void drawLineAA(int16_t xs, int16_t ys, int16_t xe, int16_t ye, const TColor& color)
+    {
+        const bool IS_STEEP = abs(ye - ys) > abs(xe - xs);
+
+        /* Walk always along the major axis from lower to higher coordinate. */
+        if (true == IS_STEEP)
+        {
+            std::swap(xs, ys);
+            std::swap(xe, ye);
+        }
+
+        if (xs > xe)
+        {
+            std::swap(xs, xe);
+            std::swap(ys, ye);
+        }
+
+        {
+            const int32_t DX       = xe - xs;
+            const int32_t DY       = ye - ys;
+            int32_t       gradient = 0;
+            int32_t       intery;
+            int16_t       major;
+
+            if (0 < DX)
+            {
+                gradient = (DY * GRADIENT_ONE) / DX;
+            }
+
+            intery = (static_cast<int32_t>(ys) * GRADIENT_ONE) + gradient;
+
+            blendPixelAA(IS_STEEP, xs, ys, color, UINT8_MAX);
+            blendPixelAA(IS_STEEP, xe, ye, color, UINT8_MAX);
+
+            for (major = xs + 1; major < xe; ++major)
+            {
+                /* Integer part selects the pixel pair, the fractional part
+                 * distributes the coverage between them.
+                 */
+                int16_t minor    = static_cast<int16_t>(intery >> GRADIENT_SHIFT);
+                uint8_t coverage = static_cast<uint8_t>((intery >> (GRADIENT_SHIFT - 8U)) & 0xFFU);
+
+                blendPixelAA(IS_STEEP, major, minor, color, UINT8_MAX - coverage);
+                blendPixelAA(IS_STEEP, major, minor + 1, color, coverage);
+
+                intery += gradient;
+            }
+        }
+    }
+
+    /**
+     * Fill a circle with anti-aliased edge with a specific color.
+     *
+     * The inner part is written as horizontal spans, only the edge pixels
+     * are blended into the existing pixels with their coverage.
+     *
+     * @param[in] mx        x-coordinate of middle point
+     * @param[in] my        y-coordinate of middle point
+     * @param[in] radius    Radius in pixel
+     * @param[in] color     Color
+     */
+    void fillCircleAA(int16_t mx, int16_t my, uint16_t radius, const TColor& color)
+    {
+        const float INNER_RADIUS = static_cast<float>(radius) - 0.5F;
+        const float OUTER_RADIUS = static_cast<float>(radius) + 0.5F;
+        int16_t     dy;
+
+        for (dy = -static_cast<int16_t>(radius); dy <= static_cast<int16_t>(radius); ++dy)
+        {
+            const float DY2   = static_cast<float>(dy * dy);
+            const float INNER = (INNER_RADIUS * INNER_RADIUS) - DY2;
+            int16_t     inner = -1;
+            int16_t     outer = static_cast<int16_t>(sqrtf((OUTER_RADIUS * OUTER_RADIUS) - DY2));
+            int16_t     dx;
+
+            /* Pixels completely inside the circle. */
+            if ((0.0F <= INNER) &&
+                (0.0F <= INNER_RADIUS))
+            {
+                inner = static_cast<int16_t>(sqrtf(INNER));
+
+                drawHLine(mx - inner, my + dy, (2 * inner) + 1, color);
+            }
+
+            /* Pixels at the edge, covered by the distance to the circle. */
+            for (dx = inner + 1; dx <= outer; ++dx)
+            {
+                float    distance = sqrtf(static_cast<float>(dx * dx) + DY2);
+                float    coverage = std::min(std::max(OUTER_RADIUS - distance, 0.0F), 1.0F);
+                uint8_t  alpha    = static_cast<uint8_t>(lroundf(coverage * UINT8_MAX));
+
+                blendPixel(mx + dx, my + dy, color, alpha);
+
+                /* The middle pixel exists only once. */
+                if (0 < dx)
+                {
+                    blendPixel(mx - dx, my + dy, color, alpha);
+                }
+            }
+        }
+    }
+
+    /**
+     * Blend a single pixel with a specific color into the existing pixel.
+     * Pixels outside the canvas are skipped.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     * @param[in] alpha Color coverage [0; 255] - 0: transparent / 255: opaque.
+     */
+    virtual void blendPixel(int16_t x, int16_t y, const TColor& color, uint8_t alpha)
+    {
+        if ((0 > x) ||
+            (0 > y) ||
+            (getWidth() <= x) ||
+            (getHeight() <= y))
+        {
+            /* Outside the canvas, nothing to draw. */
+            ;
+        }
+        else if (UINT8_MAX == alpha)
+        {
+            drawPixel(x, y, color);
+        }
+        else if (0U < alpha)
+        {
+            drawPixel(x, y, blendColor(getColor(x, y), color, alpha));
+        }
+        else
+        {
+            /* Transparent, nothing to draw. */
+            ;
+        }
+    }
+
+    /**
+     * Draw bitmap at specified location by given upper left point.
+     *
+     * If the bitmap size is lower or equal than the destination, the
+     * bitmap will be copied complete.
+     *
+     * If the bitmap size is greater than the destination, the bitmap
+     * will be copied partly.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] bitmap    Bitmap pixel buffer
+     */
+    void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap)
+    {
+        uint16_t minWidth  = std::min(bitmap.getWidth(), getWidth());
+        uint16_t minHeight = std::min(bitmap.getHeight(), getHeight());
+
+        adaptCoordAndLength(x, minWidth, getWidth());
+        adaptCoordAndLength(y, minHeight, getHeight());
+
+        /* Anything to draw? */
+        if ((0U < minWidth) &&
+            (0U < minHeight))
+        {
+            BaseGfxDirtyArea changedArea;
+
+            internalCopyRect(x, y, minWidth, minHeight, bitmap, 0, 0, changedArea);
+            markDirtyArea(changedArea);
+        }
+    }
+
+    /**
+     * Draw bitmap at specified location by given upper left point.
+     *
+     * If the bitmap size is lower or equal than the destination, the
+     * bitmap will be copied complete.
+     *
+     * If the bitmap size is greater than the destination, the bitmap
+     * will be copied partly.
+     *
+     * @param[in] x                 x-coordinate of upper left point
+     * @param[in] y                 y-coordinate of upper left point
+     * @param[in] bitmap            Bitmap pixel buffer
+     * @param[in] transparentColor  Color which shall be treated as transparent.
+     */
+    void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap, const TColor& transparentColor)
+    {
+        uint16_t minWidth  = std::min(bitmap.getWidth(), getWidth());
+        uint16_t minHeight = std::min(bitmap.getHeight(), getHeight());
+
+        adaptCoordAndLength(x, minWidth, getWidth());
+        adaptCoordAndLength(y, minHeight, getHeight());
+
+        /* Anything to draw? */
+        if ((0U < minWidth) &&
+            (0U < minHeight))
+        {
+            BaseGfxDirtyArea changedArea;
+
+            /* For better performance choose larger side for the internal
+             * copy operation.
+             */
+            if (minWidth >= minHeight)
+            {
+                int16_t yIndex;
+
+                for (yIndex = 0; yIndex < minHeight; ++yIndex)
+                {
+                    internalCopyX(x, y + yIndex, minWidth, bitmap, 0, yIndex, transparentColor, changedArea);
+                }
+            }
+            else
+            {
+                int16_t xIndex;
+
+                for (xIndex = 0; xIndex < minWidth; ++xIndex)
+                {
+                    internalCopyY(x + xIndex, y, minHeight, bitmap, xIndex, 0, transparentColor, changedArea);
+                }
+            }
+
+            markDirtyArea(changedArea);
+        }
+    }
+
+    /**
+     * Draw bitmap at specified location by given upper left point and
+     * blend it with the existing pixels.
+     *
+     * If the bitmap provides an alpha channel, every pixel is blended with
+     * its own alpha, which is additionally scaled by the given alpha.
+     * Otherwise the given alpha is used for all pixels.
+     *
+     * The bitmap is clipped at the canvas border.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] bitmap    Bitmap pixel buffer
+     * @param[in] mode      Blend mode
+     * @param[in] alpha     Bitmap alpha [0; 255] - 0: transparent / 255: opaque.
+     */
+    void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap, BlendMode mode, uint8_t alpha = UINT8_MAX)
+    {
+        int16_t  srcX   = 0;
+        int16_t  srcY   = 0;
+        uint16_t width  = bitmap.getWidth();
+        uint16_t height = bitmap.getHeight();
+
+        clipAxis(x, srcX, width, getWidth());
+        clipAxis(y, srcY, height, getHeight());
+
+        /* Anything to draw? */
+        if ((0U < width) &&
+            (0U < height) &&
+            (0U < alpha))
+        {
+            BaseGfxDirtyArea changedArea;
+            uint16_t         row;
+
+            for (row = 0U; row < height; ++row)
+            {
+                internalBlendX(x, y + row, width, bitmap, srcX, srcY + row, mode, alpha, changedArea);
+            }
+
+            markDirtyArea(changedArea);
+        }
+    }
+
+protected:
+
+    /* Constructs the graphic functionality. */
+    BaseGfx()
+    {
+    }
+
+private:
+
+    /**
+     * A point in fixed point format, used by the polygon rasterizer.
+     */
+    struct FixedPoint
+    {
+        int32_t x; /**< x-coordinate */
+        int32_t y; /**< y-coordinate */
+    };
+
+    /** Number of fractional bits of a fixed point coordinate. */
+    static const uint8_t FIXED_POINT_SHIFT = 8U;
+
+    /** The value 1 as fixed point coordinate. */
+    static const int32_t FIXED_POINT_ONE   = 1 << FIXED_POINT_SHIFT;
+
+    /** Number of fractional bits of the anti-aliased line gradient. */
+    static const uint8_t GRADIENT_SHIFT    = 16U;
+
+    /** The value 1 as anti-aliased line gradient. */
+    static const int32_t GRADIENT_ONE      = 1 << GRADIENT_SHIFT;
+
+    /**
+     * Convert a coordinate to fixed point format.
+     *
+     * @param[in] value Coordinate
+     *
+     * @return Fixed point coordinate
+     */
+    static int32_t toFixed(int16_t value)
+    {
+        return static_cast<int32_t>(value) * FIXED_POINT_ONE;
+    }
+
+    /**
+     * Get the smallest coordinate, which is greater or equal than the
+     * fixed point coordinate.
+     *
+     * @param[in] value Fixed point coordinate
+     *
+     * @return Coordinate
+     */
+    static int32_t fixedCeil(int32_t value)
+    {
+        return -((-value) >> FIXED_POINT_SHIFT);
+    }
+
+    /**
+     * Fill a polygon row by row, see fillPolygon().
+     *
+     * For every row the crossings of the polygon edges are determined and
+     * sorted. The pixels between two crossings are written as one span.
+     *
+     * @param[in] corners   List of corners in fixed point format
+     * @param[in] count     Number of corners [3; MAX_POLYGON_POINTS]
+     * @param[in] color     Color
+     */
+    void internalFillPolygon(const FixedPoint* corners, uint8_t count, const TColor& color)
+    {
+        if ((3U <= count) &&
+            (MAX_POLYGON_POINTS >= count))
+        {
+            int32_t minY = corners[0U].y;
+            int32_t maxY = corners[0U].y;
+            int32_t row;
+            int32_t lastRow;
+            uint8_t idx;
+
+            for (idx = 1U; idx < count; ++idx)
+            {
+                minY = std::min(minY, corners[idx].y);
+                maxY = std::max(maxY, corners[idx].y);
+            }
+
+            /* Only rows inside the canvas are rasterized. */
+            row     = std::max(fixedCeil(minY), static_cast<int32_t>(0));
+            lastRow = std::min(fixedCeil(maxY), static_cast<int32_t>(getHeight()));
+
+            for (; row < lastRow; ++row)
+            {
+                const int32_t ROW_Y = row * FIXED_POINT_ONE;
+                int32_t       crossings[MAX_POLYGON_POINTS];
+                uint8_t       crossingCount = 0U;
+
+                for (idx = 0U; idx < count; ++idx)
+                {
+                    const FixedPoint& from = corners[idx];
+                    const FixedPoint& to   = corners[(idx + 1U) % count];
+
+                    /* The upper end of an edge is inclusive and the lower
+                     * end exclusive. This way a corner, which is shared
+                     * by two edges, is counted only once.
+                     */
+                    if (((from.y <= ROW_Y) && (ROW_Y < to.y)) ||
+                        ((to.y <= ROW_Y) && (ROW_Y < from.y)))
+                    {
+                        int64_t dividend = static_cast<int64_t>(ROW_Y - from.y) * (to.x - from.x);
+                        int32_t crossing = from.x + static_cast<int32_t>(dividend / (to.y - from.y));
+                        uint8_t pos      = crossingCount;
+
+                        /* Insertion sort, because there are only a few crossings. */
+                        while ((0U < pos) &&
+                               (crossings[pos - 1U] > crossing))
+                        {
+                            crossings[pos] = crossings[pos - 1U];
+                            --pos;
+                        }
+
+                        crossings[pos] = crossing;
+                        ++crossingCount;
+                    }
+                }
+
+                for (idx = 0U; (idx + 1U) < crossingCount; idx += 2U)
+                {
+                    int32_t first = std::max(fixedCeil(crossings[idx]), static_cast<int32_t>(0));
+                    int32_t last  = std::min(fixedCeil(crossings[idx + 1U]), static_cast<int32_t>(getWidth()));
+
+                    if (first < last)
+                    {
+                        drawHLine(first, row, last - first, color);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Get the number of pixels in a row of a rounded corner, which are
+     * outside of the corner circle. A pixel is inside, if its center is
+     * inside the circle.
+     *
+     * @param[in] radius    Corner radius in pixel
+     * @param[in] row       Row inside the corner, 0 is the outermost row.
+     *
+     * @return Number of pixels outside of the corner circle
+     */
+    static uint16_t getRoundCornerInset(uint16_t radius, uint16_t row)
+    {
+        /* Calculated with doubled coordinates to stay with integers. */
+        const int32_t RADIUS2 = 4 * static_cast<int32_t>(radius) * radius;
+        const int32_t DY      = (2 * static_cast<int32_t>(radius)) - (2 * static_cast<int32_t>(row)) - 1;
+        uint16_t      inset   = 0U;
+
+        while (radius > inset)
+        {
+            const int32_t DX = (2 * static_cast<int32_t>(radius)) - (2 * static_cast<int32_t>(inset)) - 1;
+
+            if (RADIUS2 >= ((DX * DX) + (DY * DY)))
+            {
+                break;
+            }
+
+            ++inset;
+        }
+
+        return inset;
+    }
+
+    /**
+     * Blend a pixel of the anti-aliased line.
+     *
+     * @param[in] isSteep   If the line is steep, major and minor axis are swapped.
+     * @param[in] major     Coordinate on the major axis
+     * @param[in] minor     Coordinate on the minor axis
+     * @param[in] color     Color
+     * @param[in] alpha     Color coverage [0; 255]
+     */
+    void blendPixelAA(bool isSteep, int16_t major, int16_t minor, const TColor& color, uint8_t alpha)
+    {
+        if (true == isSteep)
+        {
+            blendPixel(minor, major, color, alpha);
+        }
+        else
+        {
+            blendPixel(major, minor, color, alpha);
+        }
+    }
+
+    /**
+     * Blend a color with a background color.
+     *
+     * @param[in] background    Background color
+     * @param[in] foreground    Foreground color
+     * @param[in] alpha         Foreground coverage [0; 255]
+     * @param[in] mode          Blend mode
+     *
+     * @return Blended color
+     */
+    static TColor blendColor(const TColor& background, const TColor& foreground, uint8_t alpha, BlendMode mode = BLEND_MODE_SRC_OVER)
+    {
+        TColor  blended;
+        uint8_t bgRed;
+        uint8_t bgGreen;
+        uint8_t bgBlue;
+        uint8_t fgRed;
+        uint8_t fgGreen;
+        uint8_t fgBlue;
+
+        background.get(bgRed, bgGreen, bgBlue);
+        foreground.get(fgRed, fgGreen, fgBlue);
+
+        blended.set(
+            blendChannel(bgRed, fgRed, alpha, mode),
+            blendChannel(bgGreen, fgGreen, alpha, mode),
+            blendChannel(bgBlue, fgBlue, alpha, mode));
+
+        return blended;
+    }
+
+    /**
+     * Blend a single color channel.
+     *
+     * @param[in] dst   Destination channel value
+     * @param[in] src   Source channel value
+     * @param[in] alpha Source alpha [0; 255]
+     * @param[in] mode  Blend mode
+     *
+     * @return Blended channel value
+     */
+    static uint8_t blendChannel(uint8_t dst, uint8_t src, uint8_t alpha, BlendMode mode)
+    {
+        uint8_t result = src;
+
+        switch (mode)
+        {
+        case BLEND_MODE_ADD:
+            result = static_cast<uint8_t>(std::min<uint16_t>(dst + src, UINT8_MAX));
+            break;
+
+        case BLEND_MODE_MULTIPLY:
+            result = div255(static_cast<uint32_t>(dst) * src);
+            break;
+
+        case BLEND_MODE_SRC_OVER:
+            /* fallthrough */
+        default:
+            break;
+        }
+
+        if (UINT8_MAX != alpha)
+        {
+            result = div255((static_cast<uint32_t>(result) * alpha) + (static_cast<uint32_t>(dst) * (UINT8_MAX - alpha)));
+        }
+
+        return result;
+    }
+
+    /**
+     * Divide by 255 with rounding, without a division.
+     * Exact for all products of two 8-bit values.
+     *
+     * @param[in] value Value [0; 65025]
+     *
+     * @return Rounded quotient
+     */
+    static uint8_t div255(uint32_t value)
+    {
+        value += 128U;
+
+        return static_cast<uint8_t>((value + (value >> 8U)) >> 8U);
+    }
+
+    /**
+     * Clip a bitmap on one axis against the canvas border.
+     *
+     * @param[in,out] coord     Destination x- or y-coordinate
+     * @param[in,out] srcCoord  Source x- or y-coordinate inside the bitmap
+     * @param[in,out] length    Width or height to draw, 0 if nothing is left.
+     * @param[in] maxLength     Canvas width or height
+     */
+    static void clipAxis(int16_t& coord, int16_t& srcCoord, uint16_t& length, uint16_t maxLength)
+    {
+        if (0 > coord)
+        {
+            uint16_t skip = static_cast<uint16_t>(-coord);
+
+            if (skip >= length)
+            {
+                length = 0U;
+            }
+            else
+            {
+                srcCoord += skip;
+                length   -= skip;
+            }
+
+            coord = 0;
+        }
+
+        if (maxLength <= coord)
+        {
+            length = 0U;
+        }
+        else
+        {
+            length = std::min(length, static_cast<uint16_t>(maxLength - coord));
+        }
+    }
+
+    /**
+     * Blend a row of a bitmap into the canvas.
+     *
+     * @param[in] x             Destination x-coordinate
+     * @param[in] y             Destination y-coordinate
+     * @param[in] width         Number of pixels
+     * @param[in] src           Source bitmap
+     * @param[in] srcX          Source x-coordinate
+     * @param[in] srcY          Source y-coordinate
+     * @param[in] mode          Blend mode
+     * @param[in] alpha         Bitmap alpha [1; 255]
+     * @param[in] changedArea   Area which is extended by the changed pixels
+     */
+    void internalBlendX(int16_t x, int16_t y, uint16_t width, const BaseGfxBitmap<TColor>& src, int16_t srcX, int16_t srcY, BlendMode mode, uint8_t alpha, BaseGfxDirtyArea& changedArea)
+    {
+        uint16_t       dstOffset  = 0U;
+        uint16_t       srcOffset  = 0U;
+        TColor*        dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
+        const TColor*  srcAddress = src.getFrameBufferXAddr(srcX, srcY, width, srcOffset);
+        const uint8_t* srcAlpha   = src.getAlphaXAddr(srcX, srcY, width);
+        uint16_t       idx;
+
+        if ((nullptr != dstAddress) &&
+            (nullptr != srcAddress))
+        {
+            uint16_t first = width;
+            uint16_t last  = 0U;
+
+            for (idx = 0U; idx < width; ++idx)
+            {
+                uint8_t pixelAlpha = alpha;
+
+                if (nullptr != srcAlpha)
+                {
+                    pixelAlpha = (UINT8_MAX == alpha) ? srcAlpha[idx] : div255(static_cast<uint32_t>(srcAlpha[idx]) * alpha);
+                }
+
+                if (0U < pixelAlpha)
+                {
+                    TColor&       dstColor = dstAddress[idx * dstOffset];
+                    const TColor& srcColor = srcAddress[idx * srcOffset];
+
+                    /* Opaque source over destination is a plain copy. */
+                    if ((BLEND_MODE_SRC_OVER == mode) &&
+                        (UINT8_MAX == pixelAlpha))
+                    {
+                        if (srcColor != dstColor)
+                        {
+                            dstColor = srcColor;
+                            first    = std::min(first, idx);
+                            last     = idx;
+                        }
+                    }
+                    else
+                    {
+                        TColor blended = blendColor(dstColor, srcColor, pixelAlpha, mode);
+
+                        if (blended != dstColor)
+                        {
+                            dstColor = blended;
+                            first    = std::min(first, idx);
+                            last     = idx;
+                        }
+                    }
+                }
+            }
+
+            if (width > first)
+            {
+                changedArea.add(x + first, y, last - first + 1U, 1U);
+            }
+        }
+        /* No direct framebuffer access, blend pixel by pixel. */
+        else
+        {
+            for (idx = 0U; idx < width; ++idx)
+            {
+                uint8_t pixelAlpha = alpha;
+
+                if (nullptr != srcAlpha)
+                {
+                    pixelAlpha = div255(static_cast<uint32_t>(srcAlpha[idx]) * alpha);
+                }
+
+                if (0U < pixelAlpha)
+                {
+                    drawPixel(x + idx, y, blendColor(getColor(x + idx, y), src.getColor(srcX + idx, srcY), pixelAlpha, mode));
+                }
+            }
+        }
+    }
+
+
+    /**
+     * Adapts the coordinate and the length for a axis to ensure that
+     * the coordinate is inside the valid canvas border and
+     * the length, calculated from the coord on, will be inside the valid canvas too.
+     *
+     * Example for x-axis:
+     *      Line shall be drawn from -10 with a length of 80.
+     *      The canvas width is 32.
+     *      After adaption, the x-coordinate will be 0 and the length will be 32.
+     *
+     * @param[in,out] coord   x- or y-coordinate, depends on the choosen axis.
+     * @param[in,out] length  Width or height which is requested, starting from coord.
+     * @param[in] maxLength   Max. length of the choosen axis.
+     */
+    void adaptCoordAndLength(int16_t& coord, uint16_t& length, uint16_t maxLength)
+    {
+        /* Positive? */
+        if (0 <= coord)
+        {
+            /* Out of bounds? */
+            if (maxLength < coord)
+            {
+                length = 0U;
+                coord  = 0;
             }
             else
             {
@@ -633,8 +1694,6 @@ private:
         /* Negative */
         else
         {
-            length = std::min(length, maxLength);
-
             /* Out of bounds? */
             if (static_cast<uint16_t>(-coord) > length)
             {
@@ -644,39 +1703,340 @@ private:
             else
             {
                 length -= static_cast<uint16_t>(-coord);
+                length  = std::min(length, maxLength);
                 coord   = 0;
             }
         }
     }
 
+    /**
+     * Mark a changed area as dirty.
+     *
+     * @param[in] area  Changed area
+     */
+    void markDirtyArea(const BaseGfxDirtyArea& area)
+    {
+        if (false == area.isEmpty())
+        {
+            markDirty(area.getX(), area.getY(), area.getWidth(), area.getHeight());
+        }
+    }
+
+    /**
+     * Mark the changed part of a span as dirty, which consists of complete
+     * rows starting at the given y-coordinate.
+     *
+     * @param[in] y     y-coordinate of the first row of the span
+     * @param[in] width Row width in pixel
+     * @param[in] first Index of the first changed pixel in the span
+     * @param[in] last  Index of the last changed pixel in the span
+     */
+    void markDirtySpan(int16_t y, uint16_t width, uint32_t first, uint32_t last)
+    {
+        BaseGfxDirtyArea changedArea;
+
+        addSpan(changedArea, y, width, first, last);
+        markDirtyArea(changedArea);
+    }
+
+    /**
+     * Add the changed part of a span to the changed area. The span consists
+     * of complete rows starting at the given y-coordinate.
+     *
+     * @param[in,out] changedArea   Changed area, which will be extended.
+     * @param[in] y                 y-coordinate of the first row of the span
+     * @param[in] width             Row width in pixel
+     * @param[in] first             Index of the first changed pixel in the span
+     * @param[in] last              Index of the last changed pixel in the span
+     */
+    static void addSpan(BaseGfxDirtyArea& changedArea, int16_t y, uint16_t width, uint32_t first, uint32_t last)
+    {
+        uint16_t firstRow = static_cast<uint16_t>(first / width);
+        uint16_t lastRow  = static_cast<uint16_t>(last / width);
+
+        if (firstRow == lastRow)
+        {
+            changedArea.add(static_cast<int16_t>(first % width), y + firstRow, static_cast<uint16_t>(last - first + 1U), 1U);
+        }
+        else
+        {
+            changedArea.add(0, y + firstRow, width, lastRow - firstRow + 1U);
+        }
+    }
+
+    /**
+     * Get the address of complete rows, if they are contiguous in the
+     * framebuffer. This is the case if the rows are stored one after
+     * another without gaps, like in a bitmap.
+     *
+     * @param[in] y         y-coordinate of the first row
+     * @param[in] height    Number of rows
+     *
+     * @return Address of the first row or nullptr, if not contiguous.
+     */
+    TColor* getContiguousRows(int16_t y, uint16_t height)
+    {
+        uint16_t width      = getWidth();
+        uint16_t offset     = 0U;
+        TColor*  firstRow   = getFrameBufferXAddr(0, y, width, offset);
+        TColor*  contiguous = nullptr;
+
+        if ((nullptr != firstRow) &&
+            (1U == offset))
+        {
+            TColor* lastRow = getFrameBufferXAddr(0, y + height - 1, width, offset);
+
+            if ((nullptr != lastRow) &&
+                (1U == offset) &&
+                (&firstRow[static_cast<uint32_t>(height - 1U) * width] == lastRow))
+            {
+                contiguous = firstRow;
+            }
+        }
+
+        return contiguous;
+    }
+
+    /**
+     * Get the address of complete rows of the source, if they are contiguous
+     * in the framebuffer.
+     *
+     * @param[in] src       Source graphics interface
+     * @param[in] y         y-coordinate of the first row
+     * @param[in] height    Number of rows
+     *
+     * @return Address of the first row or nullptr, if not contiguous.
+     */
+    static const TColor* getContiguousRows(const BaseGfx<TColor>& src, int16_t y, uint16_t height)
+    {
+        uint16_t      width      = src.getWidth();
+        uint16_t      offset     = 0U;
+        const TColor* firstRow   = src.getFrameBufferXAddr(0, y, width, offset);
+        const TColor* contiguous = nullptr;
+
+        if ((nullptr != firstRow) &&
+            (1U == offset))
+        {
+            const TColor* lastRow = src.getFrameBufferXAddr(0, y + height - 1, width, offset);
+
+            if ((nullptr != lastRow) &&
+                (1U == offset) &&
+                (&firstRow[static_cast<uint32_t>(height - 1U) * width] == lastRow))
+            {
+                contiguous = firstRow;
+            }
+        }
+
+        return contiguous;
+    }
+
+    /**
+     * Fill a span of contiguous pixels with a color. Only the part between
+     * the first and the last pixel, which differ from the color, is written.
+     *
+     * @param[in] dst       Address of the first pixel
+     * @param[in] length    Number of pixels
+     * @param[in] color     Color
+     * @param[out] first    Index of the first changed pixel
+     * @param[out] last     Index of the last changed pixel
+     *
+     * @return If any pixel changed, it will return true otherwise false.
+     */
+    static bool fillSpan(TColor* dst, uint32_t length, const TColor& color, uint32_t& first, uint32_t& last)
+    {
+        bool isChanged = false;
+
+        first = 0U;
+        while ((length > first) && (color == dst[first]))
+        {
+            ++first;
+        }
+
+        if (length > first)
+        {
+            last = length - 1U;
+            while (color == dst[last])
+            {
+                --last;
+            }
+
+            std::fill(&dst[first], &dst[last + 1U], color);
+            isChanged = true;
+        }
+
+        return isChanged;
+    }
+
+    /**
+     * Copy a span of contiguous pixels. Only the part between the first and
+     * the last pixel, which differ, is written.
+     *
+     * @param[in] dst       Address of the first destination pixel
+     * @param[in] src       Address of the first source pixel
+     * @param[in] length    Number of pixels
+     * @param[out] first    Index of the first changed pixel
+     * @param[out] last     Index of the last changed pixel
+     *
+     * @return If any pixel changed, it will return true otherwise false.
+     */
+    static bool copySpan(TColor* dst, const TColor* src, uint32_t length, uint32_t& first, uint32_t& last)
+    {
+        bool isChanged = false;
+
+        first = 0U;
+        while ((length > first) && (src[first] == dst[first]))
+        {
+            ++first;
+        }
+
+        if (length > first)
+        {
+            last = length - 1U;
+            while (src[last] == dst[last])
+            {
+                --last;
+            }
+
+            std::copy(&src[first], &src[last + 1U], &dst[first]);
+            isChanged = true;
+        }
+
+        return isChanged;
+    }
+
+    /**
+     * Copies a rectangle from a source at given coordinates to the
+     * destination at given coordinates. The rectangle must be inside of
+     * source and destination.
+     * Only pixels which differ will be written and the changed part is
+     * added to the changed area.
+     *
+     * @param[in] x                Destination x-coordinate.
+     * @param[in] y                Destination y-coordinate.
+     * @param[in] width            Rectangle width in pixel.
+     * @param[in] height           Rectangle height in pixel.
+     * @param[in] src              Source to copy from.
+     * @param[in] srcX             Source x-coordinate.
+     * @param[in] srcY             Source y-coordinate.
+     * @param[in,out] changedArea  Changed area, which will be extended.
+     */
+    void internalCopyRect(int16_t x, int16_t y, uint16_t width, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, BaseGfxDirtyArea& changedArea)
+    {
+        TColor*       dstAddress = nullptr;
+        const TColor* srcAddress = nullptr;
+
+        /* Complete rows of contiguous framebuffers with the same geometry
+         * are copied as one span.
+         */
+        if ((0 == x) &&
+            (0 == srcX) &&
+            (getWidth() == width) &&
+            (src.getWidth() == width))
+        {
+            dstAddress = getContiguousRows(y, height);
+
+            if (nullptr != dstAddress)
+            {
+                srcAddress = getContiguousRows(src, srcY, height);
+            }
+        }
+
+        if ((nullptr != dstAddress) &&
+            (nullptr != srcAddress))
+        {
+            uint32_t first = 0U;
+            uint32_t last  = 0U;
+
+            if (true == copySpan(dstAddress, srcAddress, static_cast<uint32_t>(width) * height, first, last))
+            {
+                addSpan(changedArea, y, width, first, last);
+            }
+        }
+        /* For better performance choose larger side for the internal
+         * copy operation.
+         */
+        else if (width >= height)
+        {
+            int16_t yIndex;
+
+            for (yIndex = 0; yIndex < height; ++yIndex)
+            {
+                internalCopyX(x, y + yIndex, width, src, srcX, srcY + yIndex, changedArea);
+            }
+        }
+        else
+        {
+            int16_t xIndex;
+
+            for (xIndex = 0; xIndex < width; ++xIndex)
+            {
+                internalCopyY(x + xIndex, y, height, src, srcX + xIndex, srcY, changedArea);
+            }
+        }
+    }
+
     /**
      * Copies pixels along the x-axis from a source at given coordinates to the
      * destination at given coordinates.
+     * Only pixels which differ will be written and the changed part is
+     * added to the changed area.
      *
-     * @param[in] x         Destination x-coordinate.
-     * @param[in] y         Destination y-coordinate.
-     * @param[in] width     Number of pixels which to copy.
-     * @param[in] src       Source to copy from.
-     * @param[in] srcX      Source x-coordinate.
-     * @param[in] srcY      Source y-coordinate.
+     * @param[in] x                Destination x-coordinate.
+     * @param[in] y                Destination y-coordinate.
+     * @param[in] width            Number of pixels which to copy.
+     * @param[in] src              Source to copy from.
+     * @param[in] srcX             Source x-coordinate.
+     * @param[in] srcY             Source y-coordinate.
+     * @param[in,out] changedArea  Changed area, which will be extended.
      */
-    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY)
+    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, BaseGfxDirtyArea& changedArea)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
         TColor*       dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
         const TColor* srcAddress = src.getFrameBufferXAddr(srcX, srcY, width, srcOffset);
 
+        /* Contiguous pixels are copied as one span. */
         if ((nullptr != dstAddress) &&
-            (nullptr != srcAddress))
+            (nullptr != srcAddress) &&
+            (1U == dstOffset) &&
+            (1U == srcOffset))
+        {
+            uint32_t first = 0U;
+            uint32_t last  = 0U;
+
+            if (true == copySpan(dstAddress, srcAddress, width, first, last))
+            {
+                changedArea.add(x + first, y, last - first + 1U, 1U);
+            }
+        }
+        else if ((nullptr != dstAddress) &&
+                 (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t idx   = 0U;
+            uint16_t first = width;
+            uint16_t last  = 0U;
 
             while (width > idx)
             {
-                dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
+                TColor&       dstColor = dstAddress[idx * dstOffset];
+
+                if (srcColor != dstColor)
+                {
+                    dstColor = srcColor;
+
+                    first    = std::min(first, idx);
+                    last     = idx;
+                }
+
                 ++idx;
             }
+
+            if (width > first)
+            {
+                changedArea.add(x + first, y, last - first + 1U, 1U);
+            }
         }
     }
 
@@ -684,6 +2044,8 @@ private:
      * Copies pixels along the x-axis from a source at given coordinates to the
      * destination at given coordinates. If the source pixel color matches the
      * transparent color, it will not be copied.
+     * Only pixels which differ will be written and the changed part is
+     * added to the changed area.
      *
      * @param[in] x                 Destination x-coordinate.
      * @param[in] y                 Destination y-coordinate.
@@ -692,8 +2054,9 @@ private:
      * @param[in] srcX              Source x-coordinate.
      * @param[in] srcY              Source y-coordinate.
      * @param[in] transparentColor  Color which shall be treated as transparent.
+     * @param[in,out] changedArea   Changed area, which will be extended.
      */
-    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor)
+    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor, BaseGfxDirtyArea& changedArea)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -703,34 +2066,49 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t idx   = 0U;
+            uint16_t first = width;
+            uint16_t last  = 0U;
 
             while (width > idx)
             {
-                const TColor* color = &srcAddress[idx * srcOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
+                TColor&       dstColor = dstAddress[idx * dstOffset];
 
-                if (transparentColor != (*color))
+                if ((transparentColor != srcColor) &&
+                    (srcColor != dstColor))
                 {
-                    dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                    dstColor = srcColor;
+
+                    first    = std::min(first, idx);
+                    last     = idx;
                 }
 
                 ++idx;
             }
+
+            if (width > first)
+            {
+                changedArea.add(x + first, y, last - first + 1U, 1U);
+            }
         }
     }
 
     /**
      * Copies pixels along the y-axis from a source at given coordinates to the
      * destination at given coordinates.
+     * Only pixels which differ will be written and the changed part is
+     * added to the changed area.
      *
-     * @param[in] x         Destination x-coordinate.
-     * @param[in] y         Destination y-coordinate.
-     * @param[in] height    Number of pixels which to copy.
-     * @param[in] src       Source to copy from.
-     * @param[in] srcX      Source x-coordinate.
-     * @param[in] srcY      Source y-coordinate.
+     * @param[in] x                Destination x-coordinate.
+     * @param[in] y                Destination y-coordinate.
+     * @param[in] height           Number of pixels which to copy.
+     * @param[in] src              Source to copy from.
+     * @param[in] srcX             Source x-coordinate.
+     * @param[in] srcY             Source y-coordinate.
+     * @param[in,out] changedArea  Changed area, which will be extended.
      */
-    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY)
+    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, BaseGfxDirtyArea& changedArea)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -740,13 +2118,30 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t idx   = 0U;
+            uint16_t first = height;
+            uint16_t last  = 0U;
 
             while (height > idx)
             {
-                dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
+                TColor&       dstColor = dstAddress[idx * dstOffset];
+
+                if (srcColor != dstColor)
+                {
+                    dstColor = srcColor;
+
+                    first    = std::min(first, idx);
+                    last     = idx;
+                }
+
                 ++idx;
             }
+
+            if (height > first)
+            {
+                changedArea.add(x, y + first, 1U, last - first + 1U);
+            }
         }
     }
 
@@ -754,6 +2149,8 @@ private:
      * Copies pixels along the y-axis from a source at given coordinates to the
      * destination at given coordinates. If the source pixel color matches the
      * transparent color, it will not be copied.
+     * Only pixels which differ will be written and the changed part is
+     * added to the changed area.
      *
      * @param[in] x                 Destination x-coordinate.
      * @param[in] y                 Destination y-coordinate.
@@ -762,8 +2159,9 @@ private:
      * @param[in] srcX              Source x-coordinate.
      * @param[in] srcY              Source y-coordinate.
      * @param[in] transparentColor  Color which shall be treated as transparent.
+     * @param[in,out] changedArea   Changed area, which will be extended.
      */
-    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor)
+    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor, BaseGfxDirtyArea& changedArea)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -773,19 +2171,31 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t idx   = 0U;
+            uint16_t first = height;
+            uint16_t last  = 0U;
 
             while (height > idx)
             {
-                const TColor* color = &srcAddress[idx * srcOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
+                TColor&       dstColor = dstAddress[idx * dstOffset];
 
-                if (transparentColor != (*color))
+                if ((transparentColor != srcColor) &&
+                    (srcColor != dstColor))
                 {
-                    dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                    dstColor = srcColor;
+
+                    first    = std::min(first, idx);
+                    last     = idx;
                 }
 
                 ++idx;
             }
+
+            if (height > first)
+            {
+                changedArea.add(x, y + first, 1U, last - first + 1U);
+            }
         }
     }
 };
@@ -80,16 +80,108 @@ public:
     {
     }
 
+    /**
+     * Mark a rectangle as changed.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) override
+    {
+        m_dirtyArea.add(x, y, width, height);
+    }
+
+    /**
+     * Mark the whole bitmap as changed.
+     */
+    void markAllDirty()
+    {
+        m_dirtyArea.add(0, 0, this->getWidth(), this->getHeight());
+    }
+
+    /**
+     * Get the area, which contains all pixels changed since the dirty area
+     * was cleared the last time.
+     *
+     * @return Dirty area
+     */
+    const BaseGfxDirtyArea& getDirtyArea() const
+    {
+        return m_dirtyArea;
+    }
+
+    /**
+     * Clear the dirty area, e.g. after the changed pixels were processed.
+     */
+    void clearDirtyArea()
+    {
+        m_dirtyArea.clear();
+    }
+
+    /**
+     * Get the address inside the alpha channel at certain coordinates.
+     * The alpha values of a row are contiguous.
+     *
+     * @param[in] x         x-coordinate
+     * @param[in] y         y-coordinate
+     * @param[in] length    Requested number of alpha values on x-axis.
+     *
+     * @return Address in the alpha channel or nullptr, if the bitmap has no alpha channel or the request is out of bounds.
+     */
+    virtual const uint8_t* getAlphaXAddr(int16_t x, int16_t y, uint16_t length) const
+    {
+        (void)x;
+        (void)y;
+        (void)length;
+
+        return nullptr;
+    }
+
 protected:
 
     /**
      * Constructs a bitmap.
      */
-    BaseGfxBitmap()
+    BaseGfxBitmap() :
+        m_dirtyArea()
+    {
+    }
+
+    /**
+     * Constructs a bitmap by copy.
+     * The dirty area is not copied, because it belongs to the pixels of
+     * this bitmap.
+     *
+     * @param[in] bitmap    Source bitmap, which to copy.
+     */
+    BaseGfxBitmap(const BaseGfxBitmap& bitmap) :
+        BaseGfx<TColor>(),
+        m_dirtyArea()
     {
+        (void)bitmap;
+    }
+
+    /**
+     * Assigns a bitmap.
+     * The dirty area is not assigned, because it belongs to the pixels of
+     * this bitmap.
+     *
+     * @param[in] bitmap    Source bitmap
+     *
+     * @return Bitmap
+     */
+    BaseGfxBitmap& operator=(const BaseGfxBitmap& bitmap)
+    {
+        (void)bitmap;
+
+        return *this;
     }
 
 private:
+
+    BaseGfxDirtyArea m_dirtyArea; /**< Area with changed pixels */
 };
 
 /**
@@ -110,6 +202,7 @@ public:
     BaseGfxStaticBitmap() :
         BaseGfxBitmap<TColor>()
     {
+        this->markAllDirty();
     }
 
     /**
@@ -155,6 +248,8 @@ public:
 
                     ++idx;
                 }
+
+                this->markAllDirty();
             }
         }
 
@@ -166,7 +261,7 @@ public:
      *
      * @return Width in pixels
      */
-    uint16_t getWidth() const override
+    uint16_t getWidth() const final
     {
         return width;
     }
@@ -176,7 +271,7 @@ public:
      *
      * @return Height in pixels
      */
-    uint16_t getHeight() const override
+    uint16_t getHeight() const final
     {
         return height;
     }
@@ -190,7 +285,7 @@ public:
      *
      * @return Color
      */
-    TColor& getColor(int16_t x, int16_t y) override
+    TColor& getColor(int16_t x, int16_t y) final
     {
         static TColor trash;
         TColor*       pixel = &trash;
@@ -214,7 +309,7 @@ public:
      *
      * @return Color
      */
-    const TColor& getColor(int16_t x, int16_t y) const override
+    const TColor& getColor(int16_t x, int16_t y) const final
     {
         static TColor trash;
         const TColor* pixel = &trash;
@@ -237,14 +332,20 @@ public:
      * @param[in] y     y-coordinate
      * @param[in] color Color
      */
-    void drawPixel(int16_t x, int16_t y, const TColor& color) override
+    void drawPixel(int16_t x, int16_t y, const TColor& color) final
     {
         if ((0 <= x) &&
             (0 <= y) &&
             (width > x) &&
             (height > y))
         {
-            m_pixels[pixelMap(x, y)] = color;
+            TColor& pixel = m_pixels[pixelMap(x, y)];
+
+            if (color != pixel)
+            {
+                pixel = color;
+                this->markDirty(x, y, 1U, 1U);
+            }
         }
     }
 
@@ -262,7 +363,7 @@ public:
      *
      * @return Address in the framebuffer or nullptr.
      */
-    TColor* getFrameBufferXAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) override
+    TColor* getFrameBufferXAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) final
     {
         TColor* addr = nullptr;
 
@@ -292,7 +393,7 @@ public:
      *
      * @return Address in the framebuffer or nullptr.
      */
-    const TColor* getFrameBufferXAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) const override
+    const TColor* getFrameBufferXAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) const final
     {
         const TColor* addr = nullptr;
 
@@ -322,7 +423,7 @@ public:
      *
      * @return Address in the framebuffer or nullptr.
      */
-    TColor* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) override
+    TColor* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) final
     {
         TColor* addr = nullptr;
 
@@ -352,7 +453,7 @@ public:
      *
      * @return Address in the framebuffer or nullptr.
      */
-    const TColor* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) const override
+    const TColor* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) const final
     {
         const TColor* addr = nullptr;
 
@@ -429,6 +530,10 @@ public:
             m_width  = 0U;
             m_height = 0U;
         }
+        else
+        {
+            this->markAllDirty();
+        }
     }
 
     /**
@@ -447,6 +552,10 @@ public:
             m_width  = 0U;
             m_height = 0U;
         }
+        else
+        {
+            this->markAllDirty();
+        }
     }
 
     /**
@@ -507,6 +616,8 @@ public:
 
                         ++idx;
                     }
+
+                    this->markAllDirty();
                 }
             }
         }
@@ -536,6 +647,8 @@ public:
                 m_width      = width;
                 m_height     = height;
 
+                this->markAllDirty();
+
                 isSuccessful = true;
             }
         }
@@ -551,6 +664,8 @@ public:
         releasePixels(m_pixels);
         m_width  = 0U;
         m_height = 0U;
+
+        this->clearDirtyArea();
     }
 
     /**
@@ -639,7 +754,13 @@ public:
             (m_width > x) &&
             (m_height > y))
         {
-            m_pixels[pixelMap(x, y)] = color;
+            TColor& pixel = m_pixels[pixelMap(x, y)];
+
+            if (color != pixel)
+            {
+                pixel = color;
+                this->markDirty(x, y, 1U, 1U);
+            }
         }
     }
 
@@ -837,6 +958,195 @@ private:
     }
 };
 
+/**
+ * This class provides a dynamic allocated bitmap with an additional
+ * alpha channel. Every pixel has an alpha value, which is considered by
+ * BaseGfx::drawBitmap() with a blend mode.
+ *
+ * @tparam TColor           The color representation.
+ * @tparam TAllocator       The allocator type for the pixels.
+ * @tparam TAlphaAllocator  The allocator type for the alpha values.
+ */
+template < typename TColor, typename TAllocator, typename TAlphaAllocator >
+class BaseGfxAlphaBitmap : public BaseGfxDynamicBitmap<TColor, TAllocator>
+{
+public:
+
+    /**
+     * Constructs the bitmap, but without internal buffer.
+     */
+    BaseGfxAlphaBitmap() :
+        BaseGfxDynamicBitmap<TColor, TAllocator>(),
+        m_alpha(nullptr)
+    {
+    }
+
+    /**
+     * Destroys the bitmap.
+     */
+    virtual ~BaseGfxAlphaBitmap()
+    {
+        releaseAlpha();
+    }
+
+    /**
+     * Create internal pixel buffer and alpha channel.
+     * All pixels are opaque after creation.
+     * If a pixel buffer already exists, it will fail.
+     *
+     * @param[in] width     Pixel bitmap width in pixels
+     * @param[in] height    Pixel bitmap height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height)
+    {
+        bool isSuccessful = BaseGfxDynamicBitmap<TColor, TAllocator>::create(width, height);
+
+        if (true == isSuccessful)
+        {
+            TAlphaAllocator allocator;
+
+            m_alpha = allocator.allocateArray(static_cast<size_t>(width) * height);
+
+            if (nullptr == m_alpha)
+            {
+                BaseGfxDynamicBitmap<TColor, TAllocator>::release();
+                isSuccessful = false;
+            }
+            else
+            {
+                fillAlpha(UINT8_MAX);
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Release the internal pixel buffer and alpha channel.
+     */
+    void release()
+    {
+        releaseAlpha();
+        BaseGfxDynamicBitmap<TColor, TAllocator>::release();
+    }
+
+    /**
+     * Get alpha value at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Alpha value [0; 255] - 0: transparent / 255: opaque. Out of bounds it is 0.
+     */
+    uint8_t getAlpha(int16_t x, int16_t y) const
+    {
+        uint8_t        alpha   = 0U;
+        const uint8_t* address = getAlphaXAddr(x, y, 1U);
+
+        if (nullptr != address)
+        {
+            alpha = *address;
+        }
+
+        return alpha;
+    }
+
+    /**
+     * Set alpha value at given position.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] alpha Alpha value [0; 255] - 0: transparent / 255: opaque.
+     */
+    void setAlpha(int16_t x, int16_t y, uint8_t alpha)
+    {
+        uint8_t* address = const_cast<uint8_t*>(getAlphaXAddr(x, y, 1U));
+
+        if ((nullptr != address) &&
+            (alpha != *address))
+        {
+            *address = alpha;
+            this->markDirty(x, y, 1U, 1U);
+        }
+    }
+
+    /**
+     * Set the alpha value of all pixels.
+     *
+     * @param[in] alpha Alpha value [0; 255] - 0: transparent / 255: opaque.
+     */
+    void fillAlpha(uint8_t alpha)
+    {
+        if (nullptr != m_alpha)
+        {
+            std::fill(m_alpha, m_alpha + (static_cast<size_t>(this->getWidth()) * this->getHeight()), alpha);
+            this->markAllDirty();
+        }
+    }
+
+    /**
+     * Get the address inside the alpha channel at certain coordinates.
+     * The alpha values of a row are contiguous.
+     *
+     * @param[in] x         x-coordinate
+     * @param[in] y         y-coordinate
+     * @param[in] length    Requested number of alpha values on x-axis.
+     *
+     * @return Address in the alpha channel or nullptr, if the request is out of bounds.
+     */
+    const uint8_t* getAlphaXAddr(int16_t x, int16_t y, uint16_t length) const override
+    {
+        const uint8_t* addr = nullptr;
+
+        if ((nullptr != m_alpha) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (this->getWidth() >= (x + length)) &&
+            (this->getHeight() > y))
+        {
+            addr = &m_alpha[x + (y * static_cast<size_t>(this->getWidth()))];
+        }
+
+        return addr;
+    }
+
+private:
+
+    uint8_t* m_alpha; /**< Alpha channel, one value per pixel */
+
+    /**
+     * Release alpha channel if allocated.
+     */
+    void releaseAlpha()
+    {
+        if (nullptr != m_alpha)
+        {
+            TAlphaAllocator allocator;
+
+            allocator.deallocateArray(m_alpha);
+            m_alpha = nullptr;
+        }
+    }
+
+    /**
+     * Copy constructor is not allowed.
+     *
+     * @param[in] bitmap    Source bitmap
+     */
+    BaseGfxAlphaBitmap(const BaseGfxAlphaBitmap& bitmap)            = delete;
+
+    /**
+     * Assignment operator is not allowed.
+     *
+     * @param[in] bitmap    Source bitmap
+     *
+     * @return Bitmap
+     */
+    BaseGfxAlphaBitmap& operator=(const BaseGfxAlphaBitmap& bitmap) = delete;
+};
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
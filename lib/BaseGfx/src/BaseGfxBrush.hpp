@@ -45,6 +45,7 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
+#include <algorithm>
 
 /******************************************************************************
  * Macros
@@ -81,6 +82,48 @@ public:
      */
     virtual TColor getColor(int16_t x, int16_t y) const = 0;
 
+    /**
+     * Get the colors of a horizontal span, starting at the given position.
+     * This avoids a call per pixel, e.g. for drawing a glyph row or a line.
+     *
+     * @param[in]  x        x-coordinate of the first pixel
+     * @param[in]  y        y-coordinate
+     * @param[in]  length   Number of pixels
+     * @param[out] colors   Colors of the span, at least length elements.
+     */
+    virtual void getColors(int16_t x, int16_t y, uint16_t length, TColor* colors) const
+    {
+        uint16_t idx;
+
+        for (idx = 0U; idx < length; ++idx)
+        {
+            colors[idx] = getColor(x + idx, y);
+        }
+    }
+
+    /**
+     * Is the brush color independent of the position?
+     * If yes, a span can be filled with a single color.
+     *
+     * @return If the color is the same everywhere, it will return true otherwise false.
+     */
+    virtual bool isSolid() const
+    {
+        return false;
+    }
+
+    /**
+     * Is the brush color independent of the x-coordinate?
+     * If yes, everything drawn with the brush can be moved horizontally
+     * without changing its colors.
+     *
+     * @return If the color is the same in a whole row, it will return true otherwise false.
+     */
+    virtual bool isRowSolid() const
+    {
+        return isSolid();
+    }
+
     /**
      * Get brush intensity.
      *
@@ -103,6 +146,29 @@ protected:
     BaseGfxBrush()
     {
     }
+
+    /**
+     * Get a copy of the color, dimmed by the brush intensity.
+     * The color itself is not changed, because depending on the color type
+     * the intensity may be applied destructive to the base colors.
+     *
+     * @param[in] color     Color
+     * @param[in] intensity Brush intensity [0; 255] - 0: min. bright / 255: max. bright.
+     *
+     * @return Dimmed color
+     */
+    static TColor dim(const TColor& color, uint8_t intensity)
+    {
+        TColor dimmedColor = color;
+
+        /* At max. intensity the color keeps its own intensity. */
+        if (TColor::MAX_BRIGHT != intensity)
+        {
+            dimmedColor.setIntensity(intensity);
+        }
+
+        return dimmedColor;
+    }
 };
 
 /**
@@ -120,7 +186,9 @@ public:
      */
     BaseGfxSolidBrush() :
         BaseGfxBrush<TColor>(),
-        m_color()
+        m_color(),
+        m_intensity(TColor::MAX_BRIGHT),
+        m_dimmedColor()
     {
     }
 
@@ -131,7 +199,9 @@ public:
      */
     BaseGfxSolidBrush(const TColor& color) :
         BaseGfxBrush<TColor>(),
-        m_color(color)
+        m_color(color),
+        m_intensity(TColor::MAX_BRIGHT),
+        m_dimmedColor(color)
     {
     }
 
@@ -154,7 +224,32 @@ public:
     {
         (void)x;
         (void)y;
-        return m_color;
+        return m_dimmedColor;
+    }
+
+    /**
+     * Get the colors of a horizontal span, starting at the given position.
+     *
+     * @param[in]  x        x-coordinate of the first pixel
+     * @param[in]  y        y-coordinate
+     * @param[in]  length   Number of pixels
+     * @param[out] colors   Colors of the span, at least length elements.
+     */
+    void getColors(int16_t x, int16_t y, uint16_t length, TColor* colors) const override
+    {
+        (void)x;
+        (void)y;
+        std::fill(colors, colors + length, m_dimmedColor);
+    }
+
+    /**
+     * Is the brush color independent of the position?
+     *
+     * @return A solid brush has the same color everywhere, therefore it returns always true.
+     */
+    bool isSolid() const override
+    {
+        return true;
     }
 
     /**
@@ -164,17 +259,19 @@ public:
      */
     uint8_t getIntensity() const override
     {
-        return m_color.getIntensity();
+        return m_intensity;
     }
 
     /**
      * Set brush intensity.
+     * The color of the brush is kept, only the drawn color is dimmed.
      *
      * @param[in] intensity Brush intensity [0; 255] - 0: min. bright / 255: max. bright.
      */
     void setIntensity(uint8_t intensity) override
     {
-        m_color.setIntensity(intensity);
+        m_intensity   = intensity;
+        m_dimmedColor = this->dim(m_color, m_intensity);
     }
 
     /**
@@ -194,12 +291,15 @@ public:
      */
     void setColor(const TColor& color)
     {
-        m_color = color;
+        m_color       = color;
+        m_dimmedColor = this->dim(m_color, m_intensity);
     }
 
 private:
 
-    TColor m_color; /**< Color of the brush. */
+    TColor  m_color;       /**< Color of the brush. */
+    uint8_t m_intensity;   /**< Brush intensity [0; 255] - 0: min. bright / 255: max. bright. */
+    TColor  m_dimmedColor; /**< Color of the brush with the brush intensity applied. */
 };
 
 /**
@@ -220,6 +320,9 @@ public:
         m_color(),
         m_startColor(),
         m_endColor(),
+        m_intensity(TColor::MAX_BRIGHT),
+        m_dimmedStartColor(),
+        m_dimmedEndColor(),
         m_offset(0),
         m_gradientLength(32U),    /* Default gradient length in pixels. */
         m_verticalGradient(false) /* Default horizontal gradient. */
@@ -240,6 +343,9 @@ public:
         m_color(),
         m_startColor(startColor),
         m_endColor(endColor),
+        m_intensity(TColor::MAX_BRIGHT),
+        m_dimmedStartColor(startColor),
+        m_dimmedEndColor(endColor),
         m_offset(offset),
         m_gradientLength(gradientLength),
         m_verticalGradient(verticalGradient)
@@ -263,30 +369,51 @@ public:
      */
     TColor getColor(int16_t x, int16_t y) const override
     {
-        uint8_t ratio = 0U;
+        int32_t pos = (false == m_verticalGradient) ? x : y;
 
-        /* Simple linear interpolation between start and end colors. */
-        if (0U < m_gradientLength)
+        return blendColors(m_dimmedStartColor, m_dimmedEndColor, getRatio(pos));
+    }
+
+    /**
+     * Get the colors of a horizontal span, starting at the given position.
+     * A color is only interpolated again, if the gradient ratio changes.
+     *
+     * @param[in]  x        x-coordinate of the first pixel
+     * @param[in]  y        y-coordinate
+     * @param[in]  length   Number of pixels
+     * @param[out] colors   Colors of the span, at least length elements.
+     */
+    void getColors(int16_t x, int16_t y, uint16_t length, TColor* colors) const override
+    {
+        /* A vertical gradient has the same color in the whole row. */
+        if (true == m_verticalGradient)
+        {
+            std::fill(colors, colors + length, getColor(x, y));
+        }
+        else if (0U < length)
         {
-            int32_t pos = (false == m_verticalGradient) ? x : y;
+            uint8_t  ratio = getRatio(x);
+            TColor   color = blendColors(m_dimmedStartColor, m_dimmedEndColor, ratio);
+            uint16_t idx;
 
-            if (m_offset >= pos)
-            {
-                pos = 0;
-            }
-            else if (m_gradientLength < pos)
+            for (idx = 0U; idx < length; ++idx)
             {
-                pos = m_gradientLength;
-            }
-            else
-            {
-                ;
-            }
+                uint8_t nextRatio = getRatio(static_cast<int32_t>(x) + idx);
 
-            ratio = static_cast<uint8_t>((pos * 255) / m_gradientLength);
-        }
+                if (ratio != nextRatio)
+                {
+                    ratio = nextRatio;
+                    color = blendColors(m_dimmedStartColor, m_dimmedEndColor, ratio);
+                }
 
-        return blendColors(m_startColor, m_endColor, ratio);
+                colors[idx] = color;
+            }
+        }
+        else
+        {
+            /* Nothing to do. */
+            ;
+        }
     }
 
     /**
@@ -296,18 +423,20 @@ public:
      */
     uint8_t getIntensity() const override
     {
-        return m_startColor.getIntensity();
+        return m_intensity;
     }
 
     /**
      * Set brush intensity.
+     * The gradient colors are kept, only the drawn colors are dimmed.
      *
      * @param[in] intensity Brush intensity [0; 255] - 0: min. bright / 255: max. bright.
      */
     void setIntensity(uint8_t intensity) override
     {
-        m_startColor.setIntensity(intensity);
-        m_endColor.setIntensity(intensity);
+        m_intensity        = intensity;
+        m_dimmedStartColor = this->dim(m_startColor, m_intensity);
+        m_dimmedEndColor   = this->dim(m_endColor, m_intensity);
     }
 
     /**
@@ -337,7 +466,8 @@ public:
      */
     void setStartColor(const TColor& color)
     {
-        m_startColor = color;
+        m_startColor       = color;
+        m_dimmedStartColor = this->dim(m_startColor, m_intensity);
     }
 
     /**
@@ -347,7 +477,8 @@ public:
      */
     void setEndColor(const TColor& color)
     {
-        m_endColor = color;
+        m_endColor       = color;
+        m_dimmedEndColor = this->dim(m_endColor, m_intensity);
     }
 
     /**
@@ -390,6 +521,16 @@ public:
         m_gradientLength = length;
     }
 
+    /**
+     * Is the brush color independent of the x-coordinate?
+     *
+     * @return Only a vertical gradient has the same color in a whole row.
+     */
+    bool isRowSolid() const override
+    {
+        return m_verticalGradient;
+    }
+
     /**
      * Get the direction of the gradient.
      *
@@ -415,10 +556,46 @@ private:
     TColor   m_color;            /**< Color of the brush. */
     TColor   m_startColor;       /**< Start color of the gradient. */
     TColor   m_endColor;         /**< End color of the gradient. */
+    uint8_t  m_intensity;        /**< Brush intensity [0; 255] - 0: min. bright / 255: max. bright. */
+    TColor   m_dimmedStartColor; /**< Start color with the brush intensity applied. */
+    TColor   m_dimmedEndColor;   /**< End color with the brush intensity applied. */
     int16_t  m_offset;           /**< Offset in pixels of the gradient start color. */
     uint16_t m_gradientLength;   /**< Length of the gradient in pixels. */
     bool     m_verticalGradient; /**< Flag for vertical gradient. */
 
+    /**
+     * Get the gradient ratio at the given position along the gradient direction.
+     *
+     * @param[in] pos   x- or y-coordinate, depending on the gradient direction.
+     *
+     * @return Ratio for blending [0; 255]
+     */
+    uint8_t getRatio(int32_t pos) const
+    {
+        uint8_t ratio = 0U;
+
+        /* Simple linear interpolation between start and end colors. */
+        if (0U < m_gradientLength)
+        {
+            if (m_offset >= pos)
+            {
+                pos = 0;
+            }
+            else if (m_gradientLength < pos)
+            {
+                pos = m_gradientLength;
+            }
+            else
+            {
+                ;
+            }
+
+            ratio = static_cast<uint8_t>((pos * 255) / m_gradientLength);
+        }
+
+        return ratio;
+    }
+
     /**
      * Blend two colors based on a ratio (integer version).
      *
@@ -310,6 +310,22 @@ public:
         }
     }
 
+    /**
+     * Mark a rectangle as changed. It is forwarded to the parent.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        if (nullptr != m_parentGfx)
+        {
+            m_parentGfx->markDirty(x + m_offsX, y + m_offsY, width, height);
+        }
+    }
+
     /**
      * Get the address inside the framebuffer at certain coordinates.
      * If the requested length is not available, it will return nullptr.
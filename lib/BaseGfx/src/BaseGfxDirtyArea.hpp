@@ -0,0 +1,239 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   BaseGfxDirtyArea.hpp
+ * @brief  Base graphics dirty area
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef BASE_GFX_DIRTY_AREA_HPP
+#define BASE_GFX_DIRTY_AREA_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <algorithm>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The dirty area is the bounding rectangle of all pixels, which were changed
+ * since it was cleared the last time. It is used to process only the changed
+ * part of a framebuffer, e.g. for a physical display update.
+ */
+class BaseGfxDirtyArea
+{
+public:
+
+    /**
+     * Constructs a empty dirty area.
+     */
+    BaseGfxDirtyArea() :
+        m_x(0),
+        m_y(0),
+        m_width(0U),
+        m_height(0U)
+    {
+    }
+
+    /**
+     * Constructs a dirty area by copy.
+     *
+     * @param[in] area  Source dirty area.
+     */
+    BaseGfxDirtyArea(const BaseGfxDirtyArea& area) :
+        m_x(area.m_x),
+        m_y(area.m_y),
+        m_width(area.m_width),
+        m_height(area.m_height)
+    {
+    }
+
+    /**
+     * Destroys the dirty area.
+     */
+    ~BaseGfxDirtyArea()
+    {
+    }
+
+    /**
+     * Assigns a dirty area.
+     *
+     * @param[in] area  Source dirty area.
+     *
+     * @return Dirty area
+     */
+    BaseGfxDirtyArea& operator=(const BaseGfxDirtyArea& area)
+    {
+        if (&area != this)
+        {
+            m_x      = area.m_x;
+            m_y      = area.m_y;
+            m_width  = area.m_width;
+            m_height = area.m_height;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Extend the dirty area, so that it contains the given rectangle too.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void add(int16_t x, int16_t y, uint16_t width, uint16_t height)
+    {
+        /* Anything to add? */
+        if ((0U < width) &&
+            (0U < height))
+        {
+            if (true == isEmpty())
+            {
+                m_x      = x;
+                m_y      = y;
+                m_width  = width;
+                m_height = height;
+            }
+            else
+            {
+                int32_t x1 = std::min(static_cast<int32_t>(m_x), static_cast<int32_t>(x));
+                int32_t y1 = std::min(static_cast<int32_t>(m_y), static_cast<int32_t>(y));
+                int32_t x2 = std::max(static_cast<int32_t>(m_x) + m_width, static_cast<int32_t>(x) + width);
+                int32_t y2 = std::max(static_cast<int32_t>(m_y) + m_height, static_cast<int32_t>(y) + height);
+
+                m_x        = static_cast<int16_t>(x1);
+                m_y        = static_cast<int16_t>(y1);
+                m_width    = static_cast<uint16_t>(x2 - x1);
+                m_height   = static_cast<uint16_t>(y2 - y1);
+            }
+        }
+    }
+
+    /**
+     * Extend the dirty area, so that it contains the given dirty area too.
+     *
+     * @param[in] area  Dirty area which to add.
+     */
+    void add(const BaseGfxDirtyArea& area)
+    {
+        add(area.m_x, area.m_y, area.m_width, area.m_height);
+    }
+
+    /**
+     * Clear the dirty area, which means nothing is changed.
+     */
+    void clear()
+    {
+        m_x      = 0;
+        m_y      = 0;
+        m_width  = 0U;
+        m_height = 0U;
+    }
+
+    /**
+     * Is the dirty area empty, which means nothing changed?
+     *
+     * @return If empty, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (0U == m_width) || (0U == m_height);
+    }
+
+    /**
+     * Get x-coordinate of the upper left point.
+     *
+     * @return x-coordinate
+     */
+    int16_t getX() const
+    {
+        return m_x;
+    }
+
+    /**
+     * Get y-coordinate of the upper left point.
+     *
+     * @return y-coordinate
+     */
+    int16_t getY() const
+    {
+        return m_y;
+    }
+
+    /**
+     * Get width in pixel.
+     *
+     * @return Width in pixel
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get height in pixel.
+     *
+     * @return Height in pixel
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+private:
+
+    int16_t  m_x;      /**< x-coordinate of upper left point */
+    int16_t  m_y;      /**< y-coordinate of upper left point */
+    uint16_t m_width;  /**< Width in pixel */
+    uint16_t m_height; /**< Height in pixel */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* BASE_GFX_DIRTY_AREA_HPP */
+
+/** @} */
@@ -48,6 +48,7 @@
 #include "BaseGfx.hpp"
 #include "BaseFont.hpp"
 #include "BaseGfxBrush.hpp"
+#include "BaseGfxUtf8.hpp"
 
 /******************************************************************************
  * Macros
@@ -296,7 +297,7 @@ public:
      * responsibility of the caller to consider this.
      *
      * @param[in]   maxLineWidth    Max. line width in pixel, necessary to consider text wrap around.
-     * @param[in]   text            Text
+     * @param[in]   text            Text, UTF-8 encoded
      * @param[out]  boxWidth        Bounding box width in pixel
      * @param[out]  boxHeight       Bounding box height in pixel
      *
@@ -319,8 +320,10 @@ public:
             {
                 uint16_t charWidth  = 0U;
                 uint16_t charHeight = 0U;
+                uint32_t codePoint  = 0U;
+                uint8_t  length     = BaseGfxUtf8::decode(&text[idx], codePoint);
 
-                if ('\n' == text[idx])
+                if ('\n' == codePoint)
                 {
                     if (boxWidth < lineWidth)
                     {
@@ -330,7 +333,7 @@ public:
                     lineWidth  = 0U;
                     boxHeight += m_font.getHeight();
                 }
-                else if (true == m_font.getCharBoundingBox(text[idx], charWidth, charHeight))
+                else if (true == m_font.getCharBoundingBox(codePoint, charWidth, charHeight))
                 {
                     if (0U == idx)
                     {
@@ -361,7 +364,7 @@ public:
                     ;
                 }
 
-                ++idx;
+                idx += length;
             }
 
             if (boxWidth < lineWidth)
@@ -383,9 +386,9 @@ public:
      * A newline will place the cursor on the begin of the next line.
      *
      * @param[in] gfx           Graphics interface
-     * @param[in] singleChar    Single character which to draw
+     * @param[in] codePoint     Unicode code point of the character which to draw
      */
-    void drawChar(BaseGfx<TColor>& gfx, char singleChar)
+    void drawChar(BaseGfx<TColor>& gfx, uint32_t codePoint)
     {
         if (nullptr != m_font.getGfxFont())
         {
@@ -397,7 +400,7 @@ public:
                 uint16_t charBoxWidth  = 0U;
                 uint16_t charBoxHeight = 0U;
 
-                if (true == m_font.getCharBoundingBox(singleChar, charBoxWidth, charBoxHeight))
+                if (true == m_font.getCharBoundingBox(codePoint, charBoxWidth, charBoxHeight))
                 {
                     if (gfx.getWidth() < (m_cursorX + charBoxWidth))
                     {
@@ -407,7 +410,7 @@ public:
                 }
             }
 
-            m_font.drawChar(gfx, m_cursorX, m_cursorY, singleChar, *m_brush);
+            m_font.drawChar(gfx, m_cursorX, m_cursorY, codePoint, *m_brush);
         }
     }
 
@@ -415,7 +418,7 @@ public:
      * Draw a text at given cursor position.
      *
      * @param[in] gfx   Graphics interface
-     * @param[in] text  Text which to draw
+     * @param[in] text  Text which to draw, UTF-8 encoded
      */
     void drawText(BaseGfx<TColor>& gfx, const char* text)
     {
@@ -428,8 +431,10 @@ public:
 
         while ('\0' != text[idx])
         {
-            drawChar(gfx, text[idx]);
-            ++idx;
+            uint32_t codePoint = 0U;
+
+            idx += BaseGfxUtf8::decode(&text[idx], codePoint);
+            drawChar(gfx, codePoint);
         }
     }
 
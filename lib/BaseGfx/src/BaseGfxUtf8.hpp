@@ -0,0 +1,130 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   BaseGfxUtf8.hpp
+ * @brief  Base graphics UTF-8 decoder
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef BASE_GFX_UTF8_HPP
+#define BASE_GFX_UTF8_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * UTF-8 utility functions.
+ */
+namespace BaseGfxUtf8
+{
+
+/** Unicode replacement character, used for invalid UTF-8 sequences. */
+static const uint32_t REPLACEMENT_CHARACTER = 0xFFFDU;
+
+/**
+ * Decode the next character of a UTF-8 encoded text.
+ * An invalid or truncated sequence results in the replacement character.
+ *
+ * @param[in]   text        Text, which is not empty and terminated.
+ * @param[out]  codePoint   Unicode code point of the character
+ *
+ * @return Number of decoded bytes.
+ */
+static inline uint8_t decode(const char* text, uint32_t& codePoint)
+{
+    const uint8_t* bytes       = reinterpret_cast<const uint8_t*>(text);
+    uint8_t        length      = 1U;
+    uint8_t        followBytes = 0U;
+
+    if (0x80U > bytes[0U])
+    {
+        codePoint = bytes[0U];
+    }
+    else if (0xC0U == (bytes[0U] & 0xE0U))
+    {
+        codePoint   = bytes[0U] & 0x1FU;
+        followBytes = 1U;
+    }
+    else if (0xE0U == (bytes[0U] & 0xF0U))
+    {
+        codePoint   = bytes[0U] & 0x0FU;
+        followBytes = 2U;
+    }
+    else if (0xF0U == (bytes[0U] & 0xF8U))
+    {
+        codePoint   = bytes[0U] & 0x07U;
+        followBytes = 3U;
+    }
+    else
+    {
+        codePoint = REPLACEMENT_CHARACTER;
+    }
+
+    /* The string termination is never a continuation byte. */
+    while ((0U < followBytes) &&
+           (0x80U == (bytes[length] & 0xC0U)))
+    {
+        codePoint = (codePoint << 6U) | (bytes[length] & 0x3FU);
+        ++length;
+        --followBytes;
+    }
+
+    if (0U < followBytes)
+    {
+        codePoint = REPLACEMENT_CHARACTER;
+    }
+
+    return length;
+}
+
+} /* namespace BaseGfxUtf8 */
+
+#endif /* BASE_GFX_UTF8_HPP */
+
+/** @} */
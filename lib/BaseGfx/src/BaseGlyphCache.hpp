@@ -0,0 +1,184 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   BaseGlyphCache.hpp
+ * @brief  Base glyph cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef BASE_GLYPH_CACHE_HPP
+#define BASE_GLYPH_CACHE_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "gfxfont.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A run of consecutive set pixels in a glyph row.
+ * The coordinates are relative to the upper left corner of the glyph bitmap.
+ */
+typedef struct
+{
+    uint8_t x;      /**< x-coordinate of the first pixel */
+    uint8_t y;      /**< y-coordinate (glyph row) */
+    uint8_t length; /**< Number of pixels */
+
+} BaseGlyphRun;
+
+/**
+ * Interface for a glyph cache, which provides the pre-rasterized glyphs of
+ * a font as runs of set pixels. It is color agnostic, therefore it can be
+ * shared between all fonts.
+ */
+class BaseGlyphCache
+{
+public:
+
+    /**
+     * Destroys the glyph cache.
+     */
+    virtual ~BaseGlyphCache()
+    {
+    }
+
+    /**
+     * Get the runs of a glyph.
+     * If the glyph is not cached yet, it will be rasterized and cached.
+     *
+     * The runs stay valid until the next call.
+     *
+     * @param[in]  font     Font, which contains the glyph.
+     * @param[in]  glyph    Glyph of the font.
+     * @param[out] runs     Runs of the glyph, sorted by row.
+     * @param[out] runCount Number of runs.
+     *
+     * @return If the runs are available, it will return true otherwise false.
+     */
+    virtual bool getRuns(const GFXfont& font, const GFXglyph& glyph, const BaseGlyphRun*& runs, uint16_t& runCount) = 0;
+
+    /**
+     * Decodes the glyph bitmap and calls the handler for every run of
+     * consecutive set pixels. The run coordinates are relative to the
+     * glyph origin.
+     *
+     * @tparam TRunHandler  Handler type with signature void(int16_t x, int16_t y, uint16_t length).
+     *
+     * @param[in] font      Font, which contains the glyph.
+     * @param[in] glyph     Glyph of the font.
+     * @param[in] handler   Handler, which is called per run.
+     */
+    template < typename TRunHandler >
+    static void decodeRuns(const GFXfont& font, const GFXglyph& glyph, TRunHandler handler)
+    {
+        int16_t  x             = 0;
+        int16_t  y             = 0;
+        uint16_t bitmapOffset  = glyph.bitmapOffset;
+        uint8_t  bitmapRowBits = 0U;
+        uint8_t  bitCnt        = 0U;
+
+        for (y = 0; y < glyph.height; ++y)
+        {
+            int16_t  runStart  = 0;
+            uint16_t runLength = 0U;
+
+            for (x = 0; x < glyph.width; ++x)
+            {
+                /* Every 8 bit, the bitmap offset must be increased. */
+                if (0U == (bitCnt & 0x07))
+                {
+                    bitmapRowBits = font.bitmap[bitmapOffset];
+                    ++bitmapOffset;
+                }
+                ++bitCnt;
+
+                /* Consecutive 1b in the bitmap row bits are handled as one run. */
+                if (0U != (bitmapRowBits & 0x80U))
+                {
+                    if (0U == runLength)
+                    {
+                        runStart = x;
+                    }
+
+                    ++runLength;
+                }
+                else if (0U < runLength)
+                {
+                    handler(runStart, y, runLength);
+                    runLength = 0U;
+                }
+                else
+                {
+                    /* Nothing to do. */
+                    ;
+                }
+
+                bitmapRowBits <<= 1U;
+            }
+
+            /* Run, which ends at the glyph border. */
+            if (0U < runLength)
+            {
+                handler(runStart, y, runLength);
+            }
+        }
+    }
+
+protected:
+
+    /**
+     * Constructs the glyph cache.
+     */
+    BaseGlyphCache()
+    {
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* BASE_GLYPH_CACHE_HPP */
+
+/** @} */
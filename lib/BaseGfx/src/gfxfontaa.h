@@ -0,0 +1,84 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   gfxfontaa.h
+ * @brief  Anti-aliased font format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef GFXFONTAA_H
+#define GFXFONTAA_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "gfxfont.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Anti-aliased font, which extends the Adafruit GFXfont format by a pixel
+ * coverage. The glyph metrics are the same as in the GFXfont format, only
+ * the glyph bitmaps differ:
+ *
+ * - Every pixel is stored with the given number of bits per pixel (2, 4 or 8),
+ *   the most significant bits first. 0 means not covered and the max. value
+ *   means fully covered.
+ * - Every glyph row starts at a byte boundary, therefore a row can be
+ *   decoded without the previous ones.
+ *
+ * Such fonts are generated by scripts/fontconvert_aa.py.
+ */
+typedef struct
+{
+    GFXfont gfxFont;      /**< Glyph metrics and concatenated glyph bitmaps. */
+    uint8_t bitsPerPixel; /**< Number of coverage bits per pixel: 2, 4 or 8. */
+
+} GFXfontAA;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GFXFONTAA_H */
+
+/** @} */
@@ -0,0 +1,90 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   gfxunicode.h
+ * @brief  Unicode glyph map of a font
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef GFXUNICODE_H
+#define GFXUNICODE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Range of consecutive Unicode code points, which are mapped to consecutive
+ * glyphs in the glyph array of a font.
+ */
+typedef struct
+{
+    uint32_t first;      /**< First code point of the range. */
+    uint32_t last;       /**< Last code point of the range. */
+    uint16_t glyphIndex; /**< Glyph array index of the first code point. */
+
+} GFXunicodeRange;
+
+/**
+ * Maps sparse Unicode code point ranges to the glyphs of a font.
+ * The ranges must be sorted ascending by their code points and must not
+ * overlap, because the glyph is located by a binary search.
+ *
+ * Without a map, the code point is the character code of the font,
+ * see GFXfont first and last.
+ */
+typedef struct
+{
+    const GFXunicodeRange* ranges;     /**< Code point ranges, sorted ascending. */
+    uint16_t               rangeCount; /**< Number of code point ranges. */
+
+} GFXunicodeMap;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GFXUNICODE_H */
+
+/** @} */
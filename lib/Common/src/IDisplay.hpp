@@ -90,6 +90,18 @@ public:
      */
     virtual bool isReady() const                   = 0;
 
+    /**
+     * Wait until the display is ready for another update via show().
+     * In contrast to polling isReady(), the calling task is blocked until
+     * the physical display signals that the transfer is finished or the
+     * timeout elapsed.
+     *
+     * @param[in] timeout   Max. time to wait in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    virtual bool waitUntilReady(uint32_t timeout)  = 0;
+
     /**
      * Set brightness from 0 to 255.
      *
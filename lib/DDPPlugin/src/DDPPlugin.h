@@ -147,6 +147,18 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Get the desired frame interval in ms.
+     * The received frames shall be shown as fast as possible, to follow the
+     * frame rate of the sender.
+     *
+     * @return Frame interval in ms
+     */
+    uint32_t getFrameInterval() const final
+    {
+        return FRAME_INTERVAL_FASTEST;
+    }
+
 private:
 
     DDPServer          m_server;      /**< DDP server */
@@ -79,18 +79,16 @@ bool FadeLinear::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MAX_BRIGHT - FADING_STEP) <= m_intensity)
     {
-        dimBitmap(next, Color::MAX_BRIGHT);
+        gfx.copy(next);
         m_state    = FADE_STATE_INIT;
         isFinished = true;
     }
     else
     {
-        dimBitmap(next, m_intensity);
+        drawDimmedBitmap(gfx, next, m_intensity);
         m_intensity += FADING_STEP;
     }
 
-    gfx.copy(next);
-
     return isFinished;
 }
 
@@ -109,18 +107,16 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MIN_BRIGHT + FADING_STEP) >= m_intensity)
     {
-        dimBitmap(prev, Color::MIN_BRIGHT);
+        drawDimmedBitmap(gfx, prev, Color::MIN_BRIGHT);
         m_state    = FADE_STATE_INIT;
         isFinished = true;
     }
     else
     {
-        dimBitmap(prev, m_intensity);
+        drawDimmedBitmap(gfx, prev, m_intensity);
         m_intensity -= FADING_STEP;
     }
 
-    gfx.copy(prev);
-
     return isFinished;
 }
 
@@ -132,7 +128,7 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
  * Private Methods
  *****************************************************************************/
 
-void FadeLinear::dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity)
+void FadeLinear::drawDimmedBitmap(YAGfx& gfx, const YAGfxBitmap& bitmap, uint8_t intensity)
 {
     uint16_t width  = bitmap.getWidth();
     uint16_t height = bitmap.getHeight();
@@ -143,7 +139,15 @@ void FadeLinear::dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity)
     {
         for (x = 0; x < width; ++x)
         {
-            bitmap.getColor(x, y).setIntensity(intensity);
+            Color    color           = bitmap.getColor(x, y);
+            uint16_t pixelIntensity  = color.getIntensity();
+
+            /* Consider the intensity the pixel already has. */
+            pixelIntensity          *= intensity;
+            pixelIntensity          /= Color::MAX_BRIGHT;
+            color.setIntensity(static_cast<uint8_t>(pixelIntensity));
+
+            gfx.drawPixel(x, y, color);
         }
     }
 }
@@ -126,12 +126,15 @@ private:
     uint8_t   m_intensity; /**< Current color intensity [0; 255] - 0: min. bright / 255: max. bright */
 
     /**
-     * Dim bitmap to a specific intensity.
+     * Draw the bitmap dimmed to a specific intensity.
+     * The bitmap itself is not changed, because depending on the color
+     * type the intensity may be applied destructive to the base colors.
      *
-     * @param[inout] bitmap The bitmap which to dim down/up.
-     * @param[in] intensity The intensity to set.
+     * @param[in] gfx       Graphics interface to display
+     * @param[in] bitmap    The bitmap which to draw dimmed down/up.
+     * @param[in] intensity The intensity to apply.
      */
-    void dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity);
+    void drawDimmedBitmap(YAGfx& gfx, const YAGfxBitmap& bitmap, uint8_t intensity);
 };
 
 /******************************************************************************
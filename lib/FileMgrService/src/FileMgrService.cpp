@@ -42,6 +42,9 @@
 #include <TopicHandlerService.h>
 #include <JsonFile.h>
 #include <BitmapWidget.h>
+#include <BmpImgLoader.h>
+#include <PxiImgWriter.h>
+#include <FileUtil.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -287,7 +290,9 @@ bool FileMgrService::scanForFiles(FileTableEntry* fileTable)
         {
             String fullPath = fd.path();
 
-            if (true == BitmapWidget::isImageTypeSupported(fullPath))
+            /* Sidecar images belong to their bitmap image. */
+            if ((true == BitmapWidget::isImageTypeSupported(fullPath)) &&
+                (false == BitmapWidget::isSidecarFile(fullPath)))
             {
                 /* Add only new file to file table. */
                 if (FILE_ID_INVALID != getFileId(fileTable, fullPath))
@@ -337,6 +342,7 @@ bool FileMgrService::checkForFiles(FileTableEntry* fileTable)
         if ((false == entry->fullPath.isEmpty()) &&
             (false == FILESYSTEM.exists(entry->fullPath)))
         {
+            removeSidecar(entry->fullPath);
             entry->clear();
 
             anyChange = true;
@@ -439,6 +445,12 @@ bool FileMgrService::uploadTopic(const String& topic, const JsonObjectConst& val
                 {
                     isSuccessful = true;
                 }
+
+                /* Create or update the sidecar image, because the file content may have changed. */
+                if (true == isSuccessful)
+                {
+                    (void)createSidecar(fullPath);
+                }
             }
         }
     }
@@ -457,6 +469,11 @@ bool FileMgrService::isUploadAccepted(const String& topic, const String& srcFile
         {
             LOG_WARNING("File \"%s\" not supported.", srcFilename.c_str());
         }
+        /* Sidecar images are created only by the file manager. */
+        else if (true == BitmapWidget::isSidecarFile(srcFilename))
+        {
+            LOG_WARNING("File \"%s\" not supported.", srcFilename.c_str());
+        }
         else
         {
             dstFilename  = WORKING_DIRECTORY;
@@ -470,6 +487,59 @@ bool FileMgrService::isUploadAccepted(const String& topic, const String& srcFile
     return isAccepted;
 }
 
+bool FileMgrService::createSidecar(const String& fullPath)
+{
+    bool   isCreated     = false;
+    String fileExtension = FileUtil::getFileExtension(fullPath);
+
+    if (true == fileExtension.equalsIgnoreCase(BitmapWidget::FILE_EXT_BITMAP))
+    {
+        BmpImgLoader       loader;
+        YAGfxDynamicBitmap bitmap;
+        uint32_t           sourceCrc = 0U;
+
+        /* A sidecar image of a previous upload is outdated. */
+        removeSidecar(fullPath);
+
+        if (false == FileUtil::getCrc32(FILESYSTEM, fullPath, sourceCrc))
+        {
+            LOG_WARNING("Failed to read %s, no sidecar image created.", fullPath.c_str());
+        }
+        else if (BmpImgLoader::RET_OK != loader.load(FILESYSTEM, fullPath, bitmap))
+        {
+            LOG_WARNING("Failed to load %s, no sidecar image created.", fullPath.c_str());
+        }
+        else
+        {
+            PxiImgWriter writer;
+            String       sidecarFullPath = BitmapWidget::getSidecarFilename(fullPath);
+
+            if (false == writer.write(FILESYSTEM, sidecarFullPath, bitmap, true, sourceCrc))
+            {
+                LOG_WARNING("Failed to create sidecar image %s.", sidecarFullPath.c_str());
+            }
+            else
+            {
+                LOG_INFO("Created sidecar image %s.", sidecarFullPath.c_str());
+
+                isCreated = true;
+            }
+        }
+    }
+
+    return isCreated;
+}
+
+void FileMgrService::removeSidecar(const String& fullPath)
+{
+    String sidecarFullPath = BitmapWidget::getSidecarFilename(fullPath);
+
+    if (true == FILESYSTEM.exists(sidecarFullPath))
+    {
+        (void)FILESYSTEM.remove(sidecarFullPath);
+    }
+}
+
 bool FileMgrService::removeTopic(const String& topic, const JsonObjectConst& value)
 {
     bool isSuccessful = false;
@@ -636,6 +706,7 @@ void FileMgrService::removeFiles()
         {
             if (true == FILESYSTEM.remove(entry->fullPath))
             {
+                removeSidecar(entry->fullPath);
                 removeFileEntry(m_fileTable, fileId);
                 m_hasFileTableChanged = true;
                 m_isDirty             = true;
@@ -324,6 +324,25 @@ private:
      */
     bool isUploadAccepted(const String& topic, const String& srcFilename, String& dstFilename);
 
+    /**
+     * Create the Pixelix sidecar image of an uploaded bitmap image. It is
+     * loaded with a single read and needs no color conversion. The bitmap
+     * image is kept as it is, the file table refers only to it.
+     * Other image types have no sidecar image.
+     *
+     * @param[in] fullPath  Full path of the uploaded file.
+     *
+     * @return If created, it will return true otherwise false.
+     */
+    bool createSidecar(const String& fullPath);
+
+    /**
+     * Remove the Pixelix sidecar image of a bitmap image, if available.
+     *
+     * @param[in] fullPath  Full path of the bitmap image.
+     */
+    void removeSidecar(const String& fullPath);
+
     /**
      * Remove topic data.
      * Note, currently only JSON format is supported.
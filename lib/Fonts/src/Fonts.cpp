@@ -36,14 +36,26 @@
 #include "Fonts.h"
 
 #include <Arduino.h>
+#include <MemUtil.h>
 #include <muMatrix8ptRegular.h>
 #include <TomThumb.h>
+#include <Util.h>
 #include <string.h>
 
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
 
+#ifndef CONFIG_GLYPH_CACHE_ENTRIES
+/** Max. number of glyphs in the glyph cache, if no PSRAM is available. */
+#define CONFIG_GLYPH_CACHE_ENTRIES          32U
+#endif /* CONFIG_GLYPH_CACHE_ENTRIES */
+
+#ifndef CONFIG_GLYPH_CACHE_ENTRIES_PSRAM
+/** Max. number of glyphs in the glyph cache, if PSRAM is available. */
+#define CONFIG_GLYPH_CACHE_ENTRIES_PSRAM    256U
+#endif /* CONFIG_GLYPH_CACHE_ENTRIES_PSRAM */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -60,15 +72,51 @@
  * Local Variables
  *****************************************************************************/
 
+/**
+ * Unicode code point ranges of the built-in fonts. Their glyph arrays start
+ * with the printable ASCII characters, followed by the Latin-1 supplement
+ * and single characters of further blocks.
+ */
+static const GFXunicodeRange gUnicodeRanges[] = {
+    { 0x0020U, 0x007EU, 0U   }, /* Basic Latin */
+    { 0x00A1U, 0x00FFU, 95U  }, /* Latin-1 supplement */
+    { 0x011DU, 0x011DU, 190U }, /* Latin extended-A */
+    { 0x0152U, 0x0153U, 191U }, /* Latin extended-A */
+    { 0x0160U, 0x0161U, 193U }, /* Latin extended-A */
+    { 0x0178U, 0x0178U, 195U }, /* Latin extended-A */
+    { 0x017DU, 0x017EU, 196U }, /* Latin extended-A */
+    { 0x0EA4U, 0x0EA4U, 198U }, /* Lao */
+    { 0x13A0U, 0x13A0U, 199U }, /* Cherokee */
+    { 0x2022U, 0x2022U, 200U }, /* General punctuation */
+    { 0x2026U, 0x2026U, 201U }, /* General punctuation */
+    { 0x20ACU, 0x20ACU, 202U }, /* Currency symbols */
+    { 0xFFFDU, 0xFFFDU, 203U }  /* Specials */
+};
+
+/**
+ * Unicode map of the built-in fonts. Glyphs beyond the glyph array of a font
+ * are not available, e.g. if TomThumb is used without extended characters.
+ */
+static const GFXunicodeMap gUnicodeMap = {
+    gUnicodeRanges,
+    UTIL_ARRAY_NUM(gUnicodeRanges)
+};
+
+/**
+ * Glyph cache, which is shared by all fonts.
+ * It will be effective after its entries are allocated by init().
+ */
+static GlyphCache gGlyphCache;
+
 /**
  * 6pt font for YAGfx: TomThumb
  */
-static YAFont gFont6pt(&TomThumb);
+static YAFont gFont6pt(&TomThumb, &gGlyphCache, &gUnicodeMap);
 
 /**
  * 8pt font for YAGfx: muHeavy8ptRegular
  */
-static YAFont gFont8pt(&muMatrix8ptRegular);
+static YAFont gFont8pt(&muMatrix8ptRegular, &gGlyphCache, &gUnicodeMap);
 
 /**
  * Font type default as string.
@@ -101,6 +149,18 @@ static const char* FONT_TYPE_LARGE_AS_STR   = "large";
  * External Functions
  *****************************************************************************/
 
+extern bool Fonts::init()
+{
+    uint16_t maxEntries = CONFIG_GLYPH_CACHE_ENTRIES;
+
+    if (true == MemUtil::isPsramAvailable())
+    {
+        maxEntries = CONFIG_GLYPH_CACHE_ENTRIES_PSRAM;
+    }
+
+    return gGlyphCache.create(maxEntries);
+}
+
 extern const char* Fonts::fontTypeToStr(FontType type)
 {
     const char* fontTypeStr = FONT_TYPE_DEFAULT_AS_STR;
@@ -160,6 +220,11 @@ extern YAFont& Fonts::getFontByType(FontType type)
     return *font;
 }
 
+extern GlyphCache& Fonts::getGlyphCache()
+{
+    return gGlyphCache;
+}
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
@@ -45,6 +45,7 @@
  * Includes
  *****************************************************************************/
 #include <YAFont.h>
+#include "GlyphCache.h"
 
 /** Fonts */
 namespace Fonts
@@ -74,6 +75,16 @@ typedef enum
  * Functions
  *****************************************************************************/
 
+/**
+ * Initialize the fonts by allocating the glyph cache, which is shared by all
+ * fonts. With PSRAM, the glyph cache will hold more glyphs.
+ * Without a glyph cache, the fonts still work, but decode the glyphs on
+ * every draw.
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+extern bool init();
+
 /**
  * Get font type as string.
  *
@@ -102,6 +113,13 @@ extern FontType strToFontType(const char* str);
  */
 extern YAFont& getFontByType(FontType type);
 
+/**
+ * Get the glyph cache, which is shared by all fonts.
+ *
+ * @return Glyph cache
+ */
+extern GlyphCache& getGlyphCache();
+
 } // namespace Fonts
 
 #endif /* FONTS_HPP */
@@ -0,0 +1,362 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GlyphCache.cpp
+ * @brief  LRU glyph cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GlyphCache.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+GlyphCache::GlyphCache() :
+    BaseGlyphCache(),
+    m_entries(nullptr),
+    m_buckets(nullptr),
+    m_maxEntries(0U),
+    m_bucketMask(0U),
+    m_usedEntries(0U),
+    m_head(INVALID_INDEX),
+    m_tail(INVALID_INDEX),
+    m_statistics()
+{
+    resetStatistics();
+}
+
+bool GlyphCache::create(uint16_t maxEntries)
+{
+    bool     isSuccessful = false;
+    uint16_t bucketCount  = 1U;
+
+    release();
+
+    /* The bucket count is the next power of two, which is greater or equal
+     * than the number of entries. This keeps the hash calculation cheap.
+     */
+    while ((bucketCount < maxEntries) && (0x8000U > bucketCount))
+    {
+        bucketCount <<= 1U;
+    }
+
+    if ((0U < maxEntries) &&
+        (INVALID_INDEX > maxEntries))
+    {
+        EntryAllocator  entryAllocator;
+        BucketAllocator bucketAllocator;
+
+        m_entries = entryAllocator.allocateArray(maxEntries);
+        m_buckets = bucketAllocator.allocateArray(bucketCount);
+
+        if ((nullptr == m_entries) ||
+            (nullptr == m_buckets))
+        {
+            release();
+        }
+        else
+        {
+            uint16_t idx;
+
+            m_maxEntries = maxEntries;
+            m_bucketMask = bucketCount - 1U;
+
+            for (idx = 0U; idx < bucketCount; ++idx)
+            {
+                m_buckets[idx] = INVALID_INDEX;
+            }
+
+            /* All entries are unused and part of the LRU list. */
+            for (idx = 0U; idx < maxEntries; ++idx)
+            {
+                Entry& entry     = m_entries[idx];
+
+                entry.font       = nullptr;
+                entry.glyph      = nullptr;
+                entry.prev       = (0U == idx) ? INVALID_INDEX : (idx - 1U);
+                entry.next       = ((maxEntries - 1U) == idx) ? INVALID_INDEX : (idx + 1U);
+                entry.bucketNext = INVALID_INDEX;
+                entry.runCount   = 0U;
+            }
+
+            m_head       = 0U;
+            m_tail       = maxEntries - 1U;
+
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void GlyphCache::release()
+{
+    if (nullptr != m_entries)
+    {
+        EntryAllocator entryAllocator;
+
+        entryAllocator.deallocateArray(m_entries);
+        m_entries = nullptr;
+    }
+
+    if (nullptr != m_buckets)
+    {
+        BucketAllocator bucketAllocator;
+
+        bucketAllocator.deallocateArray(m_buckets);
+        m_buckets = nullptr;
+    }
+
+    m_maxEntries  = 0U;
+    m_bucketMask  = 0U;
+    m_usedEntries = 0U;
+    m_head        = INVALID_INDEX;
+    m_tail        = INVALID_INDEX;
+}
+
+bool GlyphCache::getRuns(const GFXfont& font, const GFXglyph& glyph, const BaseGlyphRun*& runs, uint16_t& runCount)
+{
+    bool     isAvailable = false;
+    uint16_t index       = INVALID_INDEX;
+
+    if (true == isCreated())
+    {
+        index = find(&font, &glyph);
+    }
+
+    if (INVALID_INDEX != index)
+    {
+        ++m_statistics.hits;
+        moveToFront(index);
+        isAvailable = true;
+    }
+    else
+    {
+        ++m_statistics.misses;
+
+        if (true == isCreated())
+        {
+            BaseGlyphRun decodedRuns[MAX_RUNS];
+            uint8_t      decodedRunCount = 0U;
+            bool         isOverflow      = false;
+
+            BaseGlyphCache::decodeRuns(font, glyph, [&decodedRuns, &decodedRunCount, &isOverflow](int16_t x, int16_t y, uint16_t length) {
+                if (MAX_RUNS > decodedRunCount)
+                {
+                    BaseGlyphRun& run = decodedRuns[decodedRunCount];
+
+                    run.x             = static_cast<uint8_t>(x);
+                    run.y             = static_cast<uint8_t>(y);
+                    run.length        = static_cast<uint8_t>(length);
+
+                    ++decodedRunCount;
+                }
+                else
+                {
+                    isOverflow = true;
+                }
+            });
+
+            /* A glyph with too many runs is not cached. It will be decoded by the font. */
+            if (false == isOverflow)
+            {
+                uint16_t bucketIndex = getBucketIndex(&font, &glyph);
+                uint8_t  idx;
+
+                /* The least recently used entry is replaced. */
+                index                = m_tail;
+
+                if (nullptr != m_entries[index].font)
+                {
+                    removeFromBucket(index);
+                    ++m_statistics.evictions;
+                }
+                else
+                {
+                    ++m_usedEntries;
+                }
+
+                Entry& entry = m_entries[index];
+
+                for (idx = 0U; idx < decodedRunCount; ++idx)
+                {
+                    entry.runs[idx] = decodedRuns[idx];
+                }
+
+                entry.font             = &font;
+                entry.glyph            = &glyph;
+                entry.runCount         = decodedRunCount;
+                entry.bucketNext       = m_buckets[bucketIndex];
+                m_buckets[bucketIndex] = index;
+
+                moveToFront(index);
+                isAvailable = true;
+            }
+        }
+    }
+
+    if (true == isAvailable)
+    {
+        runs     = m_entries[index].runs;
+        runCount = m_entries[index].runCount;
+    }
+
+    return isAvailable;
+}
+
+uint8_t GlyphCache::getHitRate() const
+{
+    uint8_t  hitRate  = 0U;
+    uint64_t requests = static_cast<uint64_t>(m_statistics.hits) + m_statistics.misses;
+
+    if (0U < requests)
+    {
+        hitRate = static_cast<uint8_t>((static_cast<uint64_t>(m_statistics.hits) * 100U) / requests);
+    }
+
+    return hitRate;
+}
+
+void GlyphCache::resetStatistics()
+{
+    m_statistics.hits      = 0U;
+    m_statistics.misses    = 0U;
+    m_statistics.evictions = 0U;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+uint16_t GlyphCache::getBucketIndex(const GFXfont* font, const GFXglyph* glyph) const
+{
+    /* Glyphs of a font are consecutive in memory, therefore the glyph index
+     * distributes them over the buckets without collisions.
+     */
+    uintptr_t key = (reinterpret_cast<uintptr_t>(glyph) / sizeof(GFXglyph)) ^
+                    (reinterpret_cast<uintptr_t>(font) / sizeof(GFXfont));
+
+    return static_cast<uint16_t>(key) & m_bucketMask;
+}
+
+uint16_t GlyphCache::find(const GFXfont* font, const GFXglyph* glyph) const
+{
+    uint16_t index = m_buckets[getBucketIndex(font, glyph)];
+
+    while ((INVALID_INDEX != index) &&
+           ((font != m_entries[index].font) || (glyph != m_entries[index].glyph)))
+    {
+        index = m_entries[index].bucketNext;
+    }
+
+    return index;
+}
+
+void GlyphCache::removeFromBucket(uint16_t index)
+{
+    Entry&    entry     = m_entries[index];
+    uint16_t* nextIndex = &m_buckets[getBucketIndex(entry.font, entry.glyph)];
+
+    while ((INVALID_INDEX != *nextIndex) &&
+           (index != *nextIndex))
+    {
+        nextIndex = &m_entries[*nextIndex].bucketNext;
+    }
+
+    if (INVALID_INDEX != *nextIndex)
+    {
+        *nextIndex = entry.bucketNext;
+    }
+
+    entry.font       = nullptr;
+    entry.glyph      = nullptr;
+    entry.bucketNext = INVALID_INDEX;
+}
+
+void GlyphCache::moveToFront(uint16_t index)
+{
+    if (m_head != index)
+    {
+        Entry& entry = m_entries[index];
+
+        /* Unlink entry. The head has no previous entry, therefore the
+         * entry has always one.
+         */
+        m_entries[entry.prev].next = entry.next;
+
+        if (INVALID_INDEX != entry.next)
+        {
+            m_entries[entry.next].prev = entry.prev;
+        }
+        else
+        {
+            m_tail = entry.prev;
+        }
+
+        /* Link entry as new head. */
+        entry.prev             = INVALID_INDEX;
+        entry.next             = m_head;
+        m_entries[m_head].prev = index;
+        m_head                 = index;
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
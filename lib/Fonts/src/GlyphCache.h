@@ -0,0 +1,276 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GlyphCache.h
+ * @brief  LRU glyph cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <BaseGlyphCache.hpp>
+#include <TypedAllocator.hpp>
+#include <PsAllocator.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Glyph cache with a fixed number of entries, which are replaced in least
+ * recently used order. Every entry holds the glyph as runs of set pixels,
+ * keyed by font and glyph. Glyphs with more runs than fit into an entry are
+ * not cached.
+ *
+ * The cache is not thread-safe, it shall only be used by the task which
+ * draws the fonts.
+ */
+class GlyphCache : public BaseGlyphCache
+{
+public:
+
+    /** Max. number of runs per cached glyph. */
+    static const uint8_t MAX_RUNS = 32U;
+
+    /**
+     * Cache statistics.
+     */
+    typedef struct
+    {
+        uint32_t hits;      /**< Number of requests, served from the cache. */
+        uint32_t misses;    /**< Number of requests, which needed to rasterize the glyph. */
+        uint32_t evictions; /**< Number of cached glyphs, which were replaced. */
+
+    } Statistics;
+
+    /**
+     * Constructs the glyph cache without entries.
+     * Until create() is called, every request is a miss.
+     */
+    GlyphCache();
+
+    /**
+     * Destroys the glyph cache.
+     */
+    ~GlyphCache()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the cache entries. Already cached glyphs are released.
+     *
+     * @param[in] maxEntries    Max. number of cached glyphs.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t maxEntries);
+
+    /**
+     * Release the cache entries.
+     */
+    void release();
+
+    /**
+     * Is the cache created?
+     *
+     * @return If created, it will return true otherwise false.
+     */
+    bool isCreated() const
+    {
+        return (nullptr != m_entries);
+    }
+
+    /**
+     * Get max. number of cached glyphs.
+     *
+     * @return Max. number of cached glyphs
+     */
+    uint16_t getMaxEntries() const
+    {
+        return m_maxEntries;
+    }
+
+    /**
+     * Get number of cached glyphs.
+     *
+     * @return Number of cached glyphs
+     */
+    uint16_t getUsedEntries() const
+    {
+        return m_usedEntries;
+    }
+
+    /**
+     * Get the runs of a glyph.
+     * If the glyph is not cached yet, it will be rasterized and cached.
+     * The least recently used glyph is replaced, if the cache is full.
+     *
+     * The runs stay valid until the next call.
+     *
+     * @param[in]  font     Font, which contains the glyph.
+     * @param[in]  glyph    Glyph of the font.
+     * @param[out] runs     Runs of the glyph, sorted by row.
+     * @param[out] runCount Number of runs.
+     *
+     * @return If the runs are available, it will return true otherwise false.
+     */
+    bool getRuns(const GFXfont& font, const GFXglyph& glyph, const BaseGlyphRun*& runs, uint16_t& runCount) final;
+
+    /**
+     * Get cache statistics.
+     *
+     * @return Cache statistics
+     */
+    const Statistics& getStatistics() const
+    {
+        return m_statistics;
+    }
+
+    /**
+     * Get hit rate in percent of all requests since the last reset.
+     *
+     * @return Hit rate in [0; 100] %
+     */
+    uint8_t getHitRate() const;
+
+    /**
+     * Reset the cache statistics.
+     */
+    void resetStatistics();
+
+private:
+
+    /** Index, which marks the end of a list. */
+    static const uint16_t INVALID_INDEX = UINT16_MAX;
+
+    /**
+     * A cached glyph.
+     */
+    typedef struct
+    {
+        const GFXfont*  font;           /**< Font, which contains the glyph. nullptr for an unused entry. */
+        const GFXglyph* glyph;          /**< Glyph of the font. */
+        uint16_t        prev;           /**< Index of the more recently used entry. */
+        uint16_t        next;           /**< Index of the less recently used entry. */
+        uint16_t        bucketNext;     /**< Index of the next entry in the same bucket. */
+        uint8_t         runCount;       /**< Number of runs. */
+        BaseGlyphRun    runs[MAX_RUNS]; /**< Runs of set pixels. */
+
+    } Entry;
+
+    /** Memory allocator type for the cache entries. */
+    typedef TypedAllocator<Entry, PsAllocator>    EntryAllocator;
+
+    /** Memory allocator type for the hash buckets. */
+    typedef TypedAllocator<uint16_t, PsAllocator> BucketAllocator;
+
+    Entry*     m_entries;     /**< Cache entries */
+    uint16_t*  m_buckets;     /**< Hash buckets with the index of the first entry. */
+    uint16_t   m_maxEntries;  /**< Max. number of cache entries */
+    uint16_t   m_bucketMask;  /**< Bucket count - 1, the bucket count is a power of two. */
+    uint16_t   m_usedEntries; /**< Number of used cache entries */
+    uint16_t   m_head;        /**< Index of the most recently used entry. */
+    uint16_t   m_tail;        /**< Index of the least recently used entry. */
+    Statistics m_statistics;  /**< Cache statistics */
+
+    /**
+     * Not allowed to copy the glyph cache.
+     *
+     * @param[in] cache Glyph cache, which to copy.
+     */
+    GlyphCache(const GlyphCache& cache)            = delete;
+
+    /**
+     * Not allowed to assign a glyph cache.
+     *
+     * @param[in] cache Glyph cache, which to assign.
+     *
+     * @return Glyph cache
+     */
+    GlyphCache& operator=(const GlyphCache& cache) = delete;
+
+    /**
+     * Get the hash bucket index of a glyph.
+     *
+     * @param[in] font  Font, which contains the glyph.
+     * @param[in] glyph Glyph of the font.
+     *
+     * @return Bucket index
+     */
+    uint16_t getBucketIndex(const GFXfont* font, const GFXglyph* glyph) const;
+
+    /**
+     * Find a cached glyph.
+     *
+     * @param[in] font  Font, which contains the glyph.
+     * @param[in] glyph Glyph of the font.
+     *
+     * @return Entry index or INVALID_INDEX, if not cached.
+     */
+    uint16_t find(const GFXfont* font, const GFXglyph* glyph) const;
+
+    /**
+     * Remove entry from its hash bucket.
+     *
+     * @param[in] index Entry index
+     */
+    void removeFromBucket(uint16_t index);
+
+    /**
+     * Move entry to the front of the LRU list, which makes it the most
+     * recently used entry.
+     *
+     * @param[in] index Entry index
+     */
+    void moveToFront(uint16_t index);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GLYPH_CACHE_H */
+
+/** @} */
@@ -79,7 +79,7 @@ const HUB75_I2S_CFG Display::MATRIX_CFG = {
     I2S_PINS,                           /* Pin mapping */
     CONFIG_HUB75_DRIVER,                /* Driver */
     CONFIG_HUB75_LINE_DRIVER,           /* Line driver */
-    false,                              /* Use DMA double buffer */
+    (0 != CONFIG_HUB75_DOUBLE_BUFFER),  /* Use DMA double buffer */
     HUB75_I2S_CFG::HZ_8M,               /* I2S clock speed */
     DEFAULT_LAT_BLANKING,               /* How many clock cycles to blank OE before/after LAT signal change. */
     CONFIG_HUB75_CLOCK_PHASE,           /* Clock phase */
@@ -102,6 +102,9 @@ const HUB75_I2S_CFG Display::MATRIX_CFG = {
 Display::Display() :
     IDisplay(),
     m_panel(MATRIX_CFG),
+#if (0 != CONFIG_HUB75_DOUBLE_BUFFER)
+    m_backBufferStaleArea(),
+#endif /* (0 != CONFIG_HUB75_DOUBLE_BUFFER) */
     m_ledMatrix(),
     m_isOn(true)
 {
@@ -113,29 +116,30 @@ Display::~Display()
 
 void Display::show()
 {
-    if (true == m_isOn)
+    const BaseGfxDirtyArea& dirtyArea = m_ledMatrix.getDirtyArea();
+
+    /* Only the changed pixels are written to the panel DMA buffer. */
+    if ((true == m_isOn) &&
+        (false == dirtyArea.isEmpty()))
     {
-        int16_t y;
-        int16_t x;
+#if (0 != CONFIG_HUB75_DOUBLE_BUFFER)
+        /* The back buffer contains the frame before the last one. Therefore
+         * the area which was changed with the last frame must be written too.
+         */
+        BaseGfxDirtyArea area = m_backBufferStaleArea;
 
-        for (y = 0; y < Board::LedMatrix::height; ++y)
-        {
-            for (x = 0; x < Board::LedMatrix::width; ++x)
-            {
-                Color& color = m_ledMatrix.getColor(x, y);
+        area.add(dirtyArea);
+        writeArea(area);
 
-#if CONFIG_DISPLAY_ROTATE180 != 0
-                m_panel.drawPixelRGB888(
-                    Board::LedMatrix::width - x - 1,
-                    Board::LedMatrix::height - y - 1,
-                    color.getRed(),
-                    color.getGreen(),
-                    color.getBlue());
-#else
-                m_panel.drawPixelRGB888(x, y, color.getRed(), color.getGreen(), color.getBlue());
-#endif
-            }
-        }
+        /* Show the complete frame without tearing. */
+        m_panel.flipDMABuffer();
+
+        m_backBufferStaleArea = dirtyArea;
+#else  /* (0 != CONFIG_HUB75_DOUBLE_BUFFER) */
+        writeArea(dirtyArea);
+#endif /* (0 != CONFIG_HUB75_DOUBLE_BUFFER) */
+
+        m_ledMatrix.clearDirtyArea();
     }
 }
 
@@ -145,11 +149,21 @@ void Display::off()
 
     /* Simulate powered off display. */
     m_panel.fillScreen(ColorDef::BLACK);
+
+#if (0 != CONFIG_HUB75_DOUBLE_BUFFER)
+    /* Clear the other DMA buffer too. */
+    m_panel.flipDMABuffer();
+    m_panel.fillScreen(ColorDef::BLACK);
+    m_backBufferStaleArea.clear();
+#endif /* (0 != CONFIG_HUB75_DOUBLE_BUFFER) */
 }
 
 void Display::on()
 {
     m_isOn = true;
+
+    /* The panel was cleared, therefore all pixels need to be updated. */
+    m_ledMatrix.markAllDirty();
 }
 
 bool Display::isOn() const
@@ -157,6 +171,51 @@ bool Display::isOn() const
     return m_isOn;
 }
 
+void Display::writeArea(const BaseGfxDirtyArea& area)
+{
+    const int16_t  xBegin = area.getX();
+    const int16_t  yBegin = area.getY();
+    const uint16_t length = area.getWidth();
+    const int16_t  yEnd   = yBegin + area.getHeight();
+    int16_t        y;
+
+    for (y = yBegin; y < yEnd; ++y)
+    {
+        uint16_t     offset = 0U;
+        const Color* src    = m_ledMatrix.getFrameBufferXAddr(xBegin, y, length, offset);
+
+#if CONFIG_DISPLAY_ROTATE180 != 0
+        /* The rotated row is written in reverse order. */
+        const int16_t xPanel = Board::LedMatrix::width - xBegin - 1;
+        const int16_t yPanel = Board::LedMatrix::height - y - 1;
+        const int16_t xStep  = -1;
+#else
+        const int16_t xPanel = xBegin;
+        const int16_t yPanel = y;
+        const int16_t xStep  = 1;
+#endif
+
+        if (nullptr != src)
+        {
+            int16_t  x = xPanel;
+            uint16_t idx;
+
+            for (idx = 0U; idx < length; ++idx)
+            {
+                uint8_t red;
+                uint8_t green;
+                uint8_t blue;
+
+                src->get(red, green, blue);
+                m_panel.drawPixelRGB888(x, yPanel, red, green, blue);
+
+                src += offset;
+                x   += xStep;
+            }
+        }
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
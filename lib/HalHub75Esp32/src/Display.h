@@ -41,6 +41,16 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_HUB75_DOUBLE_BUFFER
+
+/**
+ * Use the DMA double buffer (1) to draw into the back buffer and swap it
+ * after the frame is complete or draw directly into the shown buffer (0).
+ */
+#define CONFIG_HUB75_DOUBLE_BUFFER  1
+
+#endif /* CONFIG_HUB75_DOUBLE_BUFFER */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -108,6 +118,24 @@ public:
         return true;
     }
 
+    /**
+     * Wait until the display is ready for another update via show().
+     * In contrast to polling isReady(), the calling task is blocked until
+     * the physical display signals that the transfer is finished or the
+     * timeout elapsed.
+     *
+     * @param[in] timeout   Max. time to wait in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool waitUntilReady(uint32_t timeout) final
+    {
+        /* The display update is synchronous, there is nothing to wait for. */
+        (void)timeout;
+
+        return true;
+    }
+
     /**
      * Set brightness from 0 to 255.
      *
@@ -289,6 +317,17 @@ private:
      */
     MatrixPanel_I2S_DMA m_panel;
 
+#if (0 != CONFIG_HUB75_DOUBLE_BUFFER)
+
+    /**
+     * Area, which was written to the other DMA buffer with the last frame.
+     * After a swap it is outdated in the back buffer and must be written
+     * again.
+     */
+    BaseGfxDirtyArea m_backBufferStaleArea;
+
+#endif /* (0 != CONFIG_HUB75_DOUBLE_BUFFER) */
+
     /**
      * The LED matrix framebuffer.
      * This is the drawback for the direct color manipulation via getColor().
@@ -305,6 +344,13 @@ private:
      */
     Display();
 
+    /**
+     * Write a rectangle of the framebuffer row by row to the panel DMA buffer.
+     *
+     * @param[in] area  Area in framebuffer coordinates.
+     */
+    void writeArea(const BaseGfxDirtyArea& area);
+
     /**
      * Destroys display.
      */
@@ -324,6 +370,19 @@ private:
     {
         m_ledMatrix.drawPixel(x, y, color);
     }
+
+    /**
+     * Mark a rectangle as changed. It is forwarded to the LED matrix framebuffer.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_ledMatrix.markDirty(x, y, width, height);
+    }
 };
 
 /******************************************************************************
@@ -71,36 +71,143 @@ Display::Display() :
     IDisplay(),
     m_strip(Board::LedMatrix::width * Board::LedMatrix::height, Board::Pin::ledMatrixDataOutPinNo),
     m_topo(Board::LedMatrix::width, Board::LedMatrix::height),
+    m_ledIndexTable(),
     m_ledMatrix(),
-    m_isOn(true)
+    m_isOn(true),
+    m_readySemaphore(nullptr),
+    m_readyTimer(nullptr)
 {
 }
 
 Display::~Display()
 {
+    if (nullptr != m_readyTimer)
+    {
+        (void)esp_timer_stop(m_readyTimer);
+        (void)esp_timer_delete(m_readyTimer);
+        m_readyTimer = nullptr;
+    }
+
+    if (nullptr != m_readySemaphore)
+    {
+        vSemaphoreDelete(m_readySemaphore);
+        m_readySemaphore = nullptr;
+    }
+}
+
+bool Display::begin()
+{
+    bool isSuccessful = true;
+
+    if (nullptr == m_readySemaphore)
+    {
+        m_readySemaphore = xSemaphoreCreateBinary();
+
+        if (nullptr == m_readySemaphore)
+        {
+            isSuccessful = false;
+        }
+    }
+
+    if ((true == isSuccessful) &&
+        (nullptr == m_readyTimer))
+    {
+        esp_timer_create_args_t timerArgs = {
+            readyTimerCallback, /* Callback */
+            this,               /* Callback argument */
+            ESP_TIMER_TASK,     /* Dispatch callback from the timer task. */
+            "displayReady",     /* Timer name */
+            false               /* Skip unhandled events for periodic timers */
+        };
+
+        if (ESP_OK != esp_timer_create(&timerArgs, &m_readyTimer))
+        {
+            m_readyTimer = nullptr;
+            isSuccessful = false;
+        }
+    }
+
+    if (true == isSuccessful)
+    {
+        buildLedIndexTable();
+
+        m_strip.Begin(); /* Initializes the strip with black color. */
+        latch();
+    }
+
+    return isSuccessful;
+}
+
+bool Display::waitUntilReady(uint32_t timeout)
+{
+    bool isReady = m_strip.CanShow();
+
+    /* Block until the ready timer signals that the transfer is finished. */
+    if ((false == isReady) &&
+        (nullptr != m_readySemaphore))
+    {
+        if (pdTRUE == xSemaphoreTake(m_readySemaphore, pdMS_TO_TICKS(timeout)))
+        {
+            isReady = true;
+        }
+        else
+        {
+            isReady = m_strip.CanShow();
+        }
+    }
+
+    return isReady;
 }
 
 void Display::show()
 {
-    if (true == m_isOn)
+    const BaseGfxDirtyArea& dirtyArea = m_ledMatrix.getDirtyArea();
+
+    /* Only the changed pixels are updated. If nothing changed, the LED strip
+     * keeps its content and no transfer is necessary.
+     */
+    if ((true == m_isOn) &&
+        (false == dirtyArea.isEmpty()))
     {
-        const int16_t height = m_ledMatrix.getHeight();
-        const int16_t width  = m_ledMatrix.getWidth();
+        const uint16_t width     = m_ledMatrix.getWidth();
+        const int16_t  xBegin    = dirtyArea.getX();
+        const int16_t  yBegin    = dirtyArea.getY();
+        const uint16_t length    = dirtyArea.getWidth();
+        const int16_t  yEnd      = yBegin + dirtyArea.getHeight();
+        const uint8_t  luminance = m_strip.GetLuminance();
+        uint8_t*       pixels    = m_strip.Pixels();
+        int16_t        y         = 0;
 
-        for (int16_t y = 0; y < height; ++y)
+        /* The colors are written directly into the strip pixel buffer with
+         * the luminance applied, like NeoPixelBusLg::SetPixelColor() does.
+         * This avoids the topology mapping and the color conversion via
+         * HtmlColor for every single pixel.
+         */
+        for (y = yBegin; y < yEnd; ++y)
         {
-            for (int16_t x = 0; x < width; ++x)
+            uint16_t        offset = 0U;
+            const Color*    src    = m_ledMatrix.getFrameBufferXAddr(xBegin, y, length, offset);
+            const uint16_t* index  = &m_ledIndexTable[y * width + xBegin];
+            uint16_t        idx    = 0U;
+
+            if (nullptr != src)
             {
-                HtmlColor htmlColor = static_cast<uint32_t>(m_ledMatrix.getColor(x, y));
-#if CONFIG_DISPLAY_ROTATE180 != 0
-                m_strip.SetPixelColor(m_topo.Map(width - x - 1, height - y - 1), htmlColor);
-#else
-                m_strip.SetPixelColor(m_topo.Map(x, y), htmlColor);
-#endif
+                for (idx = 0U; idx < length; ++idx)
+                {
+                    RgbColor rgbColor(src->getRed(), src->getGreen(), src->getBlue());
+
+                    ColorFeature::applyPixelColor(pixels, *index, rgbColor.Dim(luminance));
+
+                    src += offset;
+                    ++index;
+                }
             }
         }
 
-        m_strip.Show();
+        m_strip.Dirty();
+        m_ledMatrix.clearDirtyArea();
+
+        latch();
     }
 }
 
@@ -110,12 +217,15 @@ void Display::off()
 
     /* Simulate powered off display. */
     m_strip.ClearTo(ColorDef::BLACK);
-    m_strip.Show();
+    latch();
 }
 
 void Display::on()
 {
     m_isOn = true;
+
+    /* The LED strip was cleared, therefore all pixels need to be updated. */
+    m_ledMatrix.markAllDirty();
 }
 
 bool Display::isOn() const
@@ -123,6 +233,61 @@ bool Display::isOn() const
     return m_isOn;
 }
 
+void Display::buildLedIndexTable()
+{
+    const uint16_t width  = Board::LedMatrix::width;
+    const uint16_t height = Board::LedMatrix::height;
+    uint16_t       x      = 0U;
+    uint16_t       y      = 0U;
+
+    for (y = 0U; y < height; ++y)
+    {
+        for (x = 0U; x < width; ++x)
+        {
+#if CONFIG_DISPLAY_ROTATE180 != 0
+            m_ledIndexTable[y * width + x] = m_topo.Map(width - x - 1U, height - y - 1U);
+#else
+            m_ledIndexTable[y * width + x] = m_topo.Map(x, y);
+#endif
+        }
+    }
+}
+
+void Display::latch()
+{
+    /* Discard a pending ready signal from a previous transfer. */
+    if (nullptr != m_readySemaphore)
+    {
+        (void)xSemaphoreTake(m_readySemaphore, 0U);
+    }
+
+    m_strip.Show();
+
+    if (nullptr != m_readyTimer)
+    {
+        /* A still running observation is outdated, restart it. */
+        (void)esp_timer_stop(m_readyTimer);
+        (void)esp_timer_start_once(m_readyTimer, TRANSFER_DURATION);
+    }
+}
+
+void Display::readyTimerCallback(void* arg)
+{
+    Display* self = static_cast<Display*>(arg);
+
+    if (nullptr != self)
+    {
+        if (true == self->m_strip.CanShow())
+        {
+            (void)xSemaphoreGive(self->m_readySemaphore);
+        }
+        else
+        {
+            (void)esp_timer_start_once(self->m_readyTimer, READY_CHECK_PERIOD);
+        }
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
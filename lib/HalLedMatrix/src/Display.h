@@ -47,6 +47,9 @@
 #include <stdint.h>
 #include <IDisplay.hpp>
 #include <NeoPixelBusLg.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <esp_timer.h>
 #include <ColorDef.hpp>
 #include <YAGfxBitmap.h>
 
@@ -84,13 +87,7 @@ public:
      *
      * @return If successful, returns true otherwise false.
      */
-    bool begin() final
-    {
-        m_strip.Begin(); /* Initializes the strip with black color. */
-        m_strip.Show();
-
-        return true;
-    }
+    bool begin() final;
 
     /**
      * Show framebuffer on physical display. This may be synchronous
@@ -109,6 +106,18 @@ public:
         return m_strip.CanShow();
     }
 
+    /**
+     * Wait until the display is ready for another update via show().
+     * In contrast to polling isReady(), the calling task is blocked until
+     * the physical display signals that the transfer is finished or the
+     * timeout elapsed.
+     *
+     * @param[in] timeout   Max. time to wait in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool waitUntilReady(uint32_t timeout) final;
+
     /**
      * Set brightness from 0 to 255.
      *
@@ -123,7 +132,14 @@ public:
             (Board::LedMatrix::supplyCurrentMax * brightness) /
             (Board::LedMatrix::maxCurrentPerLed * Board::LedMatrix::width * Board::LedMatrix::height);
 
-        m_strip.SetLuminance(SAFE_LUMINANCE);
+        /* The luminance is applied while setting the pixel colors. Therefore
+         * all pixels need to be updated after a change.
+         */
+        if (SAFE_LUMINANCE != m_strip.GetLuminance())
+        {
+            m_strip.SetLuminance(SAFE_LUMINANCE);
+            m_ledMatrix.markAllDirty();
+        }
     }
 
     /**
@@ -276,14 +292,45 @@ public:
 
 private:
 
+    /** Transfer duration of a single LED in us (24 bit with 800 kbps). */
+    static const uint64_t LED_TRANSFER_DURATION = 30U;
+
+    /** Reset duration in us, which is required to latch the data in the LEDs. */
+    static const uint64_t LED_RESET_DURATION    = 300U;
+
+    /**
+     * Duration in us of a complete physical display update.
+     * After this time the transfer is expected to be finished.
+     */
+    static const uint64_t TRANSFER_DURATION     = (Board::LedMatrix::width * Board::LedMatrix::height * LED_TRANSFER_DURATION) + LED_RESET_DURATION;
+
+    /**
+     * Period in us to check again whether the transfer is finished,
+     * in case it was not finished after the expected transfer duration.
+     */
+    static const uint64_t READY_CHECK_PERIOD    = 100U;
+
+    /** Number of LEDs of the whole matrix. */
+    static const uint32_t LED_COUNT             = Board::LedMatrix::width * Board::LedMatrix::height;
+
+    /** NeoPixelBus color feature, which defines the LED color order. */
+    typedef NeoGrbFeature ColorFeature;
+
     /**
      * Pixel representation of the LED matrix. Gamma correction disabled.
      */
-    NeoPixelBusLg<NeoGrbFeature, Neo800KbpsMethod, NeoGammaNullMethod> m_strip;
+    NeoPixelBusLg<ColorFeature, Neo800KbpsMethod, NeoGammaNullMethod> m_strip;
 
     /** Panel topology, used to map coordinates to the framebuffer. */
     NeoTopology<CONFIG_LED_TOPO> m_topo;
 
+    /**
+     * Lookup table, which maps the framebuffer pixel index (y * width + x)
+     * to the LED index on the strip. It considers the panel topology and
+     * the display rotation and is built once in begin().
+     */
+    uint16_t m_ledIndexTable[LED_COUNT];
+
     /**
      * The LED matrix framebuffer.
      * This is the drawback for the direct color manipulation via getColor().
@@ -295,6 +342,17 @@ private:
      */
     bool m_isOn;
 
+    /**
+     * Binary semaphore, which is given as soon as the physical display
+     * update is finished.
+     */
+    SemaphoreHandle_t m_readySemaphore;
+
+    /**
+     * One-shot timer, used to observe the physical display update.
+     */
+    esp_timer_handle_t m_readyTimer;
+
     /**
      * Construct display.
      */
@@ -308,6 +366,27 @@ private:
     Display(const Display& display);
     Display& operator=(const Display& display);
 
+    /**
+     * Build the lookup table, which maps the framebuffer pixel index to
+     * the LED index on the strip.
+     */
+    void buildLedIndexTable();
+
+    /**
+     * Latch the strip and start observing the physical display update.
+     * The ready semaphore will be given after the transfer is finished.
+     */
+    void latch();
+
+    /**
+     * Ready timer callback, which checks whether the physical display update
+     * is finished. If finished, it will signal it via the ready semaphore,
+     * otherwise it will check again later.
+     *
+     * @param[in] arg   Display instance
+     */
+    static void readyTimerCallback(void* arg);
+
     /**
      * Draw a single pixel on the display.
      *
@@ -319,6 +398,19 @@ private:
     {
         m_ledMatrix.drawPixel(x, y, color);
     }
+
+    /**
+     * Mark a rectangle as changed. It is forwarded to the LED matrix framebuffer.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_ledMatrix.markDirty(x, y, width, height);
+    }
 };
 
 /******************************************************************************
@@ -72,7 +72,11 @@ Display::Display() :
     m_tft(),
     m_ledMatrix(),
     m_brightness(DEFAULT_BRIGHTNESS),
-    m_isOn(false)
+    m_isOn(false),
+#if defined(ESP32_DMA)
+    m_isDmaEnabled(false),
+#endif /* defined(ESP32_DMA) */
+    m_tileBuffer()
 {
 }
 
@@ -82,33 +86,42 @@ Display::~Display()
 
 void Display::show()
 {
-    int32_t x;
-    int32_t y;
+    const BaseGfxDirtyArea& dirtyArea = m_ledMatrix.getDirtyArea();
 
-    for (y = 0; y < MATRIX_HEIGHT; ++y)
+    /* Only the changed virtual LEDs are drawn, which is empty if nothing changed. */
+    if (false == dirtyArea.isEmpty())
     {
-        for (x = 0; x < MATRIX_WIDTH; ++x)
+        const int32_t xBegin    = dirtyArea.getX();
+        const int32_t yBegin    = dirtyArea.getY();
+        const int32_t xEnd      = xBegin + dirtyArea.getWidth();
+        const int32_t yEnd      = yBegin + dirtyArea.getHeight();
+        uint8_t       tileIndex = 0U;
+        int32_t       ySrc;
+
+        /* Keep the bus for all tiles to avoid the transaction setup per tile. */
+        m_tft.startWrite();
+
+        /* Each matrix row is transferred as one tile. With DMA the next tile
+         * is rasterized, while the previous one is still transferred.
+         */
+        for (ySrc = yBegin; ySrc < yEnd; ++ySrc)
         {
-#if CONFIG_DISPLAY_ROTATE180 != 0
-            Color brightnessAdjustedColor = m_ledMatrix.getColor(MATRIX_WIDTH - x - 1, MATRIX_HEIGHT - y - 1);
-#else
-            Color brightnessAdjustedColor = m_ledMatrix.getColor(x, y);
-#endif
-            uint16_t intensity  = brightnessAdjustedColor.getIntensity();
-            int32_t  xNative    = y * (PIXEL_HEIGHT + PiXEL_DISTANCE) + BORDER_Y;
-            int32_t  yNative    = TFT_HEIGHT - (x * (PIXEL_WIDTH + PiXEL_DISTANCE) + BORDER_X) - 1;
+            drawTile(m_tileBuffer[tileIndex], xBegin, xEnd, ySrc);
 
-            intensity          *= (static_cast<uint16_t>(m_brightness) + 1U);
-            intensity          /= 256U;
-            brightnessAdjustedColor.setIntensity(static_cast<uint8_t>(intensity));
+            ++tileIndex;
+            tileIndex %= TILE_BUFFER_COUNT;
+        }
 
-            m_tft.fillRect(
-                xNative,
-                yNative,
-                PIXEL_HEIGHT,
-                PIXEL_WIDTH,
-                brightnessAdjustedColor.toRgb565());
+#if defined(ESP32_DMA)
+        if (true == m_isDmaEnabled)
+        {
+            m_tft.dmaWait();
         }
+#endif /* defined(ESP32_DMA) */
+
+        m_tft.endWrite();
+
+        m_ledMatrix.clearDirtyArea();
     }
 }
 
@@ -154,6 +167,77 @@ bool Display::isOn() const
     return m_isOn;
 }
 
+void Display::drawTile(uint16_t* tile, int32_t xBegin, int32_t xEnd, int32_t ySrc)
+{
+    const int32_t  count  = xEnd - xBegin;
+    uint16_t       offset = 0U;
+    const Color*   src    = m_ledMatrix.getFrameBufferXAddr(xBegin, ySrc, count, offset);
+
+#if CONFIG_DISPLAY_ROTATE180 != 0
+    const int32_t  xMax   = MATRIX_WIDTH - xBegin - 1;
+    const int32_t  y      = MATRIX_HEIGHT - ySrc - 1;
+#else
+    const int32_t  xMax   = xEnd - 1;
+    const int32_t  y      = ySrc;
+#endif
+
+    if (nullptr != src)
+    {
+        const int32_t xNative    = y * (PIXEL_HEIGHT + PiXEL_DISTANCE) + BORDER_Y;
+        const int32_t yNative    = TFT_HEIGHT - (xMax * (PIXEL_WIDTH + PiXEL_DISTANCE) + BORDER_X) - 1;
+        const int32_t tileHeight = (count - 1) * (PIXEL_WIDTH + PiXEL_DISTANCE) + PIXEL_WIDTH;
+        uint16_t*     dst        = tile;
+        int32_t       led;
+
+        /* The matrix x-axis runs bottom up on the T-Display, therefore the
+         * tile starts with the virtual LED with the highest x-coordinate.
+         */
+        for (led = 0; led < count; ++led)
+        {
+#if CONFIG_DISPLAY_ROTATE180 != 0
+            Color    brightnessAdjustedColor = src[led * offset];
+#else
+            Color    brightnessAdjustedColor = src[(count - led - 1) * offset];
+#endif
+            uint16_t intensity               = brightnessAdjustedColor.getIntensity();
+            uint16_t rgb565;
+            int32_t  idx;
+
+            intensity                       *= (static_cast<uint16_t>(m_brightness) + 1U);
+            intensity                       /= 256U;
+            brightnessAdjustedColor.setIntensity(static_cast<uint8_t>(intensity));
+            rgb565                           = brightnessAdjustedColor.toRgb565();
+
+            for (idx = 0; idx < (PIXEL_WIDTH * PIXEL_HEIGHT); ++idx)
+            {
+                *dst = rgb565;
+                ++dst;
+            }
+
+            /* The distance between two virtual LEDs is background. */
+            if ((count - 1) > led)
+            {
+                for (idx = 0; idx < (PiXEL_DISTANCE * PIXEL_HEIGHT); ++idx)
+                {
+                    *dst = TFT_BLACK;
+                    ++dst;
+                }
+            }
+        }
+
+#if defined(ESP32_DMA)
+        if (true == m_isDmaEnabled)
+        {
+            m_tft.pushImageDMA(xNative, yNative, PIXEL_HEIGHT, tileHeight, tile);
+        }
+        else
+#endif /* defined(ESP32_DMA) */
+        {
+            m_tft.pushImage(xNative, yNative, PIXEL_HEIGHT, tileHeight, tile);
+        }
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -88,6 +88,14 @@ public:
     {
         m_tft.init();
         m_tft.fillScreen(TFT_BLACK);
+
+        /* The tiles are in native RGB565 byte order. */
+        m_tft.setSwapBytes(true);
+
+#if defined(ESP32_DMA)
+        m_isDmaEnabled = m_tft.initDMA();
+#endif /* defined(ESP32_DMA) */
+
         m_isOn = true;
 
         return true;
@@ -110,6 +118,24 @@ public:
         return true;
     }
 
+    /**
+     * Wait until the display is ready for another update via show().
+     * In contrast to polling isReady(), the calling task is blocked until
+     * the physical display signals that the transfer is finished or the
+     * timeout elapsed.
+     *
+     * @param[in] timeout   Max. time to wait in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool waitUntilReady(uint32_t timeout) final
+    {
+        /* The display update is synchronous, there is nothing to wait for. */
+        (void)timeout;
+
+        return true;
+    }
+
     /**
      * Set brightness from 0 to 255.
      * 255 = max. brightness.
@@ -118,7 +144,14 @@ public:
      */
     void setBrightness(uint8_t brightness) final
     {
-        m_brightness = brightness;
+        /* The brightness is applied per virtual LED, therefore all of them
+         * need to be redrawn after a change.
+         */
+        if (brightness != m_brightness)
+        {
+            m_brightness = brightness;
+            m_ledMatrix.markAllDirty();
+        }
     }
 
     /**
@@ -297,11 +330,23 @@ private:
     /** TFT default brightness */
     static const uint8_t                           DEFAULT_BRIGHTNESS = TFT_DEFAULT_BRIGHTNESS;
 
+    /** Number of tile buffers, which are used alternately. One is filled while the other is transferred. */
+    static const uint8_t TILE_BUFFER_COUNT                            = 2U;
+
+    /** Tile buffer size in T-Display pixels, which is sufficient for one complete matrix row. */
+    static const uint32_t TILE_BUFFER_SIZE                            = PIXEL_HEIGHT * (MATRIX_WIDTH * (PIXEL_WIDTH + PiXEL_DISTANCE));
+
     TFT_eSPI                                       m_tft;        /**< T-Display driver */
     YAGfxStaticBitmap<MATRIX_WIDTH, MATRIX_HEIGHT> m_ledMatrix;  /**< Simulated LED matrix framebuffer */
     uint8_t                                        m_brightness; /**< Display brightness [0; 255] value. 255 = max. brightness. */
     bool                                           m_isOn;       /**< Is display on? */
 
+#if defined(ESP32_DMA)
+    bool                                           m_isDmaEnabled; /**< Is the DMA transfer available? */
+#endif /* defined(ESP32_DMA) */
+
+    uint16_t                                       m_tileBuffer[TILE_BUFFER_COUNT][TILE_BUFFER_SIZE]; /**< RGB565 tile buffers */
+
     /**
      * Construct display.
      */
@@ -315,6 +360,17 @@ private:
     Display(const Display& display);
     Display& operator=(const Display& display);
 
+    /**
+     * Rasterize the virtual LEDs of a part of a matrix row into a tile
+     * and push the tile with a single windowed transfer to the T-Display.
+     *
+     * @param[in] tile      Tile buffer with at least TILE_BUFFER_SIZE pixels.
+     * @param[in] xBegin    x-coordinate of the first virtual LED in the framebuffer
+     * @param[in] xEnd      x-coordinate after the last virtual LED in the framebuffer
+     * @param[in] ySrc      y-coordinate of the row in the framebuffer
+     */
+    void drawTile(uint16_t* tile, int32_t xBegin, int32_t xEnd, int32_t ySrc);
+
     /**
      * Draw a single pixel on the display.
      *
@@ -326,6 +382,19 @@ private:
     {
         m_ledMatrix.drawPixel(x, y, color);
     }
+
+    /**
+     * Mark a rectangle as changed. It is forwarded to the LED matrix framebuffer.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_ledMatrix.markDirty(x, y, width, height);
+    }
 };
 
 /******************************************************************************
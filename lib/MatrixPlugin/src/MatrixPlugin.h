@@ -117,6 +117,18 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Get the desired frame interval in ms.
+     * The display content changes only with the update period. Half of it
+     * is requested, so that no timeout is missed because of scheduling jitter.
+     *
+     * @return Frame interval in ms
+     */
+    uint32_t getFrameInterval() const final
+    {
+        return UPDATE_PERIOD / 2U;
+    }
+
 private:
 
     /** Display update period in ms. */
@@ -70,6 +70,17 @@ public:
      */
     typedef IPluginMaintenance* (*CreateFunc)(const char* name, uint16_t uid);
 
+    /**
+     * Default frame interval in ms, which fits to most of the plugins.
+     */
+    static const uint32_t FRAME_INTERVAL_DEFAULT = 20U;
+
+    /**
+     * Frame interval which requests the fastest possible display update,
+     * e.g. for streaming plugins.
+     */
+    static const uint32_t FRAME_INTERVAL_FASTEST = 0U;
+
     /**
      * Destroys the interface.
      */
@@ -311,6 +322,16 @@ public:
      */
     virtual void update(YAGfx& gfx)                                                                    = 0;
 
+    /**
+     * Get the desired frame interval in ms. It is the period in which
+     * update() shall be called, as long as the slot is active. Plugins
+     * with slow changing content shall request a longer interval to save
+     * processing time and power.
+     *
+     * @return Frame interval in ms or FRAME_INTERVAL_FASTEST.
+     */
+    virtual uint32_t getFrameInterval() const                                                          = 0;
+
 protected:
 
     /**
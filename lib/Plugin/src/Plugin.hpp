@@ -369,6 +369,17 @@ public:
     {
     }
 
+    /**
+     * Get the desired frame interval in ms.
+     * Overwrite it if your plugin needs a different display update period.
+     *
+     * @return Frame interval in ms
+     */
+    uint32_t getFrameInterval() const override
+    {
+        return FRAME_INTERVAL_DEFAULT;
+    }
+
     /**
      * Generate the full path for any plugin instance specific kind of configuration
      * file.
@@ -129,6 +129,49 @@ String FileUtil::getFileExtension(const String& filePath)
     return fileExtension;
 }
 
+bool FileUtil::getCrc32(FS& fs, const String& filePath, uint32_t& crc)
+{
+    bool isSuccessful = false;
+    File fd           = fs.open(filePath, "r");
+
+    if (true == fd)
+    {
+        const uint32_t POLYNOMIAL = 0xEDB88320U; /* Reversed 0x04C11DB7 */
+        uint8_t        buffer[64U];
+        size_t         length;
+
+        crc = 0xFFFFFFFFU;
+
+        do
+        {
+            size_t idx;
+
+            length = fd.read(buffer, sizeof(buffer));
+
+            for (idx = 0U; idx < length; ++idx)
+            {
+                uint8_t bit;
+
+                crc ^= buffer[idx];
+
+                for (bit = 0U; bit < 8U; ++bit)
+                {
+                    crc = (crc >> 1U) ^ ((0U != (crc & 1U)) ? POLYNOMIAL : 0U);
+                }
+            }
+        }
+        while (0U < length);
+
+        crc ^= 0xFFFFFFFFU;
+
+        fd.close();
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
\ No newline at end of file
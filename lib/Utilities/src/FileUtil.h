@@ -46,6 +46,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <WString.h>
+#include <FS.h>
 
 /******************************************************************************
  * Macros
@@ -86,6 +87,17 @@ extern String getFileName(const String& filePath);
  */
 extern String getFileExtension(const String& filePath);
 
+/**
+ * Calculate the CRC-32 (IEEE 802.3) of a file content.
+ *
+ * @param[in]   fs          Filesystem
+ * @param[in]   filePath    File path
+ * @param[out]  crc         CRC-32 of the file content
+ *
+ * @return If successful calculated, it will return true otherwise false.
+ */
+extern bool getCrc32(FS& fs, const String& filePath, uint32_t& crc);
+
 }; /* namespace FileUtil */
 
 /******************************************************************************
@@ -483,7 +483,7 @@ void WormPlugin::drawWorm(uint8_t wormId, YAGfx& gfx)
     {
         size_t  wormPos         = wormPosInArray(wormId);
         size_t  idx             = 1U; /* 0 is the head, body starts at 1. */
-        Color   bodyColor       = m_wormBodyColor[wormId];
+        Color   bodyColor;
         uint8_t brightnessDelta = UINT8_MAX / (m_wormLen[wormId] - 1U); /* Consider only the body without head. */
 
         /* Draw worm head */
@@ -492,7 +492,10 @@ void WormPlugin::drawWorm(uint8_t wormId, YAGfx& gfx)
         /* Draw worm body */
         while (m_wormLen[wormId] > idx)
         {
-            /* The body gets darker till the end. */
+            /* The body gets darker till the end. Dim always the original
+             * color, because the intensity may be applied destructive.
+             */
+            bodyColor = m_wormBodyColor[wormId];
             bodyColor.setIntensity(UINT8_MAX - brightnessDelta * (idx - 1U));
 
             gfx.fillRect(m_worms[wormPos + idx].x * WORM_SIZE, m_worms[wormPos + idx].y * WORM_SIZE, WORM_SIZE, WORM_SIZE, bodyColor);
@@ -74,6 +74,8 @@ namespace ColorUtil
 
 /**
  * Get red component from RGB565 color.
+ * The 5 bit value is widened by repeating its upper bits, so the full
+ * intensity results in 255.
  *
  * @param[in] value RGB565 color value
  *
@@ -81,11 +83,15 @@ namespace ColorUtil
  */
 static inline uint8_t rgb565Red(uint16_t value)
 {
-    return ((value >> 11U) & 0x1fU) << 3U;
+    uint8_t red = (value >> 11U) & 0x1fU;
+
+    return (red << 3U) | (red >> 2U);
 }
 
 /**
  * Get green component from RGB565 color.
+ * The 6 bit value is widened by repeating its upper bits, so the full
+ * intensity results in 255.
  *
  * @param[in] value RGB565 color value
  *
@@ -93,11 +99,15 @@ static inline uint8_t rgb565Red(uint16_t value)
  */
 static inline uint8_t rgb565Green(uint16_t value)
 {
-    return ((value >> 5U) & 0x3fU) << 2U;
+    uint8_t green = (value >> 5U) & 0x3fU;
+
+    return (green << 2U) | (green >> 4U);
 }
 
 /**
  * Get blue component from RGB565 color.
+ * The 5 bit value is widened by repeating its upper bits, so the full
+ * intensity results in 255.
  *
  * @param[in] value RGB565 color value
  *
@@ -105,7 +115,9 @@ static inline uint8_t rgb565Green(uint16_t value)
  */
 static inline uint8_t rgb565Blue(uint16_t value)
 {
-    return ((value >> 0U) & 0x1fU) << 3U;
+    uint8_t blue = (value >> 0U) & 0x1fU;
+
+    return (blue << 3U) | (blue >> 2U);
 }
 
 /**
@@ -57,9 +57,14 @@
 
 /**
  * Color, which is based on the three base colors red, green and blue.
- * The base colors are internal stored in RGB565 format.
- * Additional one byte is used for color intensity, used for non-destructive
- * fading.
+ * The base colors are internal stored in RGB565 format, which needs only
+ * 16 bit per pixel.
+ *
+ * In contrast to Rgb888, there is no room for the color intensity. A set
+ * intensity is applied to the base colors immediately and can't be undone.
+ * Therefore a color keeps always max. intensity and anything which dims
+ * a color non-destructive, like a brush or a fade effect, shall apply the
+ * intensity to a copy of the original color.
  */
 class Rgb565
 {
@@ -75,8 +80,7 @@ public:
      * Constructs the color black.
      */
     Rgb565() :
-        m_color565(0U),
-        m_intensity(MAX_BRIGHT)
+        m_color565(0U)
     {
     }
 
@@ -89,21 +93,19 @@ public:
 
     /**
      * Specialized constructor, used in case every base color (RGB) is given.
-     * The color intensity will be set to max. bright.
      *
      * @param[in] red   Red value
      * @param[in] green Green value
      * @param[in] blue  Blue value
      */
     Rgb565(uint8_t red, uint8_t green, uint8_t blue) :
-        m_color565(ColorUtil::to565(red, green, blue)),
-        m_intensity(MAX_BRIGHT)
+        m_color565(ColorUtil::to565(red, green, blue))
     {
     }
 
     /**
      * Specialized constructor, used in case every base color (RGB) and
-     * the intensity is given.
+     * the intensity is given. The intensity is applied to the base colors.
      *
      * @param[in] red       Red value
      * @param[in] green     Green value
@@ -111,20 +113,17 @@ public:
      * @param[in] intensity Color intensity [0; 255]
      */
     Rgb565(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity) :
-        m_color565(ColorUtil::to565(red, green, blue)),
-        m_intensity(intensity)
+        m_color565(ColorUtil::to565(applyIntensity(red, intensity), applyIntensity(green, intensity), applyIntensity(blue, intensity)))
     {
     }
 
     /**
      * Specialized constructor, used in case a color value (RGB) is given as uint32 type.
-     * Color intensity will be set to max. bright.
      *
      * @param[in] value Color value in 24 bit format
      */
     Rgb565(uint32_t value) :
-        m_color565(ColorUtil::to565(value)),
-        m_intensity(MAX_BRIGHT)
+        m_color565(ColorUtil::to565(value))
     {
     }
 
@@ -134,8 +133,7 @@ public:
      * @param[in] color Color, which to copy
      */
     Rgb565(const Rgb565& color) :
-        m_color565(color.m_color565),
-        m_intensity(color.m_intensity)
+        m_color565(color.m_color565)
     {
     }
 
@@ -150,8 +148,7 @@ public:
     {
         if (this != &color)
         {
-            m_color565  = color.m_color565;
-            m_intensity = color.m_intensity;
+            m_color565 = color.m_color565;
         }
 
         return *this;
@@ -166,7 +163,7 @@ public:
      */
     bool operator==(const Rgb565& other) const
     {
-        return (m_color565 == other.m_color565) && (m_intensity == other.m_intensity);
+        return (m_color565 == other.m_color565);
     }
 
     /**
@@ -178,11 +175,11 @@ public:
      */
     bool operator!=(const Rgb565& other) const
     {
-        return (m_color565 != other.m_color565) || (m_intensity != other.m_intensity);
+        return (m_color565 != other.m_color565);
     }
 
     /**
-     * Convert to RGB24 uint32_t value with respect to current intensity.
+     * Convert to RGB24 uint32_t value.
      */
     operator uint32_t() const
     {
@@ -190,7 +187,7 @@ public:
     }
 
     /**
-     * Get base color information with respect to current intensity.
+     * Get base color information.
      *
      * @param[out] red      Red value
      * @param[out] green    Green value
@@ -205,7 +202,6 @@ public:
 
     /**
      * Set base color information.
-     * Intensity is not changed.
      *
      * @param[in] red   Red value
      * @param[in] green Green value
@@ -218,6 +214,7 @@ public:
 
     /**
      * Set base color information, incl. intensity.
+     * The intensity is applied to the base colors.
      *
      * @param[in] red       Red value
      * @param[in] green     Green value
@@ -226,13 +223,11 @@ public:
      */
     void set(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity)
     {
-        m_color565  = ColorUtil::to565(red, green, blue);
-        m_intensity = intensity;
+        m_color565 = ColorUtil::to565(applyIntensity(red, intensity), applyIntensity(green, intensity), applyIntensity(blue, intensity));
     }
 
     /**
      * Set new color information by RGB24 value.
-     * The intensity won't change.
      *
      * @param[in] value Color value (RGB) in 24 bit format
      */
@@ -248,7 +243,7 @@ public:
      */
     uint8_t getRed() const
     {
-        return applyIntensity(ColorUtil::rgb565Red(m_color565));
+        return ColorUtil::rgb565Red(m_color565);
     }
 
     /**
@@ -258,7 +253,7 @@ public:
      */
     uint8_t getGreen() const
     {
-        return applyIntensity(ColorUtil::rgb565Green(m_color565));
+        return ColorUtil::rgb565Green(m_color565);
     }
 
     /**
@@ -268,17 +263,19 @@ public:
      */
     uint8_t getBlue() const
     {
-        return applyIntensity(ColorUtil::rgb565Blue(m_color565));
+        return ColorUtil::rgb565Blue(m_color565);
     }
 
     /**
      * Get color intensity.
+     * The intensity is always applied to the base colors, therefore it is
+     * always the max. intensity.
      *
      * @return Color intensity [0; 255] - 0: min. bright / 255: max. bright
      */
     uint8_t getIntensity() const
     {
-        return m_intensity;
+        return MAX_BRIGHT;
     }
 
     /**
@@ -313,12 +310,17 @@ public:
 
     /**
      * Set color intensity.
+     * The base colors are dimmed destructive, e.g. setting max. intensity
+     * afterwards won't restore them.
      *
      * @param[in] intensity Color intensity [0; 255] - 0: min. bright / 255: max. bright
      */
     void setIntensity(uint8_t intensity)
     {
-        m_intensity = intensity;
+        if (MAX_BRIGHT != intensity)
+        {
+            set(getRed(), getGreen(), getBlue(), intensity);
+        }
     }
 
     /**
@@ -332,6 +334,7 @@ public:
 
     /**
      * Convert color information to RGB565 format.
+     * It is the internal format, therefore no conversion is necessary.
      *
      * @return Color value (RGB) in 16 bit format
      */
@@ -342,7 +345,6 @@ public:
 
     /**
      * Set new color information by RGB565 value.
-     * The intensity won't change.
      *
      * @param[in] value Color value (RGB) in 16 bit format
      */
@@ -353,17 +355,19 @@ public:
 
 private:
 
-    uint16_t m_color565;  /**< Color value in 5-6-5 RGB format */
-    uint8_t  m_intensity; /**< Color intensity [0; 255] - 0: min. bright / 255: max. bright */
+    uint16_t m_color565; /**< Color value in 5-6-5 RGB format */
 
     /**
-     * Calculate the base color with respect to the current intensity.
+     * Calculate the base color with respect to the given intensity.
+     *
+     * @param[in] baseColor Base color
+     * @param[in] intensity Color intensity [0; 255]
      *
      * @return Base color with considered intensity.
      */
-    inline uint8_t applyIntensity(uint8_t baseColor) const
+    static inline uint8_t applyIntensity(uint8_t baseColor, uint8_t intensity)
     {
-        return (static_cast<uint16_t>(baseColor) * static_cast<uint16_t>(m_intensity)) / MAX_BRIGHT;
+        return (static_cast<uint16_t>(baseColor) * static_cast<uint16_t>(intensity)) / MAX_BRIGHT;
     }
 };
 
@@ -0,0 +1,396 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   Rgb888Packed.h
+ * @brief  Color in RGB888 format, packed in a single word
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef RGB888_PACKED_H
+#define RGB888_PACKED_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <ColorUtil.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Color, which is based on the three base colors red, green and blue.
+ * In contrast to Rgb888, the base colors and the intensity are packed in a
+ * single 32-bit word (0xIIRRGGBB). Copying and comparing a color is a single
+ * word operation and at max. intensity, which is the usual case for drawn
+ * pixels, no intensity calculation is necessary to get the base colors.
+ */
+class Rgb888Packed
+{
+public:
+
+    /** Max. color intensity */
+    static const uint8_t MAX_BRIGHT = UINT8_MAX;
+
+    /** Min. color intensity */
+    static const uint8_t MIN_BRIGHT = 0U;
+
+    /**
+     * Constructs the color black.
+     */
+    Rgb888Packed() :
+        m_value(INTENSITY_MASK)
+    {
+    }
+
+    /**
+     * Destroys the color.
+     * It is trivial, so that spans of colors can be copied like plain memory.
+     */
+    ~Rgb888Packed() = default;
+
+    /**
+     * Specialized constructor, used in case every base color (RGB) is given.
+     * The color intensity will be set to max. bright.
+     *
+     * @param[in] red   Red value
+     * @param[in] green Green value
+     * @param[in] blue  Blue value
+     */
+    Rgb888Packed(uint8_t red, uint8_t green, uint8_t blue) :
+        m_value(INTENSITY_MASK | ColorUtil::to888(red, green, blue))
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case every base color (RGB) and
+     * the intensity is given.
+     *
+     * @param[in] red       Red value
+     * @param[in] green     Green value
+     * @param[in] blue      Blue value
+     * @param[in] intensity Color intensity [0; 255]
+     */
+    Rgb888Packed(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity) :
+        m_value(pack(ColorUtil::to888(red, green, blue), intensity))
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case a color value (RGB) is given as uint32 type.
+     * Color intensity will be set to max. bright.
+     *
+     * @param[in] value Color value in 24 bit format
+     */
+    Rgb888Packed(uint32_t value) :
+        m_value(INTENSITY_MASK | (value & RGB_MASK))
+    {
+    }
+
+    /**
+     * Copy the given color.
+     *
+     * @param[in] color Color, which to copy
+     */
+    Rgb888Packed(const Rgb888Packed& color) = default;
+
+    /**
+     * Assign RGB color.
+     *
+     * @param[in] color Color, which to assign
+     *
+     * @return RGB Color
+     */
+    Rgb888Packed& operator=(const Rgb888Packed& color) = default;
+
+    /**
+     * Compare color for equality.
+     *
+     * @param[in] other Other color to compare with.
+     *
+     * @return If both colors are equal, it will return true otherwise false.
+     */
+    bool operator==(const Rgb888Packed& other) const
+    {
+        return (m_value == other.m_value);
+    }
+
+    /**
+     * Compare color for non-equality.
+     *
+     * @param[in] other Other color to compare with.
+     *
+     * @return If both colors are not equal, it will return true otherwise false.
+     */
+    bool operator!=(const Rgb888Packed& other) const
+    {
+        return (m_value != other.m_value);
+    }
+
+    /**
+     * Convert to RGB24 uint32_t value with respect to current intensity.
+     */
+    operator uint32_t() const
+    {
+        uint32_t value = m_value & RGB_MASK;
+
+        if (MAX_BRIGHT != getIntensity())
+        {
+            value = ColorUtil::to888(getRed(), getGreen(), getBlue());
+        }
+
+        return value;
+    }
+
+    /**
+     * Get base color information with respect to current intensity.
+     *
+     * @param[out] red      Red value
+     * @param[out] green    Green value
+     * @param[out] blue     Blue value
+     */
+    void get(uint8_t& red, uint8_t& green, uint8_t& blue) const
+    {
+        red   = getRed();
+        green = getGreen();
+        blue  = getBlue();
+    }
+
+    /**
+     * Set base color information.
+     * Intensity is not changed.
+     *
+     * @param[in] red   Red value
+     * @param[in] green Green value
+     * @param[in] blue  Blue value
+     */
+    void set(uint8_t red, uint8_t green, uint8_t blue)
+    {
+        m_value = (m_value & INTENSITY_MASK) | ColorUtil::to888(red, green, blue);
+    }
+
+    /**
+     * Set base color information and intensity.
+     *
+     * @param[in] red       Red value
+     * @param[in] green     Green value
+     * @param[in] blue      Blue value
+     * @param[in] intensity Color intensity [0; 255]
+     */
+    void set(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity)
+    {
+        m_value = pack(ColorUtil::to888(red, green, blue), intensity);
+    }
+
+    /**
+     * Set new color information by RGB24 value.
+     * The intensity won't change.
+     *
+     * @param[in] value Color value (RGB) in 24 bit format
+     */
+    void set(const uint32_t& value)
+    {
+        m_value = (m_value & INTENSITY_MASK) | (value & RGB_MASK);
+    }
+
+    /**
+     * Get red color value.
+     *
+     * @return Red value
+     */
+    uint8_t getRed() const
+    {
+        return applyIntensity(ColorUtil::rgb888Red(m_value));
+    }
+
+    /**
+     * Get green color value.
+     *
+     * @return Green value
+     */
+    uint8_t getGreen() const
+    {
+        return applyIntensity(ColorUtil::rgb888Green(m_value));
+    }
+
+    /**
+     * Get blue color value.
+     *
+     * @return Blue value
+     */
+    uint8_t getBlue() const
+    {
+        return applyIntensity(ColorUtil::rgb888Blue(m_value));
+    }
+
+    /**
+     * Get color intensity.
+     *
+     * @return Color intensity [0; 255] - 0: min. bright / 255: max. bright
+     */
+    uint8_t getIntensity() const
+    {
+        return static_cast<uint8_t>(m_value >> INTENSITY_SHIFT);
+    }
+
+    /**
+     * Set red color value.
+     *
+     * @param[in] value Red value
+     */
+    void setRed(uint8_t value)
+    {
+        m_value = (m_value & ~(static_cast<uint32_t>(UINT8_MAX) << 16U)) | (static_cast<uint32_t>(value) << 16U);
+    }
+
+    /**
+     * Set green color value.
+     *
+     * @param[in] value Green value
+     */
+    void setGreen(uint8_t value)
+    {
+        m_value = (m_value & ~(static_cast<uint32_t>(UINT8_MAX) << 8U)) | (static_cast<uint32_t>(value) << 8U);
+    }
+
+    /**
+     * Set blue color value.
+     *
+     * @param[in] value Blue value
+     */
+    void setBlue(uint8_t value)
+    {
+        m_value = (m_value & ~static_cast<uint32_t>(UINT8_MAX)) | static_cast<uint32_t>(value);
+    }
+
+    /**
+     * Set color intensity.
+     *
+     * @param[in] intensity Color intensity [0; 255] - 0: min. bright / 255: max. bright
+     */
+    void setIntensity(uint8_t intensity)
+    {
+        m_value = pack(m_value, intensity);
+    }
+
+    /**
+     * Set color according to the position in the color wheel.
+     * It provides typical rainbow colors, which means a color is based on
+     * only two base colors.
+     *
+     * @param[in] wheelPos  Color wheel position
+     */
+    void turnColorWheel(uint8_t wheelPos);
+
+    /**
+     * Convert color information to RGB565 format.
+     * The intensity will be considered in the conversion.
+     *
+     * @return Color value (RGB) in 16 bit format
+     */
+    uint16_t toRgb565() const
+    {
+        return ColorUtil::to565(static_cast<uint32_t>(*this));
+    }
+
+    /**
+     * Set new color information by RGB565 value.
+     * The intensity won't change.
+     *
+     * @param[in] value Color value (RGB) in 16 bit format
+     */
+    void fromRgb565(const uint16_t& value)
+    {
+        set(ColorUtil::to888(value));
+    }
+
+private:
+
+    /** Bit position of the intensity in the packed value. */
+    static const uint32_t INTENSITY_SHIFT = 24U;
+
+    /** Intensity bits in the packed value. */
+    static const uint32_t INTENSITY_MASK  = 0xFF000000U;
+
+    /** Base color bits in the packed value. */
+    static const uint32_t RGB_MASK        = 0x00FFFFFFU;
+
+    uint32_t m_value; /**< Packed color value: intensity, red, green and blue with 8 bit each. */
+
+    /**
+     * Pack base colors and intensity.
+     *
+     * @param[in] rgb       Base colors in RGB888 format, other bits are ignored.
+     * @param[in] intensity Color intensity [0; 255]
+     *
+     * @return Packed color value
+     */
+    static inline uint32_t pack(uint32_t rgb, uint8_t intensity)
+    {
+        return (static_cast<uint32_t>(intensity) << INTENSITY_SHIFT) | (rgb & RGB_MASK);
+    }
+
+    /**
+     * Calculate the base color with respect to the current intensity.
+     * At max. intensity the base color is returned unchanged.
+     *
+     * @return Base color with considered intensity.
+     */
+    inline uint8_t applyIntensity(uint8_t baseColor) const
+    {
+        uint8_t intensity = getIntensity();
+        uint8_t value     = baseColor;
+
+        if (MAX_BRIGHT != intensity)
+        {
+            value = (static_cast<uint16_t>(baseColor) * static_cast<uint16_t>(intensity)) / MAX_BRIGHT;
+        }
+
+        return value;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* RGB888_PACKED_H */
+
+/** @} */
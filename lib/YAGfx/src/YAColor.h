@@ -46,11 +46,22 @@
 #define CONFIG_COLOR_DEPTH 32
 #endif
 
+#ifndef CONFIG_COLOR_PACKED
+/**
+ * Use the packed RGB888 color (1), which stores base colors and intensity
+ * in a single word, instead of the byte-wise RGB888 color (0).
+ * Only considered for a color depth of 32 bit.
+ */
+#define CONFIG_COLOR_PACKED 0
+#endif
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
-#if (CONFIG_COLOR_DEPTH == 32)
+#if (CONFIG_COLOR_DEPTH == 32) && (CONFIG_COLOR_PACKED != 0)
+#include <Rgb888Packed.h>
+#elif (CONFIG_COLOR_DEPTH == 32)
 #include <Rgb888.h>
 #elif (CONFIG_COLOR_DEPTH == 16)
 #include <Rgb565.h>
@@ -66,7 +77,14 @@
  * Types and Classes
  *****************************************************************************/
 
-#if (CONFIG_COLOR_DEPTH == 32)
+#if (CONFIG_COLOR_DEPTH == 32) && (CONFIG_COLOR_PACKED != 0)
+
+/**
+ * Defines the general color to packed RGB888 format.
+ */
+typedef Rgb888Packed Color;
+
+#elif (CONFIG_COLOR_DEPTH == 32)
 
 /**
  * Defines the general color to RGB888 format.
@@ -71,6 +71,9 @@ using YAGfxStaticBitmap  = BaseGfxStaticBitmap<Color, width, height>;
 /** GFX dynamic bitmap with concrete color. */
 using YAGfxDynamicBitmap = BaseGfxDynamicBitmap<Color, TypedAllocator<Color, PsAllocator>>;
 
+/** GFX dynamic bitmap with concrete color and alpha channel. */
+using YAGfxAlphaBitmap   = BaseGfxAlphaBitmap<Color, TypedAllocator<Color, PsAllocator>, TypedAllocator<uint8_t, PsAllocator>>;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
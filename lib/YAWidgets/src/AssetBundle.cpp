@@ -0,0 +1,261 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   AssetBundle.cpp
+ * @brief  Asset bundle in a read-only flash partition
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "AssetBundle.h"
+
+#include <Logging.h>
+#include <string.h>
+
+#ifndef NATIVE
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#endif /* NATIVE */
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize asset partition label. */
+const char*   AssetBundle::PARTITION_LABEL = "assets";
+
+/* Initialize bundle signature. */
+const uint8_t AssetBundle::SIGNATURE[3U]   = { 'P', 'X', 'B' };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool AssetBundle::begin()
+{
+    bool isSuccessful = false;
+
+    end();
+
+#ifndef NATIVE
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, PARTITION_LABEL);
+
+    if (nullptr == partition)
+    {
+        LOG_INFO("No asset partition available.");
+    }
+    else
+    {
+        Header header;
+
+        /* Read the header first, to map only the used part of the partition. */
+        if (ESP_OK != esp_partition_read(partition, 0U, &header, sizeof(header)))
+        {
+            LOG_WARNING("Failed to read asset bundle header.");
+        }
+        else if ((0 != memcmp(header.signature, SIGNATURE, sizeof(SIGNATURE))) ||
+                 (sizeof(header) > header.size) ||
+                 (partition->size < header.size))
+        {
+            LOG_INFO("No asset bundle in asset partition.");
+        }
+        else
+        {
+            const void*             data   = nullptr;
+            spi_flash_mmap_handle_t handle = 0U;
+
+            if (ESP_OK != esp_partition_mmap(partition, 0U, header.size, SPI_FLASH_MMAP_DATA, &data, &handle))
+            {
+                LOG_WARNING("Failed to map asset partition.");
+            }
+            else if (false == open(static_cast<const uint8_t*>(data), header.size))
+            {
+                spi_flash_munmap(handle);
+            }
+            else
+            {
+                m_mapHandle  = handle;
+                m_isMapped   = true;
+
+                isSuccessful = true;
+            }
+        }
+    }
+#endif /* NATIVE */
+
+    return isSuccessful;
+}
+
+void AssetBundle::end()
+{
+    close();
+
+#ifndef NATIVE
+    if (true == m_isMapped)
+    {
+        spi_flash_munmap(m_mapHandle);
+    }
+#endif /* NATIVE */
+
+    m_mapHandle = 0U;
+    m_isMapped  = false;
+}
+
+bool AssetBundle::open(const uint8_t* data, size_t size)
+{
+    bool   isValid = true;
+    Header header;
+
+    close();
+
+    if ((nullptr == data) ||
+        (sizeof(header) > size))
+    {
+        isValid = false;
+    }
+    else
+    {
+        memcpy(&header, data, sizeof(header));
+
+        if (0 != memcmp(header.signature, SIGNATURE, sizeof(SIGNATURE)))
+        {
+            LOG_WARNING("Invalid asset bundle.");
+            isValid = false;
+        }
+        else if (VERSION != header.version)
+        {
+            LOG_WARNING("Asset bundle version %u not supported.", header.version);
+            isValid = false;
+        }
+        else if ((size < header.size) ||
+                 (((header.size - sizeof(header)) / sizeof(Entry)) < header.entryCount))
+        {
+            LOG_WARNING("Asset bundle is corrupt.");
+            isValid = false;
+        }
+        else
+        {
+            const Entry* entries = reinterpret_cast<const Entry*>(&data[sizeof(header)]);
+            uint16_t     idx     = 0U;
+
+            /* Every asset shall be inside the bundle and its name terminated. */
+            while ((true == isValid) && (header.entryCount > idx))
+            {
+                const Entry& entry = entries[idx];
+
+                if ((header.size < entry.offset) ||
+                    ((header.size - entry.offset) < entry.size) ||
+                    (nullptr == memchr(entry.name, '\0', sizeof(entry.name))))
+                {
+                    LOG_WARNING("Asset bundle entry %u is corrupt.", idx);
+                    isValid = false;
+                }
+                else
+                {
+                    ++idx;
+                }
+            }
+
+            if (true == isValid)
+            {
+                m_data       = data;
+                m_entries    = entries;
+                m_entryCount = header.entryCount;
+
+                LOG_INFO("Asset bundle with %u assets opened.", m_entryCount);
+            }
+        }
+    }
+
+    return isValid;
+}
+
+void AssetBundle::close()
+{
+    m_data       = nullptr;
+    m_entries    = nullptr;
+    m_entryCount = 0U;
+}
+
+bool AssetBundle::find(const String& name, const uint8_t*& data, size_t& size) const
+{
+    bool     isFound = false;
+    uint16_t idx     = 0U;
+
+    while ((false == isFound) && (m_entryCount > idx))
+    {
+        const Entry& entry = m_entries[idx];
+
+        if (0 == strcmp(entry.name, name.c_str()))
+        {
+            data    = &m_data[entry.offset];
+            size    = entry.size;
+
+            isFound = true;
+        }
+        else
+        {
+            ++idx;
+        }
+    }
+
+    return isFound;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,224 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   AssetBundle.h
+ * @brief  Asset bundle in a read-only flash partition
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <WString.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The asset bundle holds Pixelix images (.pxi) in a dedicated flash
+ * partition, which is memory mapped. Therefore the images can be drawn
+ * directly from flash without copying them to the heap.
+ *
+ * Every asset is found by the full path of the file, which it stands for
+ * in the filesystem, e.g. "/configuration/sun.bmp". The filesystem takes
+ * precedence: an asset is only used, if the file doesn't exist there.
+ *
+ * The bundle is created with scripts/assetbundle_build.py. All values are
+ * little endian. The bundle starts with the bundle header, followed by the
+ * entry table and the asset data.
+ */
+class AssetBundle
+{
+public:
+
+    /** Label of the asset partition. */
+    static const char*   PARTITION_LABEL;
+
+    /** Bundle signature "PXB" */
+    static const uint8_t SIGNATURE[3U];
+
+    /** Supported bundle version */
+    static const uint8_t VERSION         = 1U;
+
+    /** Max. size of an asset name in bytes, including the string termination. */
+    static const size_t  MAX_NAME_SIZE   = 56U;
+
+    /**
+     * Bundle header (size: 16 bytes).
+     */
+    typedef struct _Header
+    {
+        uint8_t  signature[3U]; /**< Bundle signature "PXB" */
+        uint8_t  version;       /**< Bundle version */
+        uint16_t entryCount;    /**< Number of entries */
+        uint16_t reserved1;     /**< Reserved, shall be 0. */
+        uint32_t size;          /**< Bundle size in bytes, including this header. */
+        uint32_t reserved2;     /**< Reserved, shall be 0. */
+
+    } __attribute__((packed)) Header;
+
+    /**
+     * Entry in the entry table (size: 64 bytes).
+     */
+    typedef struct _Entry
+    {
+        char     name[MAX_NAME_SIZE]; /**< Full path of the asset, zero terminated. */
+        uint32_t offset;              /**< Offset of the asset data from the bundle start. */
+        uint32_t size;                /**< Size of the asset data in bytes. */
+
+    } __attribute__((packed)) Entry;
+
+    /**
+     * Get the asset bundle instance.
+     *
+     * @return Asset bundle instance
+     */
+    static AssetBundle& getInstance()
+    {
+        static AssetBundle instance; /* idiom */
+
+        return instance;
+    }
+
+    /**
+     * Map the asset partition and open the bundle inside.
+     *
+     * @return If a valid bundle is available, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Close the bundle and unmap the asset partition.
+     * All data, provided by the bundle, becomes invalid.
+     */
+    void end();
+
+    /**
+     * Open a bundle, which is already in memory.
+     * The data must stay valid, until the bundle is closed.
+     *
+     * @param[in] data  Bundle data
+     * @param[in] size  Size of the data in bytes
+     *
+     * @return If the bundle is valid, it will return true otherwise false.
+     */
+    bool open(const uint8_t* data, size_t size);
+
+    /**
+     * Close the bundle.
+     */
+    void close();
+
+    /**
+     * Is a bundle opened?
+     *
+     * @return If opened, it will return true otherwise false.
+     */
+    bool isOpen() const
+    {
+        return nullptr != m_data;
+    }
+
+    /**
+     * Get the number of assets in the bundle.
+     *
+     * @return Number of assets
+     */
+    uint16_t getCount() const
+    {
+        return m_entryCount;
+    }
+
+    /**
+     * Find an asset by its name.
+     *
+     * @param[in]  name  Full path of the asset
+     * @param[out] data  Asset data
+     * @param[out] size  Size of the asset data in bytes
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool find(const String& name, const uint8_t*& data, size_t& size) const;
+
+private:
+
+    const uint8_t* m_data;       /**< Bundle data */
+    const Entry*   m_entries;    /**< Entry table */
+    uint16_t       m_entryCount; /**< Number of entries */
+    uint32_t       m_mapHandle;  /**< Handle of the mapped partition */
+    bool           m_isMapped;   /**< Is the asset partition mapped? */
+
+    /**
+     * Constructs the asset bundle instance.
+     */
+    AssetBundle() :
+        m_data(nullptr),
+        m_entries(nullptr),
+        m_entryCount(0U),
+        m_mapHandle(0U),
+        m_isMapped(false)
+    {
+    }
+
+    /**
+     * Destroys the asset bundle instance.
+     */
+    ~AssetBundle()
+    {
+        end();
+    }
+
+    /* An instance shall not be copied. */
+    AssetBundle(const AssetBundle& bundle);
+    AssetBundle& operator=(const AssetBundle& bundle);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* ASSET_BUNDLE_H */
+
+/** @} */
@@ -35,10 +35,13 @@
  *****************************************************************************/
 #include "BitmapWidget.h"
 #include "BmpImgLoader.h"
+#include "AssetBundle.h"
+#include "PxiFormat.h"
 
 #include <YAColor.h>
 #include <Logging.h>
 #include <FileUtil.h>
+#include <string.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -69,10 +72,14 @@ const char* BitmapWidget::FILE_EXT_BITMAP         = "bmp";
 /* Initialize GIF image filename extension. */
 const char* BitmapWidget::FILE_EXT_GIF            = "gif";
 
+/* Initialize Pixelix image filename extension. */
+const char* BitmapWidget::FILE_EXT_PXI            = "pxi";
+
 /* Initialize supported image file extensions. */
 const char* BitmapWidget::IMAGE_FILE_EXTENSIONS[] = {
     FILE_EXT_BITMAP,
-    FILE_EXT_GIF
+    FILE_EXT_GIF,
+    FILE_EXT_PXI
 };
 
 /* Initialize number of supported image file extensions. */
@@ -92,6 +99,7 @@ BitmapWidget& BitmapWidget::operator=(const BitmapWidget& widget)
         m_bitmap        = widget.m_bitmap;
         m_gifFileLoader = widget.m_gifFileLoader;
         m_gifPlayer     = widget.m_gifPlayer;
+        m_pxiPlayer     = widget.m_pxiPlayer;
         m_hAlign        = widget.m_hAlign;
         m_vAlign        = widget.m_vAlign;
         m_hAlignPosX    = widget.m_hAlignPosX;
@@ -106,6 +114,7 @@ void BitmapWidget::set(const YAGfxBitmap& bitmap)
     /* Release unused memory. */
     m_bitmap.release();
     m_gifPlayer.close();
+    m_pxiPlayer.close();
 
     if (true == m_bitmap.create(bitmap.getWidth(), bitmap.getHeight()))
     {
@@ -128,6 +137,10 @@ void BitmapWidget::clear(const Color& color)
     {
         m_gifPlayer.close();
     }
+    else if (IMG_TYPE_PXI == m_imgType)
+    {
+        m_pxiPlayer.close();
+    }
     else
     {
         ;
@@ -138,13 +151,11 @@ void BitmapWidget::clear(const Color& color)
 
 bool BitmapWidget::load(FS& fs, const String& filename)
 {
-    bool isSuccessful = false;
+    bool           isSuccessful = false;
+    const uint8_t* assetData    = nullptr;
+    size_t         assetSize    = 0U;
 
-    if (false == fs.exists(filename))
-    {
-        LOG_WARNING("File %s doesn't exists.", filename.c_str());
-    }
-    else
+    if (true == fs.exists(filename))
     {
         String fileExtension = FileUtil::getFileExtension(filename);
 
@@ -154,25 +165,65 @@ bool BitmapWidget::load(FS& fs, const String& filename)
             /* BMP image? */
             if (true == fileExtension.equalsIgnoreCase(FILE_EXT_BITMAP))
             {
-                isSuccessful = loadBMP(fs, filename);
+                String sidecarFilename = getSidecarFilename(filename);
+
+                /* The sidecar image needs no color conversion. */
+                if (true == fs.exists(sidecarFilename))
+                {
+                    /* The bitmap image may be replaced without updating its
+                     * sidecar image, e.g. by the generic file upload.
+                     */
+                    if (true == isSidecarUpToDate(fs, filename, sidecarFilename))
+                    {
+                        isSuccessful = loadPXI(fs, sidecarFilename);
+                    }
+                    else
+                    {
+                        LOG_INFO("Sidecar image %s is outdated.", sidecarFilename.c_str());
+
+                        if (false == fs.remove(sidecarFilename))
+                        {
+                            LOG_WARNING("Failed to remove %s.", sidecarFilename.c_str());
+                        }
+                    }
+                }
+
+                if (false == isSuccessful)
+                {
+                    isSuccessful = loadBMP(fs, filename);
+                }
             }
             /* GIF image? */
             else if (true == fileExtension.equalsIgnoreCase(FILE_EXT_GIF))
             {
                 isSuccessful = loadGIF(fs, filename);
             }
+            /* Pixelix image? */
+            else if (true == fileExtension.equalsIgnoreCase(FILE_EXT_PXI))
+            {
+                isSuccessful = loadPXI(fs, filename);
+            }
             else
             {
                 /* Not supported. */
                 ;
             }
-
-            if (true == isSuccessful)
-            {
-                alignWidget();
-            }
         }
     }
+    /* Fallback to the asset bundle, whose images are drawn directly from flash. */
+    else if (true == AssetBundle::getInstance().find(filename, assetData, assetSize))
+    {
+        isSuccessful = loadAsset(filename, assetData, assetSize);
+    }
+    else
+    {
+        LOG_WARNING("File %s doesn't exists.", filename.c_str());
+    }
+
+    if (true == isSuccessful)
+    {
+        alignWidget();
+    }
 
     return isSuccessful;
 }
@@ -195,6 +246,33 @@ bool BitmapWidget::isImageTypeSupported(const String& path)
     return isSupported;
 }
 
+String BitmapWidget::getSidecarFilename(const String& filename)
+{
+    String sidecarFilename  = filename;
+
+    sidecarFilename        += ".";
+    sidecarFilename        += FILE_EXT_PXI;
+
+    return sidecarFilename;
+}
+
+bool BitmapWidget::isSidecarFile(const String& path)
+{
+    bool   isSidecar         = false;
+    String sidecarExtension  = ".";
+
+    sidecarExtension        += FILE_EXT_BITMAP;
+    sidecarExtension        += ".";
+    sidecarExtension        += FILE_EXT_PXI;
+
+    if (path.length() > sidecarExtension.length())
+    {
+        isSidecar = path.substring(path.length() - sidecarExtension.length()).equalsIgnoreCase(sidecarExtension);
+    }
+
+    return isSidecar;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -223,6 +301,11 @@ void BitmapWidget::alignWidget()
         imageHeight = m_gifPlayer.getHeight();
         break;
 
+    case IMG_TYPE_PXI:
+        imageWidth  = m_pxiPlayer.getWidth();
+        imageHeight = m_pxiPlayer.getHeight();
+        break;
+
     default:
         break;
     }
@@ -264,6 +347,29 @@ void BitmapWidget::alignWidget()
     }
 }
 
+bool BitmapWidget::isSidecarUpToDate(FS& fs, const String& filename, const String& sidecarFilename)
+{
+    bool     isUpToDate = false;
+    uint32_t crc        = 0U;
+    File     sidecarFd  = fs.open(sidecarFilename, "r");
+
+    if (true == sidecarFd)
+    {
+        PxiFormat::FileHeader fileHeader;
+
+        if ((sizeof(fileHeader) == sidecarFd.read(reinterpret_cast<uint8_t*>(&fileHeader), sizeof(fileHeader))) &&
+            (0 == memcmp(fileHeader.signature, PxiFormat::SIGNATURE, sizeof(fileHeader.signature))) &&
+            (true == FileUtil::getCrc32(fs, filename, crc)))
+        {
+            isUpToDate = (fileHeader.sourceCrc == crc);
+        }
+
+        sidecarFd.close();
+    }
+
+    return isUpToDate;
+}
+
 bool BitmapWidget::loadBMP(FS& fs, const String& filename)
 {
     bool              isSuccessful = false;
@@ -297,6 +403,7 @@ bool BitmapWidget::loadBMP(FS& fs, const String& filename)
     {
         /* Release unused memory. */
         m_gifPlayer.close();
+        m_pxiPlayer.close();
 
         /* Select image type. */
         m_imgType    = IMG_TYPE_BMP;
@@ -353,6 +460,7 @@ bool BitmapWidget::loadGIF(FS& fs, const String& filename)
     {
         /* Release unused memory. */
         m_bitmap.release();
+        m_pxiPlayer.close();
 
         /* Select image type. */
         m_imgType    = IMG_TYPE_GIF;
@@ -363,6 +471,76 @@ bool BitmapWidget::loadGIF(FS& fs, const String& filename)
     return isSuccessful;
 }
 
+bool BitmapWidget::loadAsset(const String& filename, const uint8_t* data, size_t size)
+{
+    bool              isSuccessful = false;
+    PxiImgPlayer::Ret ret          = m_pxiPlayer.openMapped(data, size);
+
+    if (PxiImgPlayer::RET_OK != ret)
+    {
+        LOG_ERROR("Asset %s is invalid (%d).", filename.c_str(), ret);
+    }
+    else
+    {
+        /* Release unused memory. */
+        m_bitmap.release();
+        m_gifPlayer.close();
+
+        /* Select image type. */
+        m_imgType    = IMG_TYPE_PXI;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool BitmapWidget::loadPXI(FS& fs, const String& filename)
+{
+    bool              isSuccessful = false;
+    PxiImgPlayer::Ret ret;
+
+    /* All frames are decoded at once, the file is not needed anymore afterwards. */
+    ret = m_pxiPlayer.open(fs, filename);
+
+    if (PxiImgPlayer::RET_OK != ret)
+    {
+        if (PxiImgPlayer::RET_FILE_NOT_FOUND == ret)
+        {
+            LOG_ERROR("Failed to open file %s.", filename.c_str());
+        }
+        else if (PxiImgPlayer::RET_FILE_FORMAT_INVALID == ret)
+        {
+            LOG_ERROR("File %s has invalid format.", filename.c_str());
+        }
+        else if (PxiImgPlayer::RET_FILE_FORMAT_UNSUPPORTED == ret)
+        {
+            LOG_ERROR("File %s has unsupported format.", filename.c_str());
+        }
+        else if (PxiImgPlayer::RET_IMG_TOO_BIG == ret)
+        {
+            LOG_ERROR("File %s is too big.", filename.c_str());
+        }
+        else
+        {
+            LOG_ERROR("Failed to load %s because of internal error.", filename.c_str());
+        }
+    }
+    else
+    {
+        /* Release unused memory. */
+        m_bitmap.release();
+        m_gifPlayer.close();
+
+        /* Select image type. */
+        m_imgType    = IMG_TYPE_PXI;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
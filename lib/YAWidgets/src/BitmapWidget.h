@@ -50,6 +50,7 @@
 #include "Widget.hpp"
 #include "GifFileToMemLoader.h"
 #include "GifImgPlayer.h"
+#include "PxiImgPlayer.h"
 #include "Alignment.h"
 
 /******************************************************************************
@@ -65,6 +66,10 @@
  * Supported are the following formats:
  * - Bitmap (.bmp)
  * - GIF image (.gif)
+ * - Pixelix image (.pxi)
+ *
+ * The filesystem takes precedence. If an image doesn't exist there, it is
+ * drawn from the asset bundle, see AssetBundle.
  */
 class BitmapWidget : public Widget
 {
@@ -84,6 +89,7 @@ public:
         m_bitmap(),
         m_gifFileLoader(),
         m_gifPlayer(),
+        m_pxiPlayer(),
         m_hAlign(Alignment::Horizontal::HORIZONTAL_LEFT),
         m_vAlign(Alignment::Vertical::VERTICAL_TOP),
         m_hAlignPosX(0),
@@ -102,6 +108,7 @@ public:
         m_bitmap(widget.m_bitmap),
         m_gifFileLoader(widget.m_gifFileLoader),
         m_gifPlayer(widget.m_gifPlayer),
+        m_pxiPlayer(widget.m_pxiPlayer),
         m_hAlign(widget.m_hAlign),
         m_vAlign(widget.m_vAlign),
         m_hAlignPosX(widget.m_hAlignPosX),
@@ -175,7 +182,9 @@ public:
     void clear(const Color& color);
 
     /**
-     * Load image from filesystem.
+     * Load image from the filesystem or if the file doesn't exist there,
+     * from the asset bundle. A bitmap image is loaded from its Pixelix
+     * sidecar image, if available.
      *
      * The canvas width and height won't be updated. If required, update them
      * explicit.
@@ -228,6 +237,28 @@ public:
      */
     static bool isImageTypeSupported(const String& path);
 
+    /**
+     * Get the filename of the Pixelix sidecar image of a bitmap image.
+     * The sidecar image holds the same pixels in the native color format
+     * and is preferred by load(), if it exists and was created from the
+     * current bitmap image. An outdated sidecar image is removed. It keeps the bitmap
+     * extension, e.g. "/images/sun.bmp.pxi" for "/images/sun.bmp".
+     *
+     * @param[in] filename  Bitmap image filename with full path
+     *
+     * @return Sidecar image filename with full path
+     */
+    static String getSidecarFilename(const String& filename);
+
+    /**
+     * Check, if the file is a Pixelix sidecar image of a bitmap image.
+     *
+     * @param[in] path  Image file path
+     *
+     * @return If it is a sidecar image, it will return true otherwise false.
+     */
+    static bool isSidecarFile(const String& path);
+
     /** Widget type string */
     static const char* WIDGET_TYPE;
 
@@ -241,6 +272,11 @@ public:
      */
     static const char* FILE_EXT_GIF;
 
+    /**
+     * Filename extension of Pixelix image file.
+     */
+    static const char* FILE_EXT_PXI;
+
     /**
      * Supported image file extensions.
      */
@@ -260,13 +296,15 @@ private:
     {
         IMG_TYPE_NO_IMAGE = 0, /**< No image */
         IMG_TYPE_BMP,          /**< BMP image */
-        IMG_TYPE_GIF           /**< GIF image */
+        IMG_TYPE_GIF,          /**< GIF image */
+        IMG_TYPE_PXI           /**< Pixelix image */
     };
 
     ImgType               m_imgType;       /**< Current image type. */
     YAGfxDynamicBitmap    m_bitmap;        /**< Bitmap image. */
     GifFileToMemLoader    m_gifFileLoader; /**< GIF file loader used to read the file from memory. */
     GifImgPlayer          m_gifPlayer;     /**< GIF image player. */
+    PxiImgPlayer          m_pxiPlayer;     /**< Pixelix image player. */
     Alignment::Horizontal m_hAlign;        /**< Horizontal alignment. */
     Alignment::Vertical   m_vAlign;        /**< Vertical alignment. */
     int16_t               m_hAlignPosX;    /**< x-coordinate derived from horizontal alignment. */
@@ -287,6 +325,10 @@ private:
         {
             (void)m_gifPlayer.play(gfx, m_hAlignPosX, m_vAlignPosY);
         }
+        else if (IMG_TYPE_PXI == m_imgType)
+        {
+            (void)m_pxiPlayer.play(gfx, m_hAlignPosX, m_vAlignPosY);
+        }
         else
         {
             ;
@@ -299,6 +341,19 @@ private:
      */
     void alignWidget();
 
+    /**
+     * Check, if the sidecar image of a bitmap image is up to date, which
+     * means it was created from the current bitmap image. Therefore the CRC
+     * of the bitmap image is compared with the one in the sidecar image.
+     *
+     * @param[in] fs                Filesystem
+     * @param[in] filename          Bitmap image filename with full path
+     * @param[in] sidecarFilename   Sidecar image filename with full path
+     *
+     * @return If up to date, it will return true otherwise false.
+     */
+    static bool isSidecarUpToDate(FS& fs, const String& filename, const String& sidecarFilename);
+
     /**
      * Load BMP image from filesystem.
      *
@@ -318,6 +373,28 @@ private:
      * @return If successful loaded it will return true otherwise false.
      */
     bool loadGIF(FS& fs, const String& filename);
+
+    /**
+     * Load Pixelix image from filesystem.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] filename  Filename with full path
+     *
+     * @return If successful loaded it will return true otherwise false.
+     */
+    bool loadPXI(FS& fs, const String& filename);
+
+    /**
+     * Load Pixelix image from the asset bundle. The image is drawn directly
+     * from the mapped flash.
+     *
+     * @param[in] filename  Filename with full path, used for logging.
+     * @param[in] data      Pixelix image data in the asset bundle
+     * @param[in] size      Size of the data in bytes
+     *
+     * @return If successful loaded it will return true otherwise false.
+     */
+    bool loadAsset(const String& filename, const uint8_t* data, size_t size);
 };
 
 /******************************************************************************
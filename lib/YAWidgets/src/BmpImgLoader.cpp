@@ -39,6 +39,11 @@
  * Compiler Switches
  *****************************************************************************/
 
+#ifndef CONFIG_BMP_IMG_LOADER_READ_BUFFER_SIZE
+/** Size of the read buffer in bytes. At least one row of pixel data is read at once. */
+#define CONFIG_BMP_IMG_LOADER_READ_BUFFER_SIZE  1024U
+#endif /* CONFIG_BMP_IMG_LOADER_READ_BUFFER_SIZE */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -135,6 +140,29 @@ typedef enum
 
 } CompressionMethod;
 
+/**
+ * Buffer for reading the pixel data blockwise from the file.
+ */
+typedef struct _BmpReadBuffer
+{
+    uint8_t* data;   /**< Buffer */
+    size_t   size;   /**< Buffer size in bytes */
+    size_t   length; /**< Number of valid bytes in the buffer */
+    size_t   idx;    /**< Index of the next byte to read */
+
+} BmpReadBuffer;
+
+/**
+ * RLE escape codes, which follow a zero count.
+ */
+typedef enum
+{
+    RLE_ESCAPE_END_OF_LINE   = 0, /**< End of line */
+    RLE_ESCAPE_END_OF_BITMAP = 1, /**< End of bitmap */
+    RLE_ESCAPE_DELTA         = 2  /**< Delta, followed by the horizontal and vertical offset */
+
+} RleEscape;
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
@@ -175,12 +203,14 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
             ret = RET_FILE_FORMAT_UNSUPPORTED;
         }
         /* Planes must be 1.
-         * Compression is not supported (except bitfields for 32-bit).
+         * Compression is not supported (except bitfields for 32-bit, RLE8 for 8-bit and RLE4 for 4-bit).
          * 1, 4, 8, 24 and 32 bits per pixel are supported.
          */
         else if ((1U != dibHeader.infoHeader.planes) ||
                  ((COMPRESSION_METHOD_RGB != dibHeader.infoHeader.compression) &&
-                     (COMPRESSION_METHOD_BITFIELDS != dibHeader.infoHeader.compression)) ||
+                     (COMPRESSION_METHOD_BITFIELDS != dibHeader.infoHeader.compression) &&
+                     ((COMPRESSION_METHOD_RLE8 != dibHeader.infoHeader.compression) || (8U != dibHeader.infoHeader.bpp)) &&
+                     ((COMPRESSION_METHOD_RLE4 != dibHeader.infoHeader.compression) || (4U != dibHeader.infoHeader.bpp))) ||
                  ((1U != dibHeader.infoHeader.bpp) && (4U != dibHeader.infoHeader.bpp) &&
                      (8U != dibHeader.infoHeader.bpp) && (24U != dibHeader.infoHeader.bpp) &&
                      (32U != dibHeader.infoHeader.bpp)))
@@ -324,8 +354,6 @@ bool BmpImgLoader::loadPalette(File& fd, uint32_t numColors, Color* palette)
 BmpImgLoader::Ret BmpImgLoader::loadPixelData(File& fd, const BmpFileHeader& bmpFileHeader, const BmpV5Header& dibHeader, YAGfxDynamicBitmap& bitmap)
 {
     Ret      ret           = RET_OK;
-    uint32_t rowSize       = 0U;
-    int16_t  y             = 0;
     bool     isTopToBottom = false;
     uint16_t bpp           = dibHeader.infoHeader.bpp;
     bool     isPalettized  = (bpp <= 8U) ? true : false;
@@ -361,144 +389,343 @@ BmpImgLoader::Ret BmpImgLoader::loadPixelData(File& fd, const BmpFileHeader& bmp
 
     if (RET_OK == ret)
     {
-        /* The bits representing the bitmap pixels are packed in rows.
-         * The size of each row is rounded up to a multiple of 4 bytes
-         * (a 32-bit DWORD) by padding.
-         */
-        rowSize = (bpp * bitmap.getWidth() + 31U) / 32U * 4U;
-
         /* ImageHeight is expressed as a negative number for top-down images. */
         if (0 > dibHeader.infoHeader.imageHeight)
         {
             isTopToBottom = true;
         }
 
-        while ((bitmap.getHeight() > y) && (RET_OK == ret))
+        if (false == fd.seek(bmpFileHeader.offset, SeekSet))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if ((COMPRESSION_METHOD_RLE8 == dibHeader.infoHeader.compression) ||
+                 (COMPRESSION_METHOD_RLE4 == dibHeader.infoHeader.compression))
         {
-            int16_t x = 0;
+            ret = loadRlePixels(fd, bpp, isTopToBottom, palette, numColors, bitmap);
+        }
+        else
+        {
+            ret = loadRows(fd, bpp, isTopToBottom, palette, numColors, bitmap);
+        }
+    }
 
-            while ((bitmap.getWidth() > x) && (RET_OK == ret))
+    if (nullptr != palette)
+    {
+        delete[] palette;
+    }
+
+    return ret;
+}
+
+BmpImgLoader::Ret BmpImgLoader::loadRows(File& fd, uint16_t bpp, bool isTopToBottom, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap)
+{
+    Ret      ret         = RET_OK;
+    uint16_t height      = bitmap.getHeight();
+
+    /* The bits representing the bitmap pixels are packed in rows.
+     * The size of each row is rounded up to a multiple of 4 bytes
+     * (a 32-bit DWORD) by padding.
+     */
+    uint32_t rowSize     = (bpp * bitmap.getWidth() + 31U) / 32U * 4U;
+    uint32_t rowDataSize = (bpp * bitmap.getWidth() + 7U) / 8U;
+    uint32_t rowsPerRead = CONFIG_BMP_IMG_LOADER_READ_BUFFER_SIZE / rowSize;
+    uint8_t* buffer      = nullptr;
+
+    if (0U == rowsPerRead)
+    {
+        rowsPerRead = 1U;
+    }
+    else if (height < rowsPerRead)
+    {
+        rowsPerRead = height;
+    }
+    else
+    {
+        ;
+    }
+
+    buffer = new (std::nothrow) uint8_t[rowsPerRead * rowSize];
+
+    if (nullptr == buffer)
+    {
+        ret = RET_IMG_TOO_BIG;
+    }
+    else
+    {
+        uint16_t row = 0U;
+
+        while ((height > row) && (RET_OK == ret))
+        {
+            uint32_t remaining = static_cast<uint32_t>(height) - row;
+            uint32_t rowCnt    = (remaining < rowsPerRead) ? remaining : rowsPerRead;
+            size_t   readSize  = rowCnt * rowSize;
+
+            /* The padding of the last row may be missing at the end of the file. */
+            if ((readSize - rowSize + rowDataSize) > fd.read(buffer, readSize))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
             {
-                Color    color;
-                uint32_t pos;
-                int16_t  actualY;
+                uint32_t idx;
 
-                if (false == isTopToBottom)
+                for (idx = 0U; idx < rowCnt; ++idx)
                 {
-                    actualY = bitmap.getHeight() - y - 1;
-                }
-                else
-                {
-                    actualY = y;
+                    int16_t y = (true == isTopToBottom) ? row : (height - row - 1U);
+
+                    convertRow(&buffer[idx * rowSize], bpp, y, palette, numColors, bitmap);
+                    ++row;
                 }
+            }
+        }
 
-                if (true == isPalettized)
-                {
-                    /* For palettized images, read index from pixel data. */
-                    uint32_t bitPos  = x * bpp;
-                    uint32_t bytePos = bitPos / 8U;
+        delete[] buffer;
+    }
+
+    return ret;
+}
+
+void BmpImgLoader::convertRow(const uint8_t* row, uint16_t bpp, int16_t y, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap)
+{
+    uint16_t width  = bitmap.getWidth();
+    uint16_t offset = 0U;
+    Color*   dst    = bitmap.getFrameBufferXAddr(0, y, width, offset);
+    uint16_t x;
+
+    if (8U >= bpp)
+    {
+        uint8_t mask = (1U << bpp) - 1U;
+
+        for (x = 0U; x < width; ++x)
+        {
+            uint32_t bitPos   = x * bpp;
+            uint32_t bitShift = 8U - (bitPos % 8U) - bpp;
+            uint8_t  index    = (row[bitPos / 8U] >> bitShift) & mask;
+            Color    color    = ColorDef::BLACK; /* Black for invalid index. */
+
+            if (index < numColors)
+            {
+                color = palette[index];
+            }
+
+            if (nullptr != dst)
+            {
+                dst[x * offset] = color;
+            }
+            else
+            {
+                bitmap.drawPixel(x, y, color);
+            }
+        }
+    }
+    else
+    {
+        const uint8_t RED_IDX      = 2U;
+        const uint8_t GREEN_IDX    = 1U;
+        const uint8_t BLUE_IDX     = 0U;
+        uint16_t      bytePerPixel = bpp / 8U;
+
+        for (x = 0U; x < width; ++x)
+        {
+            const uint8_t* pixel = &row[x * bytePerPixel];
+            Color          color(pixel[RED_IDX], pixel[GREEN_IDX], pixel[BLUE_IDX]);
+
+            if (nullptr != dst)
+            {
+                dst[x * offset] = color;
+            }
+            else
+            {
+                bitmap.drawPixel(x, y, color);
+            }
+        }
+    }
+}
+
+BmpImgLoader::Ret BmpImgLoader::loadRlePixels(File& fd, uint16_t bpp, bool isTopToBottom, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap)
+{
+    Ret           ret = RET_OK;
+    BmpReadBuffer readBuffer;
+
+    readBuffer.data   = new (std::nothrow) uint8_t[CONFIG_BMP_IMG_LOADER_READ_BUFFER_SIZE];
+    readBuffer.size   = CONFIG_BMP_IMG_LOADER_READ_BUFFER_SIZE;
+    readBuffer.length = 0U;
+    readBuffer.idx    = 0U;
+
+    if (nullptr == readBuffer.data)
+    {
+        ret = RET_IMG_TOO_BIG;
+    }
+    else
+    {
+        uint32_t x     = 0U;
+        uint32_t row   = 0U;
+        bool     isEnd = false;
+
+        /* Skipped pixels are undefined, they stay black. */
+        bitmap.fillScreen(ColorDef::BLACK);
 
-                    pos              = bytePos + actualY * rowSize;
+        while ((false == isEnd) && (RET_OK == ret))
+        {
+            uint8_t count = 0U;
+            uint8_t value = 0U;
 
-                    if (false == readPalettizedPixel(fd, bmpFileHeader.offset, pos, bpp, x, palette, numColors, color))
+            if ((false == readByte(fd, readBuffer, count)) ||
+                (false == readByte(fd, readBuffer, value)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            /* Encoded mode: The count of pixels is followed by the color index or
+             * for RLE4 two color indices, which are used alternately.
+             */
+            else if (0U < count)
+            {
+                uint8_t idx;
+
+                for (idx = 0U; idx < count; ++idx)
+                {
+                    uint8_t index = value;
+
+                    if (4U == bpp)
                     {
-                        ret = RET_FILE_FORMAT_INVALID;
+                        index = (0U == (idx % 2U)) ? (value >> 4U) : (value & 0x0FU);
                     }
+
+                    drawRlePixel(x, row, isTopToBottom, index, palette, numColors, bitmap);
+                    ++x;
+                }
+            }
+            else if (RLE_ESCAPE_END_OF_LINE == value)
+            {
+                x = 0U;
+                ++row;
+            }
+            else if (RLE_ESCAPE_END_OF_BITMAP == value)
+            {
+                isEnd = true;
+            }
+            else if (RLE_ESCAPE_DELTA == value)
+            {
+                uint8_t deltaX = 0U;
+                uint8_t deltaY = 0U;
+
+                if ((false == readByte(fd, readBuffer, deltaX)) ||
+                    (false == readByte(fd, readBuffer, deltaY)))
+                {
+                    ret = RET_FILE_FORMAT_INVALID;
                 }
                 else
                 {
-                    /* For 24/32-bit images, read RGB(A) directly. */
-                    uint16_t bytePerPixel = bpp / 8U;
+                    x   += deltaX;
+                    row += deltaY;
+                }
+            }
+            /* Absolute mode: The count of pixels is followed by the uncompressed
+             * color indices, padded to a 16-bit boundary.
+             */
+            else
+            {
+                uint8_t  data      = 0U;
+                uint32_t byteCount = (8U == bpp) ? value : ((value + 1U) / 2U);
+                uint8_t  idx;
+
+                for (idx = 0U; (idx < value) && (RET_OK == ret); ++idx)
+                {
+                    uint8_t index = 0U;
 
-                    pos                   = x * bytePerPixel + actualY * rowSize;
+                    if (8U == bpp)
+                    {
+                        if (false == readByte(fd, readBuffer, data))
+                        {
+                            ret = RET_FILE_FORMAT_INVALID;
+                        }
+
+                        index = data;
+                    }
+                    else if (0U == (idx % 2U))
+                    {
+                        if (false == readByte(fd, readBuffer, data))
+                        {
+                            ret = RET_FILE_FORMAT_INVALID;
+                        }
+
+                        index = data >> 4U;
+                    }
+                    else
+                    {
+                        index = data & 0x0FU;
+                    }
 
-                    if (false == readDirectPixel(fd, bmpFileHeader.offset, pos, bpp, color))
+                    if (RET_OK == ret)
                     {
-                        ret = RET_FILE_FORMAT_INVALID;
+                        drawRlePixel(x, row, isTopToBottom, index, palette, numColors, bitmap);
+                        ++x;
                     }
                 }
 
-                if (RET_OK == ret)
+                /* Skip padding byte. */
+                if ((RET_OK == ret) &&
+                    (0U != (byteCount % 2U)) &&
+                    (false == readByte(fd, readBuffer, data)))
                 {
-                    bitmap.drawPixel(x, y, color);
+                    ret = RET_FILE_FORMAT_INVALID;
                 }
-
-                ++x;
             }
 
-            ++y;
+            /* All rows decoded? */
+            if (bitmap.getHeight() <= row)
+            {
+                isEnd = true;
+            }
         }
-    }
 
-    if (nullptr != palette)
-    {
-        delete[] palette;
+        delete[] readBuffer.data;
     }
 
     return ret;
 }
 
-bool BmpImgLoader::readPalettizedPixel(File& fd, uint32_t offset, uint32_t pos, uint16_t bpp, int16_t x, const Color* palette, uint32_t numColors, Color& color)
+bool BmpImgLoader::readByte(File& fd, BmpReadBuffer& readBuffer, uint8_t& data)
 {
-    bool    isSuccessful = true;
-    uint8_t byteData;
+    bool isSuccessful = true;
 
-    if (nullptr == palette)
-    {
-        isSuccessful = false;
-    }
-    else if (false == fd.seek(offset + pos, SeekSet))
+    if (readBuffer.length <= readBuffer.idx)
     {
-        isSuccessful = false;
-    }
-    else if (1 != fd.read(&byteData, 1))
-    {
-        isSuccessful = false;
-    }
-    else
-    {
-        uint32_t bitPos   = x * bpp;
-        uint32_t bitShift = bitPos % 8U;
-        uint8_t  mask     = (1U << bpp) - 1U;
-        uint8_t  index    = (byteData >> (8U - bitShift - bpp)) & mask;
+        readBuffer.length = fd.read(readBuffer.data, readBuffer.size);
+        readBuffer.idx    = 0U;
 
-        if (index < numColors)
-        {
-            color = palette[index];
-        }
-        else
+        if (0U == readBuffer.length)
         {
-            color = ColorDef::BLACK; /* Black for invalid index. */
+            isSuccessful = false;
         }
     }
 
+    if (true == isSuccessful)
+    {
+        data = readBuffer.data[readBuffer.idx];
+        ++readBuffer.idx;
+    }
+
     return isSuccessful;
 }
 
-bool BmpImgLoader::readDirectPixel(File& fd, uint32_t offset, uint32_t pos, uint16_t bpp, Color& color)
+void BmpImgLoader::drawRlePixel(uint32_t x, uint32_t row, bool isTopToBottom, uint8_t index, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap)
 {
-    bool     isSuccessful = true;
-    uint16_t bytePerPixel = bpp / 8U;
-    uint8_t  lineBuffer[bytePerPixel];
-
-    if (false == fd.seek(offset + pos, SeekSet))
+    if ((bitmap.getWidth() > x) &&
+        (bitmap.getHeight() > row))
     {
-        isSuccessful = false;
-    }
-    else if (sizeof(lineBuffer) != fd.read(lineBuffer, sizeof(lineBuffer)))
-    {
-        isSuccessful = false;
-    }
-    else
-    {
-        const uint8_t RED_IDX   = 2U;
-        const uint8_t GREEN_IDX = 1U;
-        const uint8_t BLUE_IDX  = 0U;
+        int16_t y = (true == isTopToBottom) ? row : (bitmap.getHeight() - row - 1U);
 
-        color.set(lineBuffer[RED_IDX], lineBuffer[GREEN_IDX], lineBuffer[BLUE_IDX]);
+        if (index < numColors)
+        {
+            bitmap.drawPixel(x, y, palette[index]);
+        }
+        else
+        {
+            bitmap.drawPixel(x, y, ColorDef::BLACK); /* Black for invalid index. */
+        }
     }
-
-    return isSuccessful;
 }
 
 /******************************************************************************
@@ -67,12 +67,21 @@ typedef struct _BmpFileHeader BmpFileHeader;
  */
 typedef struct _BmpV5Header BmpV5Header;
 
+/**
+ * Buffer for reading the pixel data blockwise from the file.
+ */
+typedef struct _BmpReadBuffer BmpReadBuffer;
+
 /**
  * Bitmap image loader, which supports images that have
  * - 1/4/8/24/32 bit per pixel
  * - No compression (or bitfields for 32-bit)
+ * - RLE8 compression for 8 bpp and RLE4 compression for 4 bpp
  * - Palette colors (for 1/4/8 bpp)
+ * - Bottom-up and top-down row order
  * - Resolution of max. 65535 x 65535 pixels
+ *
+ * The pixel data is read in blocks of several rows, not pixel by pixel.
  */
 class BmpImgLoader
 {
@@ -161,33 +170,72 @@ private:
     Ret loadPixelData(File& fd, const BmpFileHeader& bmpFileHeader, const BmpV5Header& dibHeader, YAGfxDynamicBitmap& bitmap);
 
     /**
-     * Read a pixel color from a palettized image.
+     * Load uncompressed pixel data row by row from file system to bitmap buffer.
+     * As many rows as fit into the read buffer are read at once.
      *
-     * @param[in] fd            File descriptor
-     * @param[in] offset        Offset to pixel data in file
-     * @param[in] pos           Position within pixel data
+     * @param[in] fd            File descriptor, positioned at the pixel data
+     * @param[in] bpp           Bits per pixel
+     * @param[in] isTopToBottom Is the first row in the file the top row?
+     * @param[in] palette       Color palette (only for palettized images)
+     * @param[in] numColors     Number of colors in palette
+     * @param[out] bitmap       Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadRows(File& fd, uint16_t bpp, bool isTopToBottom, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Convert a single row of uncompressed pixel data into the bitmap buffer.
+     *
+     * @param[in] row           Pixel data of the row
      * @param[in] bpp           Bits per pixel
-     * @param[in] x             X coordinate of pixel (for bit shift calculation)
+     * @param[in] y             y-coordinate of the row in the bitmap buffer
+     * @param[in] palette       Color palette (only for palettized images)
+     * @param[in] numColors     Number of colors in palette
+     * @param[out] bitmap       Bitmap buffer
+     */
+    void convertRow(const uint8_t* row, uint16_t bpp, int16_t y, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Load RLE8 or RLE4 compressed pixel data from file system to bitmap buffer.
+     * Pixels, which are skipped by the compressed data, are black.
+     *
+     * @param[in] fd            File descriptor, positioned at the pixel data
+     * @param[in] bpp           Bits per pixel (8 for RLE8, 4 for RLE4)
+     * @param[in] isTopToBottom Is the first row in the file the top row?
      * @param[in] palette       Color palette
      * @param[in] numColors     Number of colors in palette
-     * @param[out] color        Resulting color
+     * @param[out] bitmap       Bitmap buffer
      *
-     * @return If successful, it will return true otherwise false.
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
      */
-    bool readPalettizedPixel(File& fd, uint32_t offset, uint32_t pos, uint16_t bpp, int16_t x, const Color* palette, uint32_t numColors, Color& color);
+    Ret loadRlePixels(File& fd, uint16_t bpp, bool isTopToBottom, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap);
 
     /**
-     * Read a pixel color from a direct RGB(A) image.
+     * Read a single byte via the read buffer. The read buffer is refilled
+     * from the file, after it is consumed.
      *
      * @param[in] fd            File descriptor
-     * @param[in] offset        Offset to pixel data in file
-     * @param[in] pos           Position within pixel data
-     * @param[in] bpp           Bits per pixel
-     * @param[out] color        Resulting color
+     * @param[in] readBuffer    Read buffer
+     * @param[out] data         Read byte
      *
      * @return If successful, it will return true otherwise false.
      */
-    bool readDirectPixel(File& fd, uint32_t offset, uint32_t pos, uint16_t bpp, Color& color);
+    bool readByte(File& fd, BmpReadBuffer& readBuffer, uint8_t& data);
+
+    /**
+     * Draw a palettized pixel of a RLE compressed image.
+     * Pixels outside the bitmap buffer are ignored.
+     *
+     * @param[in] x             x-coordinate
+     * @param[in] row           Row number in the file
+     * @param[in] isTopToBottom Is the first row in the file the top row?
+     * @param[in] index         Color index
+     * @param[in] palette       Color palette
+     * @param[in] numColors     Number of colors in palette
+     * @param[out] bitmap       Bitmap buffer
+     */
+    void drawRlePixel(uint32_t x, uint32_t row, bool isTopToBottom, uint8_t index, const Color* palette, uint32_t numColors, YAGfxDynamicBitmap& bitmap);
 };
 
 /******************************************************************************
@@ -220,6 +220,19 @@ public:
         m_bitmap.drawPixel(x, y, color);
     }
 
+    /**
+     * Mark a rectangle as changed. It is forwarded to the canvas bitmap.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Rectangle width in pixel
+     * @param[in] height    Rectangle height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_bitmap.markDirty(x, y, width, height);
+    }
+
     /**
      * Get the address inside the framebuffer at certain coordinates.
      * If the requested length is not available, it will return nullptr.
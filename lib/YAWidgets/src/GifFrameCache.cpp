@@ -0,0 +1,417 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GifFrameCache.cpp
+ * @brief  Cache for decoded GIF animation scenes
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GifFrameCache.h"
+
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+GifFrameCache::GifFrameCache() :
+    m_colorAllocator(),
+    m_indexAllocator(),
+    m_delayAllocator(),
+    m_width(0U),
+    m_height(0U),
+    m_maxSize(0U),
+    m_palette(nullptr),
+    m_paletteLength(0U),
+    m_frames(nullptr),
+    m_delays(nullptr),
+    m_frameCount(0U),
+    m_frameCapacity(0U)
+{
+}
+
+GifFrameCache::GifFrameCache(const GifFrameCache& cache) :
+    m_colorAllocator(),
+    m_indexAllocator(),
+    m_delayAllocator(),
+    m_width(0U),
+    m_height(0U),
+    m_maxSize(0U),
+    m_palette(nullptr),
+    m_paletteLength(0U),
+    m_frames(nullptr),
+    m_delays(nullptr),
+    m_frameCount(0U),
+    m_frameCapacity(0U)
+{
+    if (false == copy(cache))
+    {
+        release();
+    }
+}
+
+GifFrameCache& GifFrameCache::operator=(const GifFrameCache& cache)
+{
+    if (this != &cache)
+    {
+        release();
+
+        if (false == copy(cache))
+        {
+            release();
+        }
+    }
+
+    return *this;
+}
+
+bool GifFrameCache::create(uint16_t width, uint16_t height, size_t maxSize)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    /* At least the palette and a single scene must fit. */
+    if ((0U < width) &&
+        (0U < height) &&
+        (maxSize >= ((MAX_PALETTE_COLORS * sizeof(Color)) + (static_cast<size_t>(width) * height) + sizeof(uint32_t))))
+    {
+        m_palette = m_colorAllocator.allocateArray(MAX_PALETTE_COLORS);
+
+        if (nullptr != m_palette)
+        {
+            m_width      = width;
+            m_height     = height;
+            m_maxSize    = maxSize;
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void GifFrameCache::release()
+{
+    if (nullptr != m_palette)
+    {
+        m_colorAllocator.deallocateArray(m_palette);
+        m_palette = nullptr;
+    }
+
+    if (nullptr != m_frames)
+    {
+        m_indexAllocator.deallocateArray(m_frames);
+        m_frames = nullptr;
+    }
+
+    if (nullptr != m_delays)
+    {
+        m_delayAllocator.deallocateArray(m_delays);
+        m_delays = nullptr;
+    }
+
+    m_width         = 0U;
+    m_height        = 0U;
+    m_maxSize       = 0U;
+    m_paletteLength = 0U;
+    m_frameCount    = 0U;
+    m_frameCapacity = 0U;
+}
+
+bool GifFrameCache::addFrame(const YAGfxBitmap& scene, uint32_t delay)
+{
+    bool isSuccessful = false;
+
+    if ((true == isAllocated()) &&
+        (m_width == scene.getWidth()) &&
+        (m_height == scene.getHeight()))
+    {
+        if (m_frameCapacity > m_frameCount)
+        {
+            isSuccessful = true;
+        }
+        else
+        {
+            isSuccessful = grow();
+        }
+    }
+
+    if (true == isSuccessful)
+    {
+        uint8_t* frame      = &m_frames[m_frameCount * getFrameSize()];
+        uint8_t  colorIndex = 0U;
+        int16_t  y          = 0;
+
+        while ((m_height > y) && (true == isSuccessful))
+        {
+            int16_t x = 0;
+
+            while ((m_width > x) && (true == isSuccessful))
+            {
+                /* Neighbour pixels often have the same color, therefore
+                 * the previous color index is checked first.
+                 */
+                isSuccessful = getColorIndex(scene.getColor(x, y), colorIndex, colorIndex);
+                *frame       = colorIndex;
+
+                ++frame;
+                ++x;
+            }
+
+            ++y;
+        }
+
+        if (true == isSuccessful)
+        {
+            m_delays[m_frameCount] = delay;
+            ++m_frameCount;
+        }
+    }
+
+    return isSuccessful;
+}
+
+uint32_t GifFrameCache::getDelay(uint16_t index) const
+{
+    uint32_t delay = 0U;
+
+    if (m_frameCount > index)
+    {
+        delay = m_delays[index];
+    }
+
+    return delay;
+}
+
+bool GifFrameCache::drawFrame(uint16_t index, YAGfx& gfx, int16_t x, int16_t y) const
+{
+    bool isSuccessful = false;
+
+    if (m_frameCount > index)
+    {
+        const uint8_t* frame = &m_frames[index * getFrameSize()];
+        Color          colors[YAGfx::SPAN_BUFFER_SIZE];
+        uint16_t       row;
+
+        for (row = 0U; row < m_height; ++row)
+        {
+            uint16_t pos = 0U;
+
+            while (m_width > pos)
+            {
+                uint16_t chunkLength = m_width - pos;
+                uint16_t idx;
+
+                if (YAGfx::SPAN_BUFFER_SIZE < chunkLength)
+                {
+                    chunkLength = YAGfx::SPAN_BUFFER_SIZE;
+                }
+
+                for (idx = 0U; idx < chunkLength; ++idx)
+                {
+                    colors[idx] = m_palette[*frame];
+                    ++frame;
+                }
+
+                gfx.drawHLine(x + pos, y + row, chunkLength, colors);
+
+                pos += chunkLength;
+            }
+        }
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool GifFrameCache::grow()
+{
+    bool     isSuccessful = false;
+    size_t   frameSize    = getFrameSize();
+    size_t   paletteSize  = MAX_PALETTE_COLORS * sizeof(Color);
+    size_t   maxFrames    = (m_maxSize - paletteSize) / (frameSize + sizeof(uint32_t));
+    uint16_t capacity     = INITIAL_FRAME_CAPACITY;
+
+    if (0U < m_frameCapacity)
+    {
+        capacity = m_frameCapacity * 2U;
+    }
+
+    if (maxFrames < capacity)
+    {
+        capacity = static_cast<uint16_t>(maxFrames);
+    }
+
+    /* Not enough memory left for another scene? */
+    if (m_frameCount < capacity)
+    {
+        uint8_t*  frames = m_indexAllocator.allocateArray(capacity * frameSize);
+        uint32_t* delays = m_delayAllocator.allocateArray(capacity);
+
+        if ((nullptr == frames) ||
+            (nullptr == delays))
+        {
+            m_indexAllocator.deallocateArray(frames);
+            m_delayAllocator.deallocateArray(delays);
+        }
+        else
+        {
+            if (0U < m_frameCount)
+            {
+                (void)memcpy(frames, m_frames, m_frameCount * frameSize);
+                (void)memcpy(delays, m_delays, m_frameCount * sizeof(uint32_t));
+            }
+
+            m_indexAllocator.deallocateArray(m_frames);
+            m_delayAllocator.deallocateArray(m_delays);
+
+            m_frames        = frames;
+            m_delays        = delays;
+            m_frameCapacity = capacity;
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool GifFrameCache::getColorIndex(const Color& color, uint8_t hint, uint8_t& colorIndex)
+{
+    bool isFound = false;
+
+    if ((m_paletteLength > hint) &&
+        (color == m_palette[hint]))
+    {
+        colorIndex = hint;
+        isFound    = true;
+    }
+    else
+    {
+        uint16_t idx = 0U;
+
+        while ((m_paletteLength > idx) && (false == isFound))
+        {
+            if (color == m_palette[idx])
+            {
+                colorIndex = static_cast<uint8_t>(idx);
+                isFound    = true;
+            }
+
+            ++idx;
+        }
+
+        /* Add the color to the palette, if there is space left. */
+        if ((false == isFound) &&
+            (MAX_PALETTE_COLORS > m_paletteLength))
+        {
+            m_palette[m_paletteLength] = color;
+            colorIndex                 = static_cast<uint8_t>(m_paletteLength);
+            isFound                    = true;
+
+            ++m_paletteLength;
+        }
+    }
+
+    return isFound;
+}
+
+bool GifFrameCache::copy(const GifFrameCache& cache)
+{
+    bool isSuccessful = true;
+
+    if (true == cache.isAllocated())
+    {
+        isSuccessful = create(cache.m_width, cache.m_height, cache.m_maxSize);
+
+        /* The capacity grows stepwise, same as during the scenes were added. */
+        while ((m_frameCapacity < cache.m_frameCount) && (true == isSuccessful))
+        {
+            isSuccessful = grow();
+        }
+
+        if (true == isSuccessful)
+        {
+            uint16_t idx;
+
+            for (idx = 0U; idx < cache.m_paletteLength; ++idx)
+            {
+                m_palette[idx] = cache.m_palette[idx];
+            }
+
+            if (0U < cache.m_frameCount)
+            {
+                (void)memcpy(m_frames, cache.m_frames, cache.m_frameCount * getFrameSize());
+                (void)memcpy(m_delays, cache.m_delays, cache.m_frameCount * sizeof(uint32_t));
+            }
+
+            m_paletteLength = cache.m_paletteLength;
+            m_frameCount    = cache.m_frameCount;
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,262 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GifFrameCache.h
+ * @brief  Cache for decoded GIF animation scenes
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef GIF_FRAME_CACHE_H
+#define GIF_FRAME_CACHE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <YAGfx.h>
+#include <YAGfxBitmap.h>
+#include <TypedAllocator.hpp>
+#include <PsAllocator.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Holds the decoded scenes of a GIF animation, together with their delay.
+ * Every scene is stored with 8 bit color indices, which refer to a palette
+ * shared by all scenes. Therefore an animation can be cached only, if it
+ * uses not more than 256 different colors.
+ *
+ * The cache is filled scene by scene, while the animation is decoded the
+ * first time. Afterwards the scenes can be played back without decoding
+ * again.
+ */
+class GifFrameCache
+{
+public:
+
+    /**
+     * Max. number of palette colors.
+     */
+    static const uint16_t MAX_PALETTE_COLORS = 256U;
+
+    /**
+     * Constructs an empty frame cache.
+     */
+    GifFrameCache();
+
+    /**
+     * Constructs a frame cache by copying another one.
+     *
+     * @param[in] cache Frame cache, which to copy.
+     */
+    GifFrameCache(const GifFrameCache& cache);
+
+    /**
+     * Destroys the frame cache.
+     */
+    ~GifFrameCache()
+    {
+        release();
+    }
+
+    /**
+     * Assigns a frame cache.
+     *
+     * @param[in] cache Frame cache, which to assign.
+     *
+     * @return Frame cache
+     */
+    GifFrameCache& operator=(const GifFrameCache& cache);
+
+    /**
+     * Creates an empty frame cache for scenes with the given size.
+     * A previous cache will be released.
+     *
+     * @param[in] width     Scene width in pixels
+     * @param[in] height    Scene height in pixels
+     * @param[in] maxSize   Max. memory size in bytes, which the cache may use.
+     *
+     * @return If successful created, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height, size_t maxSize);
+
+    /**
+     * Releases all scenes and the palette.
+     */
+    void release();
+
+    /**
+     * Is the frame cache created?
+     *
+     * @return If created, it will return true otherwise false.
+     */
+    bool isAllocated() const
+    {
+        return (nullptr != m_palette);
+    }
+
+    /**
+     * Add a scene at the end.
+     * It fails if the max. memory size is exceeded or the scene contains
+     * too many colors.
+     *
+     * @param[in] scene Scene, which must have the size of the cache.
+     * @param[in] delay Delay in ms, until the next scene shall be shown.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addFrame(const YAGfxBitmap& scene, uint32_t delay);
+
+    /**
+     * Get the number of cached scenes.
+     *
+     * @return Number of scenes
+     */
+    uint16_t getFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    /**
+     * Get the delay of a cached scene.
+     *
+     * @param[in] index Scene index
+     *
+     * @return Delay in ms or 0, if the scene is not available.
+     */
+    uint32_t getDelay(uint16_t index) const;
+
+    /**
+     * Draw a cached scene. Every row is expanded from the palette span wise
+     * and written as a horizontal line.
+     *
+     * @param[in] index Scene index
+     * @param[in] gfx   Graphics interface, where to draw the scene.
+     * @param[in] x     x-coordinate of the upper left corner.
+     * @param[in] y     y-coordinate of the upper left corner.
+     *
+     * @return If the scene is available, it will return true otherwise false.
+     */
+    bool drawFrame(uint16_t index, YAGfx& gfx, int16_t x, int16_t y) const;
+
+private:
+
+    /**
+     * Number of scenes, which are allocated at once for the first scene.
+     * The capacity is doubled every time it is exhausted.
+     */
+    static const uint16_t INITIAL_FRAME_CAPACITY = 4U;
+
+    /**
+     * Color allocator type definition.
+     */
+    typedef TypedAllocator<Color, PsAllocator> ColorAllocator;
+
+    /**
+     * Color index allocator type definition.
+     */
+    typedef TypedAllocator<uint8_t, PsAllocator> IndexAllocator;
+
+    /**
+     * Delay allocator type definition.
+     */
+    typedef TypedAllocator<uint32_t, PsAllocator> DelayAllocator;
+
+    ColorAllocator m_colorAllocator; /**< Palette color allocator. */
+    IndexAllocator m_indexAllocator; /**< Color index allocator. */
+    DelayAllocator m_delayAllocator; /**< Delay allocator. */
+    uint16_t       m_width;          /**< Scene width in pixels. */
+    uint16_t       m_height;         /**< Scene height in pixels. */
+    size_t         m_maxSize;        /**< Max. memory size in bytes. */
+    Color*         m_palette;        /**< Palette shared by all scenes. */
+    uint16_t       m_paletteLength;  /**< Number of used palette colors. */
+    uint8_t*       m_frames;         /**< Color indices of all scenes, one after another. */
+    uint32_t*      m_delays;         /**< Delay in ms per scene. */
+    uint16_t       m_frameCount;     /**< Number of cached scenes. */
+    uint16_t       m_frameCapacity;  /**< Number of scenes, which fit into the allocated memory. */
+
+    /**
+     * Get the size of a single scene in bytes.
+     *
+     * @return Scene size in bytes
+     */
+    size_t getFrameSize() const
+    {
+        return static_cast<size_t>(m_width) * m_height;
+    }
+
+    /**
+     * Increase the capacity for at least one more scene.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool grow();
+
+    /**
+     * Get the palette index of a color. If the color is not in the palette
+     * yet, it will be added.
+     *
+     * @param[in]   color       Color
+     * @param[in]   hint        Palette index, which is checked first.
+     * @param[out]  colorIndex  Palette index of the color
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getColorIndex(const Color& color, uint8_t hint, uint8_t& colorIndex);
+
+    /**
+     * Copy the content of another frame cache.
+     *
+     * @param[in] cache Frame cache, which to copy.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool copy(const GifFrameCache& cache);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GIF_FRAME_CACHE_H */
+
+/** @} */
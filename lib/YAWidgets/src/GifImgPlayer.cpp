@@ -38,6 +38,7 @@
 #include "GifFileLoader.h"
 #include "GifFileToMemLoader.h"
 #include <Logging.h>
+#include <MemUtil.h>
 #include <TypedAllocator.hpp>
 
 /******************************************************************************
@@ -53,6 +54,16 @@
 /** Debug mode status */
 #define GIF_IMG_PLAYER_DEBUG_MODE GIF_IMG_PLAYER_DEBUG_DISABLE
 
+#ifndef CONFIG_GIF_FRAME_CACHE_MAX_SIZE
+/** Max. memory size in bytes of a frame cache, if no PSRAM is available. */
+#define CONFIG_GIF_FRAME_CACHE_MAX_SIZE         4096U
+#endif /* CONFIG_GIF_FRAME_CACHE_MAX_SIZE */
+
+#ifndef CONFIG_GIF_FRAME_CACHE_MAX_SIZE_PSRAM
+/** Max. memory size in bytes of a frame cache, if PSRAM is available. */
+#define CONFIG_GIF_FRAME_CACHE_MAX_SIZE_PSRAM   131072U
+#endif /* CONFIG_GIF_FRAME_CACHE_MAX_SIZE_PSRAM */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -280,7 +291,11 @@ GifImgPlayer::GifImgPlayer() :
     m_delay(0U),
     m_timer(),
     m_isAnimation(false),
-    m_isFinished(false)
+    m_isFinished(false),
+    m_frameCache(),
+    m_frameCacheState(FRAME_CACHE_STATE_EMPTY),
+    m_frameIdx(0U),
+    m_isFrameCacheEnabled(true)
 {
 }
 
@@ -311,8 +326,19 @@ GifImgPlayer::GifImgPlayer(const GifImgPlayer& player) :
     m_delay(player.m_delay),
     m_timer(),
     m_isAnimation(player.m_isAnimation),
-    m_isFinished(player.m_isFinished)
+    m_isFinished(player.m_isFinished),
+    m_frameCache(player.m_frameCache),
+    m_frameCacheState(player.m_frameCacheState),
+    m_frameIdx(player.m_frameIdx),
+    m_isFrameCacheEnabled(player.m_isFrameCacheEnabled)
 {
+    /* Without the scenes, the animation continues decoding. */
+    if ((FRAME_CACHE_STATE_EMPTY != m_frameCacheState) &&
+        (m_frameCache.getFrameCount() != player.m_frameCache.getFrameCount()))
+    {
+        restoreSceneFromCache(player);
+    }
+
     /* Copy global color table. */
     if (false == copyGlobalColorTable(player.m_globalColorTable, player.m_globalColorTableLength))
     {
@@ -362,6 +388,17 @@ GifImgPlayer& GifImgPlayer::operator=(const GifImgPlayer& player)
         m_delay                 = player.m_delay;
         m_isAnimation           = player.m_isAnimation;
         m_isFinished            = player.m_isFinished;
+        m_frameCache            = player.m_frameCache;
+        m_frameCacheState       = player.m_frameCacheState;
+        m_frameIdx              = player.m_frameIdx;
+        m_isFrameCacheEnabled   = player.m_isFrameCacheEnabled;
+
+        /* Without the scenes, the animation continues decoding. */
+        if ((FRAME_CACHE_STATE_EMPTY != m_frameCacheState) &&
+            (m_frameCache.getFrameCount() != player.m_frameCache.getFrameCount()))
+        {
+            restoreSceneFromCache(player);
+        }
 
         /* Copy global color table. */
         if (false == copyGlobalColorTable(player.m_globalColorTable, player.m_globalColorTableLength))
@@ -471,6 +508,8 @@ GifImgPlayer::Ret GifImgPlayer::open(FS& fs, const String& fileName, IGifLoader&
                 m_isTransparencyEnabled = false;
                 m_isAnimation           = false;
                 m_isFinished            = false;
+                m_frameCacheState       = FRAME_CACHE_STATE_EMPTY;
+                m_frameIdx              = 0U;
                 m_timer.stop();
 
                 /* Global color table available? */
@@ -533,15 +572,18 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
     /* Finished? */
     else if (true == m_isFinished)
     {
-        /* Redraw last scene. */
-        gfx.drawBitmap(x, y, m_bitmap);
+        redrawScene(gfx, x, y);
     }
     /* Delay? */
     else if ((true == m_timer.isTimerRunning()) &&
              (false == m_timer.isTimeout()))
     {
-        /* Redraw last scene. */
-        gfx.drawBitmap(x, y, m_bitmap);
+        redrawScene(gfx, x, y);
+    }
+    /* All scenes cached? */
+    else if (FRAME_CACHE_STATE_COMPLETE == m_frameCacheState)
+    {
+        playFromCache(gfx, x, y);
     }
     else
     {
@@ -574,6 +616,8 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
                     /* Animation? */
                     if (true == m_isAnimation)
                     {
+                        cacheScene();
+
                         m_timer.start(m_delay);
                         isImageShown = true;
                     }
@@ -594,27 +638,20 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
                 /* Animation running? */
                 if (true == m_isAnimation)
                 {
-                    /* Is animation limited to a specific number of repeats? */
-                    if (0U < m_loopCount)
+                    /* All scenes are cached after the first loop. */
+                    if (FRAME_CACHE_STATE_FILLING == m_frameCacheState)
                     {
-                        --m_loopCount;
-
-                        /* Animation finished? */
-                        if (0U == m_loopCount)
-                        {
-                            m_isFinished = true;
-                            m_timer.stop();
-                        }
-                    }
-                    /* Infinite animation. */
-                    else
-                    {
-                        ;
+                        m_frameCacheState = FRAME_CACHE_STATE_COMPLETE;
+                        m_frameIdx        = 0U;
                     }
 
+                    countLoop();
+
                     if (false == m_isFinished)
                     {
-                        /* Restart from begin. */
+                        /* Restart from begin. Even with all scenes cached, a copy
+                         * of the player may need to continue decoding.
+                         */
                         if (false == m_gifLoader->seek(m_restartFilePos, SeekSet))
                         {
                             isSuccessful = false;
@@ -789,6 +826,10 @@ void GifImgPlayer::cleanup()
         m_localColorTable       = nullptr;
         m_localColorTableLength = 0U;
     }
+
+    m_frameCache.release();
+    m_frameCacheState = FRAME_CACHE_STATE_EMPTY;
+    m_frameIdx        = 0U;
 }
 
 bool GifImgPlayer::isFileSupported(const GifFileHeader& header) const
@@ -973,12 +1014,12 @@ bool GifImgPlayer::parseImageDescriptor()
             {
                 LzwDecoder                   lzwDecoder;
                 LzwDecoder::ReadFromInStream readFromCodeStreamFunc =
-                    [this](uint8_t& data) -> bool {
-                    return this->readFromCodeStream(data);
+                    [this](const uint8_t*& data, size_t& length) -> bool {
+                    return this->readFromCodeStream(data, length);
                 };
                 LzwDecoder::WriteToOutStream writeToIndexStreamFunc =
-                    [this](uint8_t data) -> bool {
-                    return this->writeToIndexStream(data);
+                    [this](const uint8_t* data, size_t length) -> bool {
+                    return this->writeToIndexStream(data, length);
                 };
                 uint8_t blockTerminator = 0U;
 
@@ -1033,6 +1074,126 @@ bool GifImgPlayer::parseImageDescriptor()
     return isSuccessful;
 }
 
+void GifImgPlayer::countLoop()
+{
+    /* Is animation limited to a specific number of repeats? */
+    if (0U < m_loopCount)
+    {
+        --m_loopCount;
+
+        /* Animation finished? */
+        if (0U == m_loopCount)
+        {
+            m_isFinished = true;
+            m_timer.stop();
+        }
+    }
+    /* Infinite animation. */
+    else
+    {
+        ;
+    }
+}
+
+void GifImgPlayer::cacheScene()
+{
+    if (true == m_isFrameCacheEnabled)
+    {
+        /* The first scene creates the frame cache. */
+        if (FRAME_CACHE_STATE_EMPTY == m_frameCacheState)
+        {
+            size_t maxSize = CONFIG_GIF_FRAME_CACHE_MAX_SIZE;
+
+            if (true == MemUtil::isPsramAvailable())
+            {
+                maxSize = CONFIG_GIF_FRAME_CACHE_MAX_SIZE_PSRAM;
+            }
+
+            if (true == m_frameCache.create(m_bitmap.getWidth(), m_bitmap.getHeight(), maxSize))
+            {
+                m_frameCacheState = FRAME_CACHE_STATE_FILLING;
+            }
+            else
+            {
+                m_frameCacheState = FRAME_CACHE_STATE_UNSUPPORTED;
+            }
+        }
+
+        if (FRAME_CACHE_STATE_FILLING == m_frameCacheState)
+        {
+            if (false == m_frameCache.addFrame(m_bitmap, m_delay))
+            {
+                GIF_IMG_PLAYER_LOG_DEBUG("Frame cache exhausted after %u scenes.\n", m_frameCache.getFrameCount());
+
+                m_frameCache.release();
+                m_frameCacheState = FRAME_CACHE_STATE_UNSUPPORTED;
+            }
+        }
+    }
+}
+
+void GifImgPlayer::playFromCache(YAGfx& gfx, int16_t x, int16_t y)
+{
+    /* End of the loop, same as the trailer in the GIF data stream? */
+    if (m_frameCache.getFrameCount() <= m_frameIdx)
+    {
+        /* Notify about the trailer. */
+        m_isTrailerFound = true;
+        m_frameIdx       = 0U;
+
+        redrawScene(gfx, x, y);
+
+        countLoop();
+    }
+    else
+    {
+        /* Draw new scene directly, the bitmap is not updated anymore. */
+        (void)m_frameCache.drawFrame(m_frameIdx, gfx, x, y);
+
+        m_timer.start(m_frameCache.getDelay(m_frameIdx));
+        ++m_frameIdx;
+    }
+}
+
+void GifImgPlayer::restoreSceneFromCache(const GifImgPlayer& player)
+{
+    /* The scenes played back from the cache are not drawn to the bitmap.
+     * Decoding continues on top of the last shown scene.
+     */
+    if (FRAME_CACHE_STATE_COMPLETE == player.m_frameCacheState)
+    {
+        (void)player.m_frameCache.drawFrame(player.getLastCachedFrameIdx(), m_bitmap, 0, 0);
+    }
+
+    m_frameCache.release();
+    m_frameCacheState = FRAME_CACHE_STATE_UNSUPPORTED;
+}
+
+void GifImgPlayer::redrawScene(YAGfx& gfx, int16_t x, int16_t y)
+{
+    if (FRAME_CACHE_STATE_COMPLETE == m_frameCacheState)
+    {
+        (void)m_frameCache.drawFrame(getLastCachedFrameIdx(), gfx, x, y);
+    }
+    else
+    {
+        gfx.drawBitmap(x, y, m_bitmap);
+    }
+}
+
+uint16_t GifImgPlayer::getLastCachedFrameIdx() const
+{
+    uint16_t frameIdx = m_frameIdx;
+
+    /* After the trailer, the last scene of the loop was shown. */
+    if (0U == frameIdx)
+    {
+        frameIdx = m_frameCache.getFrameCount();
+    }
+
+    return frameIdx - 1U;
+}
+
 void GifImgPlayer::applyDisposalMethod()
 {
     switch (m_disposalMethod)
@@ -1340,12 +1501,11 @@ size_t GifImgPlayer::loadImageDataBlock(uint8_t* block, size_t size)
     return blockSize;
 }
 
-bool GifImgPlayer::readFromCodeStream(uint8_t& data)
+bool GifImgPlayer::readFromCodeStream(const uint8_t*& data, size_t& length)
 {
     bool isSuccessful = true;
 
-    if ((0U == m_imageDataBlockLength) ||
-        (m_imageDataBlockLength <= m_imageDataBlockIdx))
+    if (m_imageDataBlockLength <= m_imageDataBlockIdx)
     {
         m_imageDataBlockLength = loadImageDataBlock(m_imageDataBlock, IMAGE_DATA_BLOCK_SIZE);
 
@@ -1359,114 +1519,113 @@ bool GifImgPlayer::readFromCodeStream(uint8_t& data)
         }
     }
 
-    if (m_imageDataBlockLength > m_imageDataBlockIdx)
+    if (true == isSuccessful)
     {
-        data = m_imageDataBlock[m_imageDataBlockIdx];
-        ++m_imageDataBlockIdx;
+        /* The LZW decoder consumes the whole remaining image data block. */
+        data                = &m_imageDataBlock[m_imageDataBlockIdx];
+        length              = m_imageDataBlockLength - m_imageDataBlockIdx;
+        m_imageDataBlockIdx = m_imageDataBlockLength;
     }
 
     return isSuccessful;
 }
 
-bool GifImgPlayer::writeToIndexStream(uint8_t data)
+bool GifImgPlayer::writeToIndexStream(const uint8_t* data, size_t length)
 {
-    bool          isSuccessful      = false;
-    PaletteColor* colorTable        = (nullptr != m_localColorTable) ? m_localColorTable : m_globalColorTable;
-    size_t        colorTableLength  = (nullptr != m_localColorTable) ? m_localColorTableLength : m_globalColorTableLength;
-    bool          isColorIndexValid = false;
-
-    /* No transparency enabled? */
-    if (false == m_isTransparencyEnabled)
-    {
-        if (colorTableLength <= data)
-        {
-            GIF_IMG_PLAYER_LOG_DEBUG("Error(%d): Invalid color index %u for color table length %u\n", __LINE__, data, static_cast<uint32_t>(colorTableLength));
-        }
-        else
-        {
-            isColorIndexValid = true;
-        }
-    }
-    /* Transparency enabled? */
-    else
-    {
-        /* Check if the color index is not the transparent one. */
-        if (m_transparentColorIndex != data)
-        {
-            if (colorTableLength <= data)
-            {
-                GIF_IMG_PLAYER_LOG_DEBUG("Error(%d): Invalid color index %u for color table length %u\n", __LINE__, data, static_cast<uint32_t>(colorTableLength));
-            }
-            else
-            {
-                isColorIndexValid = true;
-            }
-        }
-        /* The color index is the transparent one.
-         * Therefore its allowed even if it is out of range.
-         */
-        else
-        {
-            isColorIndexValid = true;
-        }
-    }
+    bool          isSuccessful     = true;
+    PaletteColor* colorTable       = (nullptr != m_localColorTable) ? m_localColorTable : m_globalColorTable;
+    size_t        colorTableLength = (nullptr != m_localColorTable) ? m_localColorTableLength : m_globalColorTableLength;
+    uint16_t      width            = m_canvas.getWidth();
 
-    /* Color table must be available and
-     * the color index must be part of it.
-     */
+    /* Color table must be available. */
     if (nullptr == colorTable)
     {
         GIF_IMG_PLAYER_LOG_DEBUG("Error(%d): No color table\n", __LINE__);
+        isSuccessful = false;
     }
-    /* Abort if the transparent color index is out of range,
-     * except transparent color index
-     */
-    else if (false == isColorIndexValid)
+    /* Without width, there is nothing to draw. */
+    else if (0U == width)
     {
         ;
     }
     else
     {
-        /* If transparency is not enabled or
-         * it is enabled and the color index is not transparent,
-         * the pixel will be drawn.
-         */
-        if ((false == m_isTransparencyEnabled) ||
-            ((true == m_isTransparencyEnabled) && (m_transparentColorIndex != data)))
+        /* Draw the indices run by run, each limited to the rest of the current row. */
+        while ((0U < length) && (true == isSuccessful))
         {
-            PaletteColor* paletteColor = &colorTable[data];
-            Color         color(paletteColor->red, paletteColor->green, paletteColor->blue);
-
-            m_canvas.drawPixel(m_posX, m_posY, color);
-        }
-
-        /* Move to the next pixel position. */
-        ++m_posX;
-        if (m_canvas.getWidth() <= m_posX)
-        {
-            m_posX = 0;
+            size_t   rowRest   = width - m_posX;
+            uint16_t runLength = static_cast<uint16_t>((length < rowRest) ? length : rowRest);
+            uint16_t offset    = 0U;
+            Color*   row       = nullptr;
+            uint16_t idx;
+
+            /* Write directly into the framebuffer, if the row is completely available. */
+            if (m_canvas.getHeight() > m_posY)
+            {
+                row = m_canvas.getFrameBufferXAddr(m_posX, m_posY, runLength, offset);
+            }
 
-            /* If the image is interlaced, use the interlace pattern. */
-            if (true == m_isInterlaced)
+            for (idx = 0U; (idx < runLength) && (true == isSuccessful); ++idx)
             {
-                /* Move to the next row within the current pass. */
-                m_posY += INTERLACE_STEP[m_interlacePass];
+                uint8_t colorIndex = data[idx];
 
-                /* If we've gone past the bottom of the image, move to the next pass. */
-                while ((m_canvas.getHeight() <= m_posY) && (3U > m_interlacePass))
+                /* The transparent color index is not drawn and allowed even if it is out of range. */
+                if ((true == m_isTransparencyEnabled) &&
+                    (m_transparentColorIndex == colorIndex))
                 {
-                    ++m_interlacePass;
-                    m_posY = INTERLACE_START[m_interlacePass];
+                    ;
+                }
+                /* Abort if the color index is not part of the color table. */
+                else if (colorTableLength <= colorIndex)
+                {
+                    GIF_IMG_PLAYER_LOG_DEBUG("Error(%d): Invalid color index %u for color table length %u\n", __LINE__, colorIndex, static_cast<uint32_t>(colorTableLength));
+                    isSuccessful = false;
+                }
+                else
+                {
+                    PaletteColor* paletteColor = &colorTable[colorIndex];
+                    Color         color(paletteColor->red, paletteColor->green, paletteColor->blue);
+
+                    if (nullptr != row)
+                    {
+                        row[idx * offset] = color;
+                    }
+                    else
+                    {
+                        m_canvas.drawPixel(m_posX + idx, m_posY, color);
+                    }
                 }
             }
-            /* Non-interlaced images are stored sequentially. */
-            else
+
+            data   += runLength;
+            length -= runLength;
+
+            /* Move to the next pixel position. */
+            m_posX += runLength;
+            if (width <= m_posX)
             {
-                ++m_posY;
+                m_posX = 0;
+
+                /* If the image is interlaced, use the interlace pattern. */
+                if (true == m_isInterlaced)
+                {
+                    /* Move to the next row within the current pass. */
+                    m_posY += INTERLACE_STEP[m_interlacePass];
+
+                    /* If we've gone past the bottom of the image, move to the next pass. */
+                    while ((m_canvas.getHeight() <= m_posY) && (3U > m_interlacePass))
+                    {
+                        ++m_interlacePass;
+                        m_posY = INTERLACE_START[m_interlacePass];
+                    }
+                }
+                /* Non-interlaced images are stored sequentially. */
+                else
+                {
+                    ++m_posY;
+                }
             }
         }
-
-        isSuccessful = true;
     }
 
     return isSuccessful;
@@ -50,6 +50,7 @@
 #include <YAGfxBitmap.h>
 #include <SimpleTimer.hpp>
 #include <IGifLoader.h>
+#include "GifFrameCache.h"
 #include <TypedAllocator.hpp>
 #include <PsAllocator.hpp>
 
@@ -76,6 +77,10 @@ typedef struct _ApplicationExtension ApplicationExtension;
  * Shows single image GIF files and plays animated GIF files, containing
  * several images inside.
  *
+ * The scenes of an animation are cached while they are decoded the first
+ * time, as long as they fit into the frame cache. All further loops are
+ * played back from the cache without decoding.
+ *
  * Specification: https://www.w3.org/Graphics/GIF/spec-gif89a.txt
  */
 class GifImgPlayer
@@ -202,6 +207,29 @@ public:
         m_isInfiniteLoop = enable;
     }
 
+    /**
+     * Enable or disable the frame cache for animations.
+     * It is enabled by default.
+     *
+     * There must no GIF be opened to set it.
+     *
+     * @param[in] enable    Enable/disable the frame cache.
+     */
+    void setFrameCache(bool enable)
+    {
+        m_isFrameCacheEnabled = enable;
+    }
+
+    /**
+     * Is the animation played back from the frame cache?
+     *
+     * @return If all scenes are cached, it will return true otherwise false.
+     */
+    bool isPlayedFromCache() const
+    {
+        return (FRAME_CACHE_STATE_COMPLETE == m_frameCacheState);
+    }
+
     /**
      * Get image width.
      *
@@ -266,6 +294,17 @@ private:
         DISPOSAL_METHOD_RESTORE_TO_PREVIOUS    /**< Restore to previous. The decoder is required to restore the area overwritten by the graphic with what was there prior to rendering the graphic. */
     };
 
+    /**
+     * Frame cache states.
+     */
+    enum FrameCacheState
+    {
+        FRAME_CACHE_STATE_EMPTY = 0,  /**< No scene is cached yet. */
+        FRAME_CACHE_STATE_FILLING,    /**< The scenes are cached during the first loop. */
+        FRAME_CACHE_STATE_COMPLETE,   /**< All scenes are cached. */
+        FRAME_CACHE_STATE_UNSUPPORTED /**< The scenes don't fit into the frame cache. */
+    };
+
     /**
      * Palette color allocator type definition.
      */
@@ -278,7 +317,7 @@ private:
 
     PaletteColorAllocator                        m_paletteColorAllocator;  /**< Palette color allocator. */
     DataAllocator                                m_dataAllocator;          /**< uint8_t allocator. */
-    YAGfxDynamicBitmap                           m_bitmap;                 /**< The bitmap contains the last drawn scene. */
+    YAGfxDynamicBitmap                           m_bitmap;                 /**< The bitmap contains the last decoded scene. */
     IGifLoader*                                  m_gifLoader;              /**< GIF file loader used to read the file. */
     YAGfxCanvas                                  m_canvas;                 /**< Canvas used for drawing each scene. Its position and size follows the image descriptor. */
     uint8_t                                      m_bgColorIndex;           /**< Background color index. Used by disposal method. */
@@ -307,6 +346,12 @@ private:
     bool        m_isFinished;     /**< Scenes are finished. */
     bool        m_isInfiniteLoop; /**< Animation is in infinite loop mode. It will overrule any loop count. */
 
+    /* Only frame cache relevant variables. */
+    GifFrameCache   m_frameCache;          /**< Decoded scenes of the animation. */
+    FrameCacheState m_frameCacheState;     /**< Frame cache state. */
+    uint16_t        m_frameIdx;            /**< Index of the next scene, which to play back from the frame cache. */
+    bool            m_isFrameCacheEnabled; /**< Is the frame cache enabled? */
+
     /**
      * Copy global color table from another one.
      *
@@ -374,6 +419,55 @@ private:
      */
     bool parseImageDescriptor();
 
+    /**
+     * Count a complete animation loop and finish the animation, after the
+     * number of repeats is reached.
+     */
+    void countLoop();
+
+    /**
+     * Add the current scene to the frame cache.
+     * The frame cache is created with the first scene. If a scene can not be
+     * cached, the frame cache is released and the animation keeps decoding.
+     */
+    void cacheScene();
+
+    /**
+     * Play back the next scene from the frame cache.
+     *
+     * @param[in] gfx   Graphic functions of the parent canvas.
+     * @param[in] x     x-coordinate of the parent canvas.
+     * @param[in] y     y-coordinate of the parent canvas.
+     */
+    void playFromCache(YAGfx& gfx, int16_t x, int16_t y);
+
+    /**
+     * Redraw the last shown scene, either from the frame cache or from the
+     * bitmap.
+     *
+     * @param[in] gfx   Graphic functions of the parent canvas.
+     * @param[in] x     x-coordinate of the parent canvas.
+     * @param[in] y     y-coordinate of the parent canvas.
+     */
+    void redrawScene(YAGfx& gfx, int16_t x, int16_t y);
+
+    /**
+     * Get the index of the last scene, which was played back from the
+     * frame cache.
+     *
+     * @return Scene index
+     */
+    uint16_t getLastCachedFrameIdx() const;
+
+    /**
+     * Release the frame cache, which couldn't be copied from another player,
+     * and continue decoding. The last scene shown by the other player is
+     * restored in the bitmap.
+     *
+     * @param[in] player    Player, which was copied.
+     */
+    void restoreSceneFromCache(const GifImgPlayer& player);
+
     /**
      * Apply the disposal method.
      */
@@ -420,23 +514,26 @@ private:
     size_t loadImageDataBlock(uint8_t* block, size_t size);
 
     /**
-     * Callback used by LZW decoder to read data from the code stream.
+     * Callback used by LZW decoder to read the next image data block from
+     * the code stream.
      *
-     * @param[out] data Code stream byte
+     * @param[out] data     Image data block
+     * @param[out] length   Image data block length in byte
      *
      * @return If successful read, it will return true otherwise false.
      */
-    bool readFromCodeStream(uint8_t& data);
+    bool readFromCodeStream(const uint8_t*& data, size_t& length);
 
     /**
-     * Callback used by LZW decoder to write data to the index stream.
-     * It will update the canvas accordingly.
+     * Callback used by LZW decoder to write a run of indices to the index stream.
+     * It will update the canvas accordingly, row by row.
      *
-     * @param[in] data  Index for color table
+     * @param[in] data      Indices for color table
+     * @param[in] length    Number of indices
      *
      * @return If successful written, it will return true otherwise false.
      */
-    bool writeToIndexStream(uint8_t data);
+    bool writeToIndexStream(const uint8_t* data, size_t length);
 };
 
 /******************************************************************************
@@ -56,13 +56,19 @@
  * Local Variables
  *****************************************************************************/
 
+/* Masks for the lowest n bits of a code, indexed by the code width. */
+const uint16_t LzwDecoder::CODE_MASK[13U] = {
+    0x0000U, 0x0001U, 0x0003U, 0x0007U, 0x000FU, 0x001FU, 0x003FU,
+    0x007FU, 0x00FFU, 0x01FFU, 0x03FFU, 0x07FFU, 0x0FFFU
+};
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
 
 LzwDecoder::LzwDecoder() :
-    m_codeAllocator(),
-    m_stackAllocator(),
+    m_prefixAllocator(),
+    m_byteAllocator(),
     m_isInitialState(true),
     m_lzwMinCodeWidth(0U),
     m_clearCode(0U),
@@ -75,15 +81,20 @@ LzwDecoder::LzwDecoder() :
     m_firstByte(0U),
     m_inCode(0U),
     m_prevCode(0U),
-    m_codes(nullptr),
+    m_prefixes(nullptr),
+    m_suffixes(nullptr),
     m_stack(nullptr),
-    m_stackPtr(nullptr)
+    m_stackPtr(nullptr),
+    m_outBuffer(nullptr),
+    m_outLength(0U),
+    m_inData(nullptr),
+    m_inLength(0U)
 {
 }
 
 LzwDecoder::LzwDecoder(const LzwDecoder& other) :
-    m_codeAllocator(),
-    m_stackAllocator(),
+    m_prefixAllocator(),
+    m_byteAllocator(),
     m_isInitialState(other.m_isInitialState),
     m_lzwMinCodeWidth(other.m_lzwMinCodeWidth),
     m_clearCode(other.m_clearCode),
@@ -96,9 +107,14 @@ LzwDecoder::LzwDecoder(const LzwDecoder& other) :
     m_firstByte(other.m_firstByte),
     m_inCode(other.m_inCode),
     m_prevCode(other.m_prevCode),
-    m_codes(nullptr),
+    m_prefixes(nullptr),
+    m_suffixes(nullptr),
     m_stack(nullptr),
-    m_stackPtr(nullptr)
+    m_stackPtr(nullptr),
+    m_outBuffer(nullptr),
+    m_outLength(0U),
+    m_inData(nullptr),
+    m_inLength(0U)
 {
     if (false == copyCode(other))
     {
@@ -118,8 +134,8 @@ LzwDecoder& LzwDecoder::operator=(const LzwDecoder& other)
 {
     if (this != &other)
     {
-        m_codeAllocator   = other.m_codeAllocator;
-        m_stackAllocator  = other.m_stackAllocator;
+        m_prefixAllocator = other.m_prefixAllocator;
+        m_byteAllocator   = other.m_byteAllocator;
         m_isInitialState  = other.m_isInitialState;
         m_lzwMinCodeWidth = other.m_lzwMinCodeWidth;
         m_clearCode       = other.m_clearCode;
@@ -133,6 +149,10 @@ LzwDecoder& LzwDecoder::operator=(const LzwDecoder& other)
         m_inCode          = other.m_inCode;
         m_prevCode        = other.m_prevCode;
 
+        /* The data block of the input stream belongs to the decode() call. */
+        m_inData          = nullptr;
+        m_inLength        = 0U;
+
         if (false == copyCode(other))
         {
             deInit();
@@ -154,13 +174,25 @@ bool LzwDecoder::init(uint8_t lzwMinCodeWidth)
 {
     bool isSuccessful = true;
 
-    if (nullptr == m_codes)
+    if (nullptr == m_prefixes)
+    {
+        m_prefixes = m_prefixAllocator.allocateArray(CODE_LIMIT);
+
+        if (nullptr == m_prefixes)
+        {
+            LOG_ERROR("Failed to allocate memory for LZW code prefixes, size: %u bytes", CODE_LIMIT * sizeof(uint16_t));
+
+            isSuccessful = false;
+        }
+    }
+
+    if (nullptr == m_suffixes)
     {
-        m_codes = m_codeAllocator.allocateArray(CODE_LIMIT);
+        m_suffixes = m_byteAllocator.allocateArray(CODE_LIMIT);
 
-        if (nullptr == m_codes)
+        if (nullptr == m_suffixes)
         {
-            LOG_ERROR("Failed to allocate memory for LZW codes, size: %u bytes", CODE_LIMIT * sizeof(uint32_t));
+            LOG_ERROR("Failed to allocate memory for LZW code suffixes, size: %u bytes", CODE_LIMIT);
 
             isSuccessful = false;
         }
@@ -168,7 +200,7 @@ bool LzwDecoder::init(uint8_t lzwMinCodeWidth)
 
     if (nullptr == m_stack)
     {
-        m_stack = m_stackAllocator.allocateArray(STACK_SIZE);
+        m_stack = m_byteAllocator.allocateArray(STACK_SIZE);
 
         if (nullptr == m_stack)
         {
@@ -178,11 +210,33 @@ bool LzwDecoder::init(uint8_t lzwMinCodeWidth)
         }
     }
 
+    if (nullptr == m_outBuffer)
+    {
+        m_outBuffer = m_byteAllocator.allocateArray(OUT_BUFFER_SIZE);
+
+        if (nullptr == m_outBuffer)
+        {
+            LOG_ERROR("Failed to allocate memory for LZW output buffer, size: %u bytes", OUT_BUFFER_SIZE);
+
+            isSuccessful = false;
+        }
+    }
+
+    /* GIF limits the min. code width to 8 bit, which avoids the first codes to exceed the code limit. */
+    if (8U < lzwMinCodeWidth)
+    {
+        LOG_ERROR("Invalid LZW min. code width: %u", lzwMinCodeWidth);
+
+        isSuccessful = false;
+    }
+
     m_lzwMinCodeWidth = lzwMinCodeWidth;
     m_clearCode       = 1U << m_lzwMinCodeWidth;
     m_endCode         = m_clearCode + 1U;
     m_stackPtr        = m_stack;
+    m_outLength       = 0U;
     m_bitsInBuffer    = 0U;
+    m_codeBuffer      = 0U;
     clear();
 
     if (false == isSuccessful)
@@ -199,12 +253,17 @@ bool LzwDecoder::decode(const ReadFromInStream& readFromInStreamFunc, const Writ
     bool     isEnd        = false;
     uint32_t code;
 
-    if ((nullptr == m_codes) ||
-        (nullptr == m_stack))
+    if ((nullptr == m_prefixes) ||
+        (nullptr == m_suffixes) ||
+        (nullptr == m_stack) ||
+        (nullptr == m_outBuffer))
     {
         isSuccessful = false;
     }
 
+    m_inData   = nullptr;
+    m_inLength = 0U;
+
     while ((false == isEnd) && (true == isSuccessful))
     {
         /* Get code */
@@ -237,23 +296,46 @@ bool LzwDecoder::decode(const ReadFromInStream& readFromInStreamFunc, const Writ
         }
     }
 
+    /* Write the remaining decoded data. */
+    if (true == isSuccessful)
+    {
+        isSuccessful = flush(writeToOutStreamFunc);
+    }
+
+    /* The data block of the input stream is only valid during decoding. */
+    m_inData   = nullptr;
+    m_inLength = 0U;
+
     return isSuccessful;
 }
 
 void LzwDecoder::deInit()
 {
-    if (nullptr != m_codes)
+    if (nullptr != m_prefixes)
+    {
+        m_prefixAllocator.deallocateArray(m_prefixes);
+        m_prefixes = nullptr;
+    }
+
+    if (nullptr != m_suffixes)
     {
-        m_codeAllocator.deallocateArray(m_codes);
-        m_codes = nullptr;
+        m_byteAllocator.deallocateArray(m_suffixes);
+        m_suffixes = nullptr;
     }
 
     if (nullptr != m_stack)
     {
-        m_stackAllocator.deallocateArray(m_stack);
+        m_byteAllocator.deallocateArray(m_stack);
         m_stack    = nullptr;
         m_stackPtr = nullptr;
     }
+
+    if (nullptr != m_outBuffer)
+    {
+        m_byteAllocator.deallocateArray(m_outBuffer);
+        m_outBuffer = nullptr;
+        m_outLength = 0U;
+    }
 }
 
 /******************************************************************************
@@ -268,17 +350,26 @@ bool LzwDecoder::copyCode(const LzwDecoder& other)
 {
     bool isSuccessful = true;
 
-    if (nullptr != m_codes)
+    if (nullptr != m_prefixes)
     {
-        m_codeAllocator.deallocateArray(m_codes);
-        m_codes = nullptr;
+        m_prefixAllocator.deallocateArray(m_prefixes);
+        m_prefixes = nullptr;
     }
 
-    if (nullptr != other.m_codes)
+    if (nullptr != m_suffixes)
     {
-        m_codes = m_codeAllocator.allocateArray(CODE_LIMIT);
+        m_byteAllocator.deallocateArray(m_suffixes);
+        m_suffixes = nullptr;
+    }
+
+    if ((nullptr != other.m_prefixes) &&
+        (nullptr != other.m_suffixes))
+    {
+        m_prefixes = m_prefixAllocator.allocateArray(CODE_LIMIT);
+        m_suffixes = m_byteAllocator.allocateArray(CODE_LIMIT);
 
-        if (nullptr == m_codes)
+        if ((nullptr == m_prefixes) ||
+            (nullptr == m_suffixes))
         {
             isSuccessful = false;
         }
@@ -286,7 +377,8 @@ bool LzwDecoder::copyCode(const LzwDecoder& other)
         {
             for (size_t idx = 0U; idx < CODE_LIMIT; ++idx)
             {
-                m_codes[idx] = other.m_codes[idx];
+                m_prefixes[idx] = other.m_prefixes[idx];
+                m_suffixes[idx] = other.m_suffixes[idx];
             }
         }
     }
@@ -300,14 +392,21 @@ bool LzwDecoder::copyStack(const LzwDecoder& other)
 
     if (nullptr != m_stack)
     {
-        m_stackAllocator.deallocateArray(m_stack);
+        m_byteAllocator.deallocateArray(m_stack);
         m_stack    = nullptr;
         m_stackPtr = nullptr;
     }
 
+    if (nullptr != m_outBuffer)
+    {
+        m_byteAllocator.deallocateArray(m_outBuffer);
+        m_outBuffer = nullptr;
+        m_outLength = 0U;
+    }
+
     if (nullptr != other.m_stack)
     {
-        m_stack = m_stackAllocator.allocateArray(STACK_SIZE);
+        m_stack = m_byteAllocator.allocateArray(STACK_SIZE);
 
         if (nullptr == m_stack)
         {
@@ -323,6 +422,25 @@ bool LzwDecoder::copyStack(const LzwDecoder& other)
         }
     }
 
+    if ((true == isSuccessful) &&
+        (nullptr != other.m_outBuffer))
+    {
+        m_outBuffer = m_byteAllocator.allocateArray(OUT_BUFFER_SIZE);
+
+        if (nullptr == m_outBuffer)
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            for (size_t idx = 0U; idx < other.m_outLength; ++idx)
+            {
+                m_outBuffer[idx] = other.m_outBuffer[idx];
+            }
+            m_outLength = other.m_outLength;
+        }
+    }
+
     return isSuccessful;
 }
 
@@ -336,46 +454,51 @@ void LzwDecoder::clear()
 
 bool LzwDecoder::getCode(uint32_t& code, const ReadFromInStream& readFromInStreamFunc)
 {
-    bool     isSuccessful   = true;
-    uint32_t codeBitsNeeded = m_codeWidth;
-
-    code                    = 0U;
+    bool isSuccessful = true;
 
-    /* Run as long as code bits are still needed. */
-    while ((0U < codeBitsNeeded) && (true == isSuccessful))
+    /* Fill the code buffer bytewise, until the whole code is available.
+     * With max. 12 bit code width, there are never more than 19 bits in the buffer.
+     */
+    while ((m_codeWidth > m_bitsInBuffer) && (true == isSuccessful))
     {
-        /* No bits in the buffer anymore? */
-        if (0U == m_bitsInBuffer)
+        /* Current data block consumed? */
+        if (0U == m_inLength)
         {
-            uint8_t data = 0U;
-
-            /* Read data from code stream. */
-            if (false == readFromInStreamFunc(data))
+            /* Read next data block from code stream. */
+            if (false == readFromInStreamFunc(m_inData, m_inLength))
             {
                 /* No more data is available, abort now. */
                 isSuccessful = false;
             }
+            else if ((nullptr == m_inData) ||
+                     (0U == m_inLength))
+            {
+                m_inLength   = 0U;
+                isSuccessful = false;
+            }
             else
             {
-                m_codeBuffer   = data;
-                m_bitsInBuffer = 8U;
+                ;
             }
         }
 
         if (true == isSuccessful)
         {
-            uint32_t bitsAvailable   = (m_bitsInBuffer < codeBitsNeeded) ? m_bitsInBuffer : codeBitsNeeded;
-            uint32_t mask            = (1U << bitsAvailable) - 1U; /* Mask for n bits. */
+            m_codeBuffer   |= static_cast<uint32_t>(*m_inData) << m_bitsInBuffer;
+            m_bitsInBuffer += 8U;
 
-            code                    |= (m_codeBuffer & mask) << (m_codeWidth - codeBitsNeeded);
+            ++m_inData;
+            --m_inLength;
+        }
+    }
 
-            /* Remove bits from code buffer. */
-            m_codeBuffer           >>= bitsAvailable;
-            m_bitsInBuffer          -= bitsAvailable;
+    if (true == isSuccessful)
+    {
+        code             = m_codeBuffer & CODE_MASK[m_codeWidth];
 
-            /* Now less bits are needed. */
-            codeBitsNeeded          -= bitsAvailable;
-        }
+        /* Remove code bits from code buffer. */
+        m_codeBuffer   >>= m_codeWidth;
+        m_bitsInBuffer  -= m_codeWidth;
     }
 
     return isSuccessful;
@@ -387,8 +510,6 @@ bool LzwDecoder::decompress(uint32_t code, const WriteToOutStream& writeToOutStr
 
     if (true == m_isInitialState)
     {
-        uint8_t data = code & 0xFFU;
-
         m_firstByte  = code;
         m_prevCode   = code;
 
@@ -397,13 +518,19 @@ bool LzwDecoder::decompress(uint32_t code, const WriteToOutStream& writeToOutStr
         {
             isSuccessful = false;
         }
-        else if (false == writeToOutStreamFunc(data))
-        {
-            isSuccessful = false;
-        }
         else
         {
-            m_isInitialState = false;
+            *m_stackPtr = code & 0xFFU;
+            ++m_stackPtr;
+
+            if (false == unwindStack(writeToOutStreamFunc))
+            {
+                isSuccessful = false;
+            }
+            else
+            {
+                m_isInitialState = false;
+            }
         }
     }
     else
@@ -431,38 +558,25 @@ bool LzwDecoder::decompress(uint32_t code, const WriteToOutStream& writeToOutStr
             /* "Unwind" code's string to stack. */
             while (code >= m_clearCode)
             {
-                /* Heads are packed to left of tails in codes. */
-
-                /* Tails */
-                *m_stackPtr = m_codes[code] & 0xFFU;
+                *m_stackPtr = m_suffixes[code];
                 ++m_stackPtr;
 
-                /* Heads*/
-                code = (m_codes[code] >> 8U) & 0x0FFFU;
+                code = m_prefixes[code];
             }
 
             m_firstByte = code;
             *m_stackPtr = code & 0xFFU;
             ++m_stackPtr;
 
-            while (m_stackPtr > m_stack)
-            {
-                --m_stackPtr;
-
-                if (false == writeToOutStreamFunc(*m_stackPtr))
-                {
-                    isSuccessful = false;
-                    break;
-                }
-            }
+            isSuccessful = unwindStack(writeToOutStreamFunc);
         }
 
         if (true == isSuccessful)
         {
             if (m_nextCode < CODE_LIMIT)
             {
-                /* Heads are packed to left of tails in codes. */
-                m_codes[m_nextCode] = (m_prevCode << 8U) | code;
+                m_prefixes[m_nextCode] = static_cast<uint16_t>(m_prevCode);
+                m_suffixes[m_nextCode] = static_cast<uint8_t>(code);
                 ++m_nextCode;
 
                 if ((m_nextCode > m_maxCode) && (m_nextCode < CODE_LIMIT))
@@ -479,6 +593,46 @@ bool LzwDecoder::decompress(uint32_t code, const WriteToOutStream& writeToOutStr
     return isSuccessful;
 }
 
+bool LzwDecoder::unwindStack(const WriteToOutStream& writeToOutStreamFunc)
+{
+    bool isSuccessful = true;
+
+    while ((m_stackPtr > m_stack) && (true == isSuccessful))
+    {
+        size_t stackLength = m_stackPtr - m_stack;
+        size_t outSpace    = OUT_BUFFER_SIZE - m_outLength;
+        size_t count       = (stackLength < outSpace) ? stackLength : outSpace;
+
+        while (0U < count)
+        {
+            --m_stackPtr;
+            m_outBuffer[m_outLength] = *m_stackPtr;
+            ++m_outLength;
+            --count;
+        }
+
+        if (OUT_BUFFER_SIZE <= m_outLength)
+        {
+            isSuccessful = flush(writeToOutStreamFunc);
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool LzwDecoder::flush(const WriteToOutStream& writeToOutStreamFunc)
+{
+    bool isSuccessful = true;
+
+    if (0U < m_outLength)
+    {
+        isSuccessful = writeToOutStreamFunc(m_outBuffer, m_outLength);
+        m_outLength  = 0U;
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
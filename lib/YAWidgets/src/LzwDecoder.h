@@ -62,16 +62,28 @@
  * LZW decoder for GIF images.
  * The code was derived from https://www.raygard.net/giflzw/
  * Thanks to Ray Gardner!
+ *
+ * The code stream is read in whole data sub-blocks and the decoded indices
+ * are written in runs, to keep the number of callback calls low.
  */
 class LzwDecoder
 {
 public:
 
-    /** Prototyp for reading from input stream (code stream). */
-    typedef std::function<bool(uint8_t& data)> ReadFromInStream;
+    /**
+     * Prototype for reading the next data block from input stream (code stream).
+     * The data block must stay valid, until the next data block is requested.
+     */
+    typedef std::function<bool(const uint8_t*& data, size_t& length)> ReadFromInStream;
+
+    /** Prototype for writing a run of decoded data to output stream. */
+    typedef std::function<bool(const uint8_t* data, size_t length)> WriteToOutStream;
 
-    /** Prototype for writing decoded data to output stream. */
-    typedef std::function<bool(uint8_t data)> WriteToOutStream;
+    /**
+     * Max. number of decoded data bytes, which are written at once to the
+     * output stream.
+     */
+    static const size_t OUT_BUFFER_SIZE = 256U;
 
     /**
      * Construct a LZW decoder object.
@@ -133,14 +145,14 @@ public:
 private:
 
     /**
-     * Memory allocator type for code.
+     * Memory allocator type for code prefixes.
      */
-    typedef TypedAllocator<uint32_t, PsAllocator> CodeAllocator;
+    typedef TypedAllocator<uint16_t, PsAllocator> PrefixAllocator;
 
     /**
-     * Memory allocator type for stack.
+     * Memory allocator type for code suffixes, stack and output buffer.
      */
-    typedef TypedAllocator<uint8_t, PsAllocator> StackAllocator;
+    typedef TypedAllocator<uint8_t, PsAllocator> ByteAllocator;
 
     /**
      * Max. number of codes.
@@ -154,8 +166,13 @@ private:
      */
     static const size_t STACK_SIZE = 4096U;
 
-    CodeAllocator       m_codeAllocator;   /**< Memory allocator for code.*/
-    StackAllocator      m_stackAllocator;  /**< Memory allocator for stack.*/
+    /**
+     * Masks for the lowest n bits of a code, indexed by the code width.
+     */
+    static const uint16_t CODE_MASK[13U];
+
+    PrefixAllocator     m_prefixAllocator; /**< Memory allocator for code prefixes.*/
+    ByteAllocator       m_byteAllocator;   /**< Memory allocator for code suffixes, stack and output buffer.*/
     bool                m_isInitialState;  /**< Is LZW decoder initialization state or not. */
     uint32_t            m_lzwMinCodeWidth; /**< LZW min. code width in bits */
     uint32_t            m_clearCode;       /**< Code for clear request. */
@@ -168,9 +185,14 @@ private:
     uint32_t            m_firstByte;       /**< First byte */
     uint32_t            m_inCode;          /**< In code */
     uint32_t            m_prevCode;        /**< Previous code */
-    uint32_t*           m_codes;           /**< Array of codes */
+    uint16_t*           m_prefixes;        /**< Prefix code of every code */
+    uint8_t*            m_suffixes;        /**< Last byte of every code */
     uint8_t*            m_stack;           /**< Stack */
     uint8_t*            m_stackPtr;        /**< Current stack pointer on stack */
+    uint8_t*            m_outBuffer;       /**< Output buffer for decoded data */
+    size_t              m_outLength;       /**< Number of decoded data bytes in the output buffer */
+    const uint8_t*      m_inData;          /**< Current data block of the input stream */
+    size_t              m_inLength;        /**< Number of remaining bytes in the current data block */
 
     /**
      * Copy code table from another LZW decoder.
@@ -182,7 +204,7 @@ private:
     bool copyCode(const LzwDecoder& other);
 
     /**
-     * Copy stack from another LZW decoder.
+     * Copy stack and output buffer from another LZW decoder.
      *
      * @param[in] other Another LZW decoder
      *
@@ -199,21 +221,40 @@ private:
      * Get the code.
      *
      * @param[out] code                 The retrieved code.
-     * @param[in] readFromInStreamFunc  Callback to read from input stream on demand.
+     * @param[in] readFromInStreamFunc  Callback to read the next data block from input stream on demand.
      *
      * @return If successful, it will return true otherwise false.
      */
     bool getCode(uint32_t& code, const ReadFromInStream& readFromInStreamFunc);
 
     /**
-     * Decompress code to output stream.
+     * Decompress code to the output buffer.
      *
      * @param[in] code                  The retrieved code.
-     * @param[in] writeToOutStreamFunc  Callback to write to output stream on demand.
+     * @param[in] writeToOutStreamFunc  Callback to write the output buffer to output stream on demand.
      *
      * @return If successful, it will return true otherwise false.
      */
     bool decompress(uint32_t code, const WriteToOutStream& writeToOutStreamFunc);
+
+    /**
+     * Move the decoded string from the stack in the right order to the
+     * output buffer. A full output buffer is written to the output stream.
+     *
+     * @param[in] writeToOutStreamFunc  Callback to write to output stream.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool unwindStack(const WriteToOutStream& writeToOutStreamFunc);
+
+    /**
+     * Write the output buffer to the output stream.
+     *
+     * @param[in] writeToOutStreamFunc  Callback to write to output stream.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool flush(const WriteToOutStream& writeToOutStreamFunc);
 };
 
 /******************************************************************************
@@ -0,0 +1,172 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   PxiFormat.h
+ * @brief  Pixelix image file format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef PXI_FORMAT_H
+#define PXI_FORMAT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAColor.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The Pixelix image format (.pxi) holds one or more frames, which are already
+ * converted to the color format of the target. It is created offline by
+ * scripts/imgconvert_pxi.py or on the target, when a bitmap image is uploaded.
+ *
+ * All values are little endian. The file starts with the file header,
+ * followed by the frames. Every frame consists of the frame header and the
+ * pixel data of the frame, row by row from top to bottom.
+ *
+ * If the file is RLE compressed, the pixel data is a sequence of packets.
+ * A packet header with the most significant bit set is followed by a single
+ * pixel, which is repeated (header & 0x7F) + 1 times. Otherwise the header is
+ * followed by header + 1 literal pixels. Packets may span several rows.
+ */
+namespace PxiFormat
+{
+
+/** File signature "PXI" */
+static const uint8_t SIGNATURE[3U]       = { 'P', 'X', 'I' };
+
+/** Supported format version */
+static const uint8_t VERSION             = 1U;
+
+/** Flag: Pixel data is RLE compressed. */
+static const uint8_t FLAG_RLE            = 0x01U;
+
+/** Packet header flag: The packet is a run of a single pixel. */
+static const uint8_t RLE_RUN_FLAG        = 0x80U;
+
+/** Max. number of pixels in a RLE packet. */
+static const uint8_t RLE_MAX_PIXELS      = 128U;
+
+/**
+ * Pixel formats.
+ */
+enum PixelFormat
+{
+    PIXEL_FORMAT_RGB888 = 0, /**< 3 bytes per pixel: red, green, blue */
+    PIXEL_FORMAT_RGB565 = 1  /**< 2 bytes per pixel: RGB565 value */
+};
+
+#if (CONFIG_COLOR_DEPTH == 16)
+
+/** Pixel format of the target color, which needs no conversion. */
+static const PixelFormat PIXEL_FORMAT_NATIVE = PIXEL_FORMAT_RGB565;
+
+#else /* (CONFIG_COLOR_DEPTH == 16) */
+
+/** Pixel format of the target color, which needs no conversion. */
+static const PixelFormat PIXEL_FORMAT_NATIVE = PIXEL_FORMAT_RGB888;
+
+#endif /* (CONFIG_COLOR_DEPTH == 16) */
+
+/**
+ * File header (size: 16 bytes).
+ */
+typedef struct _FileHeader
+{
+    uint8_t  signature[3U]; /**< File signature "PXI" */
+    uint8_t  version;       /**< Format version */
+    uint16_t width;         /**< Image width in pixels */
+    uint16_t height;        /**< Image height in pixels */
+    uint8_t  pixelFormat;   /**< Pixel format, see PixelFormat. */
+    uint8_t  flags;         /**< Flags, see FLAG_RLE. */
+    uint16_t frameCount;    /**< Number of frames */
+    uint32_t sourceCrc;     /**< CRC-32 of the source image file of a sidecar image, otherwise 0. */
+
+} __attribute__((packed)) FileHeader;
+
+/**
+ * Frame header (size: 8 bytes).
+ */
+typedef struct _FrameHeader
+{
+    uint32_t delay;    /**< Delay in ms, until the next frame is shown. */
+    uint32_t dataSize; /**< Size of the pixel data of the frame in bytes. */
+
+} __attribute__((packed)) FrameHeader;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Get the number of bytes per pixel.
+ *
+ * @param[in] pixelFormat   Pixel format
+ *
+ * @return Number of bytes per pixel or 0 for an unknown pixel format.
+ */
+static inline uint8_t getBytesPerPixel(uint8_t pixelFormat)
+{
+    uint8_t bytesPerPixel = 0U;
+
+    if (PIXEL_FORMAT_RGB888 == pixelFormat)
+    {
+        bytesPerPixel = 3U;
+    }
+    else if (PIXEL_FORMAT_RGB565 == pixelFormat)
+    {
+        bytesPerPixel = 2U;
+    }
+    else
+    {
+        ;
+    }
+
+    return bytesPerPixel;
+}
+
+} /* namespace PxiFormat */
+
+#endif /* PXI_FORMAT_H */
+
+/** @} */
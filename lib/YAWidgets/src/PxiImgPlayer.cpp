@@ -0,0 +1,641 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   PxiImgPlayer.cpp
+ * @brief  Pixelix image player
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PxiImgPlayer.h"
+#include "PxiFormat.h"
+#include <Logging.h>
+#include <string.h>
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void toColor(const uint8_t* src, uint8_t pixelFormat, Color& color);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+PxiImgPlayer::PxiImgPlayer() :
+    m_width(0U),
+    m_height(0U),
+    m_frameCount(0U),
+    m_pixelFormat(PxiFormat::PIXEL_FORMAT_NATIVE),
+    m_isCompressed(false),
+    m_frames(nullptr),
+    m_frameData(nullptr),
+    m_frameDataSizes(nullptr),
+    m_delays(nullptr),
+    m_rowBuffer(nullptr),
+    m_frameIdx(0U),
+    m_timer()
+{
+}
+
+PxiImgPlayer::PxiImgPlayer(const PxiImgPlayer& player) :
+    m_width(0U),
+    m_height(0U),
+    m_frameCount(0U),
+    m_pixelFormat(PxiFormat::PIXEL_FORMAT_NATIVE),
+    m_isCompressed(false),
+    m_frames(nullptr),
+    m_frameData(nullptr),
+    m_frameDataSizes(nullptr),
+    m_delays(nullptr),
+    m_rowBuffer(nullptr),
+    m_frameIdx(0U),
+    m_timer()
+{
+    (void)copy(player);
+}
+
+PxiImgPlayer& PxiImgPlayer::operator=(const PxiImgPlayer& player)
+{
+    if (this != &player)
+    {
+        close();
+        (void)copy(player);
+    }
+
+    return *this;
+}
+
+PxiImgPlayer::Ret PxiImgPlayer::open(FS& fs, const String& fileName)
+{
+    Ret  ret = RET_OK;
+    File fd  = fs.open(fileName);
+
+    if (false == fd)
+    {
+        ret = RET_FILE_NOT_FOUND;
+    }
+    else
+    {
+        DataAllocator allocator;
+        size_t        size = fd.size();
+        uint8_t*      data = allocator.allocateArray(size);
+
+        if (nullptr == data)
+        {
+            ret = RET_IMG_TOO_BIG;
+        }
+        /* The whole file is read at once. */
+        else if (size != fd.read(data, size))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else
+        {
+            ret = open(data, size);
+        }
+
+        if (nullptr != data)
+        {
+            allocator.deallocateArray(data);
+        }
+
+        fd.close();
+    }
+
+    return ret;
+}
+
+PxiImgPlayer::Ret PxiImgPlayer::open(const uint8_t* data, size_t size)
+{
+    return parse(data, size, false);
+}
+
+PxiImgPlayer::Ret PxiImgPlayer::openMapped(const uint8_t* data, size_t size)
+{
+    return parse(data, size, true);
+}
+
+void PxiImgPlayer::close()
+{
+    if (nullptr != m_frames)
+    {
+        delete[] m_frames;
+        m_frames = nullptr;
+    }
+
+    if (nullptr != m_frameData)
+    {
+        delete[] m_frameData;
+        m_frameData = nullptr;
+    }
+
+    if (nullptr != m_frameDataSizes)
+    {
+        delete[] m_frameDataSizes;
+        m_frameDataSizes = nullptr;
+    }
+
+    if (nullptr != m_delays)
+    {
+        delete[] m_delays;
+        m_delays = nullptr;
+    }
+
+    if (nullptr != m_rowBuffer)
+    {
+        delete[] m_rowBuffer;
+        m_rowBuffer = nullptr;
+    }
+
+    m_width        = 0U;
+    m_height       = 0U;
+    m_frameCount   = 0U;
+    m_pixelFormat  = PxiFormat::PIXEL_FORMAT_NATIVE;
+    m_isCompressed = false;
+    m_frameIdx     = 0U;
+    m_timer.stop();
+}
+
+bool PxiImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
+{
+    bool isSuccessful = true;
+
+    if ((nullptr == m_frames) &&
+        (nullptr == m_frameData))
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        /* Only an animation needs the frame delay. */
+        if (1U < m_frameCount)
+        {
+            if (false == m_timer.isTimerRunning())
+            {
+                m_timer.start(m_delays[m_frameIdx]);
+            }
+            else if (true == m_timer.isTimeout())
+            {
+                ++m_frameIdx;
+
+                if (m_frameCount <= m_frameIdx)
+                {
+                    m_frameIdx = 0U;
+                }
+
+                m_timer.start(m_delays[m_frameIdx]);
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        if (nullptr != m_frames)
+        {
+            gfx.drawBitmap(x, y, m_frames[m_frameIdx]);
+        }
+        /* Mapped frames are decoded directly to the destination. */
+        else
+        {
+            RowFunc drawRow = [&gfx, x, y, this](uint16_t rowY, const Color* row) {
+                int16_t posY = y + static_cast<int16_t>(rowY);
+
+                if ((0 <= posY) &&
+                    (gfx.getHeight() > posY))
+                {
+                    gfx.drawHLine(x, posY, m_width, row);
+                }
+            };
+
+            (void)decodeFrame(m_frameData[m_frameIdx], m_frameDataSizes[m_frameIdx], drawRow);
+        }
+    }
+
+    return isSuccessful;
+}
+
+const YAGfxBitmap* PxiImgPlayer::getFrame(uint16_t index) const
+{
+    const YAGfxBitmap* frame = nullptr;
+
+    if ((nullptr != m_frames) &&
+        (m_frameCount > index))
+    {
+        frame = &m_frames[index];
+    }
+
+    return frame;
+}
+
+uint32_t PxiImgPlayer::getDelay(uint16_t index) const
+{
+    uint32_t delay = 0U;
+
+    if ((nullptr != m_delays) &&
+        (m_frameCount > index))
+    {
+        delay = m_delays[index];
+    }
+
+    return delay;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool PxiImgPlayer::copy(const PxiImgPlayer& player)
+{
+    bool isSuccessful = true;
+
+    if (nullptr != player.m_frames)
+    {
+        m_frames = new (std::nothrow) YAGfxDynamicBitmap[player.m_frameCount];
+        m_delays = new (std::nothrow) uint32_t[player.m_frameCount];
+
+        if ((nullptr == m_frames) ||
+            (nullptr == m_delays))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            uint16_t frameIdx = 0U;
+
+            while ((true == isSuccessful) && (player.m_frameCount > frameIdx))
+            {
+                m_frames[frameIdx] = player.m_frames[frameIdx];
+                m_delays[frameIdx] = player.m_delays[frameIdx];
+
+                /* The assignment fails silently, if no memory is available. */
+                if (false == m_frames[frameIdx].isAllocated())
+                {
+                    isSuccessful = false;
+                }
+                else
+                {
+                    ++frameIdx;
+                }
+            }
+        }
+    }
+    /* Mapped pixel data is shared, only the references are copied. */
+    else if (nullptr != player.m_frameData)
+    {
+        m_frameData      = new (std::nothrow) const uint8_t*[player.m_frameCount];
+        m_frameDataSizes = new (std::nothrow) uint32_t[player.m_frameCount];
+        m_delays         = new (std::nothrow) uint32_t[player.m_frameCount];
+        m_rowBuffer      = new (std::nothrow) Color[player.m_width];
+
+        if ((nullptr == m_frameData) ||
+            (nullptr == m_frameDataSizes) ||
+            (nullptr == m_delays) ||
+            (nullptr == m_rowBuffer))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            memcpy(m_frameData, player.m_frameData, player.m_frameCount * sizeof(m_frameData[0U]));
+            memcpy(m_frameDataSizes, player.m_frameDataSizes, player.m_frameCount * sizeof(m_frameDataSizes[0U]));
+            memcpy(m_delays, player.m_delays, player.m_frameCount * sizeof(m_delays[0U]));
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    if (false == isSuccessful)
+    {
+        LOG_ERROR("Failed to copy image with %u frames.", player.m_frameCount);
+        close();
+    }
+    else
+    {
+        m_width        = player.m_width;
+        m_height       = player.m_height;
+        m_frameCount   = player.m_frameCount;
+        m_pixelFormat  = player.m_pixelFormat;
+        m_isCompressed = player.m_isCompressed;
+        m_frameIdx     = player.m_frameIdx;
+        m_timer        = player.m_timer;
+    }
+
+    return isSuccessful;
+}
+
+PxiImgPlayer::Ret PxiImgPlayer::parse(const uint8_t* data, size_t size, bool isMapped)
+{
+    Ret                   ret = RET_OK;
+    PxiFormat::FileHeader fileHeader;
+
+    close();
+
+    if ((nullptr == data) ||
+        (sizeof(fileHeader) > size))
+    {
+        ret = RET_FILE_FORMAT_INVALID;
+    }
+    else
+    {
+        memcpy(&fileHeader, data, sizeof(fileHeader));
+
+        if (0 != memcmp(fileHeader.signature, PxiFormat::SIGNATURE, sizeof(PxiFormat::SIGNATURE)))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if ((PxiFormat::VERSION != fileHeader.version) ||
+                 (0U == PxiFormat::getBytesPerPixel(fileHeader.pixelFormat)) ||
+                 (0U != (fileHeader.flags & ~PxiFormat::FLAG_RLE)))
+        {
+            ret = RET_FILE_FORMAT_UNSUPPORTED;
+        }
+        else if ((0U == fileHeader.width) ||
+                 (0U == fileHeader.height) ||
+                 (0U == fileHeader.frameCount))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else
+        {
+            if (false == isMapped)
+            {
+                m_frames = new (std::nothrow) YAGfxDynamicBitmap[fileHeader.frameCount];
+            }
+            else
+            {
+                m_frameData      = new (std::nothrow) const uint8_t*[fileHeader.frameCount];
+                m_frameDataSizes = new (std::nothrow) uint32_t[fileHeader.frameCount];
+            }
+
+            m_delays    = new (std::nothrow) uint32_t[fileHeader.frameCount];
+            m_rowBuffer = new (std::nothrow) Color[fileHeader.width];
+
+            if ((nullptr == m_delays) ||
+                (nullptr == m_rowBuffer) ||
+                ((false == isMapped) && (nullptr == m_frames)) ||
+                ((true == isMapped) && ((nullptr == m_frameData) || (nullptr == m_frameDataSizes))))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+        }
+    }
+
+    if (RET_OK == ret)
+    {
+        size_t   dataIdx  = sizeof(fileHeader);
+        uint16_t frameIdx = 0U;
+
+        m_width           = fileHeader.width;
+        m_height          = fileHeader.height;
+        m_frameCount      = fileHeader.frameCount;
+        m_pixelFormat     = fileHeader.pixelFormat;
+        m_isCompressed    = (0U != (fileHeader.flags & PxiFormat::FLAG_RLE));
+
+        while ((RET_OK == ret) && (m_frameCount > frameIdx))
+        {
+            PxiFormat::FrameHeader frameHeader;
+
+            if (sizeof(frameHeader) > (size - dataIdx))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                memcpy(&frameHeader, &data[dataIdx], sizeof(frameHeader));
+                dataIdx += sizeof(frameHeader);
+
+                if (frameHeader.dataSize > (size - dataIdx))
+                {
+                    ret = RET_FILE_FORMAT_INVALID;
+                }
+                else if (true == isMapped)
+                {
+                    /* Validate only, the pixel data stays in place. */
+                    RowFunc ignoreRow = [](uint16_t rowY, const Color* row) {
+                        (void)rowY;
+                        (void)row;
+                    };
+
+                    if (false == decodeFrame(&data[dataIdx], frameHeader.dataSize, ignoreRow))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+                    else
+                    {
+                        m_frameData[frameIdx]      = &data[dataIdx];
+                        m_frameDataSizes[frameIdx] = frameHeader.dataSize;
+                    }
+                }
+                else if (false == m_frames[frameIdx].create(m_width, m_height))
+                {
+                    ret = RET_IMG_TOO_BIG;
+                }
+                else
+                {
+                    YAGfxDynamicBitmap& frame    = m_frames[frameIdx];
+                    RowFunc             storeRow = [&frame, this](uint16_t rowY, const Color* row) {
+                        frame.drawHLine(0, rowY, m_width, row);
+                    };
+
+                    if (false == decodeFrame(&data[dataIdx], frameHeader.dataSize, storeRow))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+                }
+
+                if (RET_OK == ret)
+                {
+                    m_delays[frameIdx] = frameHeader.delay;
+                    dataIdx           += frameHeader.dataSize;
+
+                    ++frameIdx;
+                }
+            }
+        }
+
+        /* The row buffer is only needed to draw mapped frames. */
+        if ((RET_OK == ret) &&
+            (false == isMapped))
+        {
+            delete[] m_rowBuffer;
+            m_rowBuffer = nullptr;
+        }
+    }
+
+    if (RET_OK != ret)
+    {
+        close();
+    }
+
+    return ret;
+}
+
+bool PxiImgPlayer::decodeFrame(const uint8_t* data, size_t dataSize, const RowFunc& rowFunc)
+{
+    bool     isValid       = true;
+    uint8_t  bytesPerPixel = PxiFormat::getBytesPerPixel(m_pixelFormat);
+    uint32_t pixelCount    = static_cast<uint32_t>(m_width) * m_height;
+    uint32_t pixelIdx      = 0U;
+    size_t   dataIdx       = 0U;
+    uint16_t x             = 0U;
+    uint16_t y             = 0U;
+
+    /* Uncompressed pixel data is handled like a single literal packet. */
+    if ((false == m_isCompressed) &&
+        ((pixelCount * bytesPerPixel) != dataSize))
+    {
+        isValid = false;
+    }
+
+    while ((true == isValid) && (pixelCount > pixelIdx))
+    {
+        bool     isRun = false;
+        uint32_t count = pixelCount;
+        size_t   size  = 0U;
+
+        if (true == m_isCompressed)
+        {
+            if (dataSize <= dataIdx)
+            {
+                isValid = false;
+            }
+            else
+            {
+                uint8_t header = data[dataIdx];
+
+                isRun          = (0U != (header & PxiFormat::RLE_RUN_FLAG));
+                count          = static_cast<uint32_t>(header & ~PxiFormat::RLE_RUN_FLAG) + 1U;
+
+                ++dataIdx;
+            }
+        }
+
+        size = (true == isRun) ? bytesPerPixel : (count * bytesPerPixel);
+
+        if ((false == isValid) ||
+            ((pixelCount - pixelIdx) < count) ||
+            ((dataSize - dataIdx) < size))
+        {
+            isValid = false;
+        }
+        else
+        {
+            Color    color;
+            uint32_t idx = 0U;
+
+            while (count > idx)
+            {
+                /* A run needs the color only once. */
+                if ((false == isRun) || (0U == idx))
+                {
+                    toColor(&data[dataIdx + ((true == isRun) ? 0U : (idx * bytesPerPixel))], m_pixelFormat, color);
+                }
+
+                m_rowBuffer[x] = color;
+                ++x;
+
+                if (m_width <= x)
+                {
+                    rowFunc(y, m_rowBuffer);
+
+                    x = 0U;
+                    ++y;
+                }
+
+                ++idx;
+            }
+
+            pixelIdx += count;
+            dataIdx  += size;
+        }
+    }
+
+    /* All pixel data shall be consumed. */
+    if ((true == isValid) &&
+        (dataSize != dataIdx))
+    {
+        isValid = false;
+    }
+
+    return isValid;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Convert a pixel of the pixel data to a color.
+ *
+ * @param[in] src           Pixel in the pixel data
+ * @param[in] pixelFormat   Pixel format of the pixel data
+ * @param[out] color        Color
+ */
+static void toColor(const uint8_t* src, uint8_t pixelFormat, Color& color)
+{
+    if (PxiFormat::PIXEL_FORMAT_RGB565 == pixelFormat)
+    {
+        uint16_t value = static_cast<uint16_t>(src[0U]) | (static_cast<uint16_t>(src[1U]) << 8U);
+
+        color.fromRgb565(value);
+    }
+    else
+    {
+        color.set(src[0U], src[1U], src[2U]);
+    }
+}
@@ -0,0 +1,299 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   PxiImgPlayer.h
+ * @brief  Pixelix image player
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef PXI_IMG_PLAYER_H
+#define PXI_IMG_PLAYER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <FS.h>
+#include <YAGfx.h>
+#include <YAGfxBitmap.h>
+#include <SimpleTimer.hpp>
+#include <TypedAllocator.hpp>
+#include <PsAllocator.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Shows single frame and plays multi frame Pixelix images (.pxi), see
+ * PxiFormat.h for the file format.
+ *
+ * All frames are decoded, while the image is opened. The file is read with a
+ * single call and the pixels need no conversion, if they are stored in the
+ * color format of the target. Playing back switches only between the frames.
+ *
+ * Alternatively an image in memory mapped flash can be opened with
+ * openMapped(). Then the frames are not copied, the current frame is
+ * decoded row by row directly to the destination, every time its drawn.
+ */
+class PxiImgPlayer
+{
+public:
+
+    /**
+     * Possible return values with more information.
+     */
+    enum Ret
+    {
+        RET_OK = 0,                  /**< Successful */
+        RET_FILE_NOT_FOUND,          /**< File not found. */
+        RET_FILE_FORMAT_INVALID,     /**< Invalid file format. */
+        RET_FILE_FORMAT_UNSUPPORTED, /**< File format is not supported. */
+        RET_IMG_TOO_BIG              /**< Image size is too big. */
+    };
+
+    /**
+     * Constructs the player.
+     */
+    PxiImgPlayer();
+
+    /**
+     * Constructs the player by copying another one.
+     *
+     * @param[in] player    Player, which to copy
+     */
+    PxiImgPlayer(const PxiImgPlayer& player);
+
+    /**
+     * Destroys the player.
+     */
+    ~PxiImgPlayer()
+    {
+        close();
+    }
+
+    /**
+     * Assigns a player.
+     *
+     * @param[in] player    Player, which to assign
+     *
+     * @return Player
+     */
+    PxiImgPlayer& operator=(const PxiImgPlayer& player);
+
+    /**
+     * Open a Pixelix image file and decode all frames.
+     * An already opened image will be closed.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] fileName  Name of the file
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret open(FS& fs, const String& fileName);
+
+    /**
+     * Open a Pixelix image, which is already in memory, and decode all frames.
+     * An already opened image will be closed. The data is not needed anymore
+     * after this call.
+     *
+     * @param[in] data  Pixelix image data
+     * @param[in] size  Size of the data in bytes
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret open(const uint8_t* data, size_t size);
+
+    /**
+     * Open a Pixelix image, which is in memory mapped flash, without copying
+     * the frames. The data is only validated and must stay valid, until the
+     * image is closed. An already opened image will be closed.
+     *
+     * @param[in] data  Pixelix image data
+     * @param[in] size  Size of the data in bytes
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret openMapped(const uint8_t* data, size_t size);
+
+    /**
+     * Close the image and release all frames.
+     */
+    void close();
+
+    /**
+     * Draw the current frame. If the image has several frames, the next frame
+     * is selected after the delay of the current frame.
+     *
+     * @param[in] gfx   Graphic functions
+     * @param[in] x     Upper left corner (x-coordinate) of the image
+     * @param[in] y     Upper left corner (y-coordinate) of the image
+     *
+     * @return If an image is opened, it will return true otherwise false.
+     */
+    bool play(YAGfx& gfx, int16_t x = 0, int16_t y = 0);
+
+    /**
+     * Get image width in pixels.
+     *
+     * @return Image width in pixels
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get image height in pixels.
+     *
+     * @return Image height in pixels
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * Get the number of frames.
+     *
+     * @return Number of frames
+     */
+    uint16_t getFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    /**
+     * Is the image drawn directly from memory mapped data?
+     *
+     * @return If mapped, it will return true otherwise false.
+     */
+    bool isMapped() const
+    {
+        return nullptr != m_frameData;
+    }
+
+    /**
+     * Get a decoded frame.
+     *
+     * @param[in] index Frame index
+     *
+     * @return Frame or nullptr, if the index is invalid or the image is mapped.
+     */
+    const YAGfxBitmap* getFrame(uint16_t index) const;
+
+    /**
+     * Get the delay of a frame.
+     *
+     * @param[in] index Frame index
+     *
+     * @return Delay in ms or 0, if the index is invalid.
+     */
+    uint32_t getDelay(uint16_t index) const;
+
+private:
+
+    /**
+     * Data allocator type, used for reading the whole file.
+     */
+    typedef TypedAllocator<uint8_t, PsAllocator> DataAllocator;
+
+    /**
+     * Function, which is called for every decoded row of a frame.
+     *
+     * @param[in] y     y-coordinate of the row in the frame
+     * @param[in] row   Colors of the row, one per pixel
+     */
+    typedef std::function<void(uint16_t y, const Color* row)> RowFunc;
+
+    uint16_t            m_width;          /**< Image width in pixels */
+    uint16_t            m_height;         /**< Image height in pixels */
+    uint16_t            m_frameCount;     /**< Number of frames */
+    uint8_t             m_pixelFormat;    /**< Pixel format of the pixel data */
+    bool                m_isCompressed;   /**< Is the pixel data RLE compressed? */
+    YAGfxDynamicBitmap* m_frames;         /**< Decoded frames */
+    const uint8_t**     m_frameData;      /**< Pixel data of every frame in mapped memory */
+    uint32_t*           m_frameDataSizes; /**< Pixel data size of every frame in bytes */
+    uint32_t*           m_delays;         /**< Delay of every frame in ms */
+    Color*              m_rowBuffer;      /**< Buffer for one decoded row */
+    uint16_t            m_frameIdx;       /**< Index of the current frame */
+    SimpleTimer         m_timer;          /**< Timer used for the frame delay */
+
+    /**
+     * Copy all frames and delays from another player.
+     *
+     * @param[in] player    Player, which to copy
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool copy(const PxiImgPlayer& player);
+
+    /**
+     * Parse a Pixelix image and either decode all frames or only validate
+     * them and keep the pixel data in place.
+     *
+     * @param[in] data      Pixelix image data
+     * @param[in] size      Size of the data in bytes
+     * @param[in] isMapped  Keep the pixel data in place?
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret parse(const uint8_t* data, size_t size, bool isMapped);
+
+    /**
+     * Decode the pixel data of a single frame row by row.
+     *
+     * @param[in] data      Pixel data of the frame
+     * @param[in] dataSize  Size of the pixel data in bytes
+     * @param[in] rowFunc   Function, which is called for every decoded row.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool decodeFrame(const uint8_t* data, size_t dataSize, const RowFunc& rowFunc);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* PXI_IMG_PLAYER_H */
+
+/** @} */
@@ -0,0 +1,268 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   PxiImgWriter.cpp
+ * @brief  Pixelix image writer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PxiImgWriter.h"
+#include "PxiFormat.h"
+#include <Logging.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool PxiImgWriter::write(FS& fs, const String& fileName, const YAGfxBitmap& bitmap, bool isCompressed, uint32_t sourceCrc)
+{
+    bool          isSuccessful  = false;
+    uint8_t       bytesPerPixel = PxiFormat::getBytesPerPixel(PxiFormat::PIXEL_FORMAT_NATIVE);
+    uint32_t      pixelCount    = static_cast<uint32_t>(bitmap.getWidth()) * bitmap.getHeight();
+    size_t        rawSize       = pixelCount * bytesPerPixel;
+    DataAllocator allocator;
+    uint8_t*      rawData       = nullptr;
+    uint8_t*      rleData       = nullptr;
+    size_t        rleSize       = 0U;
+
+    if (0U == pixelCount)
+    {
+        LOG_WARNING("Empty bitmap can not be written to %s.", fileName.c_str());
+    }
+    else
+    {
+        rawData = allocator.allocateArray(rawSize);
+    }
+
+    if (nullptr != rawData)
+    {
+        convert(bitmap, rawData);
+
+        if (true == isCompressed)
+        {
+            rleData = allocator.allocateArray(rawSize);
+
+            /* The compressed data is only used, if its smaller. */
+            if (nullptr != rleData)
+            {
+                rleSize = compress(rawData, pixelCount, bytesPerPixel, rleData, rawSize - 1U);
+            }
+        }
+
+        File fd = fs.open(fileName, FILE_WRITE);
+
+        if (false == fd)
+        {
+            LOG_WARNING("Failed to create %s.", fileName.c_str());
+        }
+        else
+        {
+            PxiFormat::FileHeader  fileHeader;
+            PxiFormat::FrameHeader frameHeader;
+            const uint8_t*         data     = (0U < rleSize) ? rleData : rawData;
+            size_t                 dataSize = (0U < rleSize) ? rleSize : rawSize;
+
+            memcpy(fileHeader.signature, PxiFormat::SIGNATURE, sizeof(fileHeader.signature));
+            fileHeader.version     = PxiFormat::VERSION;
+            fileHeader.width       = bitmap.getWidth();
+            fileHeader.height      = bitmap.getHeight();
+            fileHeader.pixelFormat = PxiFormat::PIXEL_FORMAT_NATIVE;
+            fileHeader.flags       = (0U < rleSize) ? PxiFormat::FLAG_RLE : 0U;
+            fileHeader.frameCount  = 1U;
+            fileHeader.sourceCrc   = sourceCrc;
+
+            frameHeader.delay      = 0U;
+            frameHeader.dataSize   = dataSize;
+
+            if ((sizeof(fileHeader) == fd.write(reinterpret_cast<const uint8_t*>(&fileHeader), sizeof(fileHeader))) &&
+                (sizeof(frameHeader) == fd.write(reinterpret_cast<const uint8_t*>(&frameHeader), sizeof(frameHeader))) &&
+                (dataSize == fd.write(data, dataSize)))
+            {
+                isSuccessful = true;
+            }
+
+            fd.close();
+
+            /* Don't leave a broken file behind. */
+            if (false == isSuccessful)
+            {
+                LOG_WARNING("Failed to write %s.", fileName.c_str());
+                (void)fs.remove(fileName);
+            }
+        }
+    }
+
+    if (nullptr != rleData)
+    {
+        allocator.deallocateArray(rleData);
+    }
+
+    if (nullptr != rawData)
+    {
+        allocator.deallocateArray(rawData);
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void PxiImgWriter::convert(const YAGfxBitmap& bitmap, uint8_t* data)
+{
+    uint16_t y = 0U;
+
+    while (bitmap.getHeight() > y)
+    {
+        uint16_t     offset = 0U;
+        const Color* row    = bitmap.getFrameBufferXAddr(0, y, bitmap.getWidth(), offset);
+        uint16_t     x      = 0U;
+
+        while (bitmap.getWidth() > x)
+        {
+            const Color& color = (nullptr != row) ? row[x * offset] : bitmap.getColor(x, y);
+
+            if (PxiFormat::PIXEL_FORMAT_RGB565 == PxiFormat::PIXEL_FORMAT_NATIVE)
+            {
+                uint16_t value = color.toRgb565();
+
+                data[0U] = static_cast<uint8_t>(value & 0xFFU);
+                data[1U] = static_cast<uint8_t>(value >> 8U);
+                data += 2U;
+            }
+            else
+            {
+                data[0U] = color.getRed();
+                data[1U] = color.getGreen();
+                data[2U] = color.getBlue();
+                data += 3U;
+            }
+
+            ++x;
+        }
+
+        ++y;
+    }
+}
+
+size_t PxiImgWriter::compress(const uint8_t* src, uint32_t pixelCount, uint8_t bytesPerPixel, uint8_t* dst, size_t dstSize)
+{
+    bool     isFull   = false;
+    size_t   dstIdx   = 0U;
+    uint32_t pixelIdx = 0U;
+
+    while ((false == isFull) && (pixelCount > pixelIdx))
+    {
+        const uint8_t* pixel = &src[pixelIdx * bytesPerPixel];
+        uint32_t       count = 1U;
+        bool           isRun = false;
+
+        /* Count equal pixels. */
+        while ((pixelCount > (pixelIdx + count)) &&
+               (PxiFormat::RLE_MAX_PIXELS > count) &&
+               (0 == memcmp(pixel, &pixel[count * bytesPerPixel], bytesPerPixel)))
+        {
+            ++count;
+        }
+
+        if (1U < count)
+        {
+            isRun = true;
+        }
+        /* Collect pixels until the next run starts. */
+        else
+        {
+            while ((pixelCount > (pixelIdx + count)) &&
+                   (PxiFormat::RLE_MAX_PIXELS > count) &&
+                   ((pixelCount <= (pixelIdx + count + 1U)) ||
+                    (0 != memcmp(&pixel[count * bytesPerPixel], &pixel[(count + 1U) * bytesPerPixel], bytesPerPixel))))
+            {
+                ++count;
+            }
+        }
+
+        size_t size = 1U + ((true == isRun) ? bytesPerPixel : (count * bytesPerPixel));
+
+        if ((dstSize - dstIdx) < size)
+        {
+            isFull = true;
+        }
+        else
+        {
+            dst[dstIdx] = static_cast<uint8_t>(count - 1U);
+
+            if (true == isRun)
+            {
+                dst[dstIdx] |= PxiFormat::RLE_RUN_FLAG;
+            }
+
+            memcpy(&dst[dstIdx + 1U], pixel, size - 1U);
+
+            dstIdx   += size;
+            pixelIdx += count;
+        }
+    }
+
+    return (true == isFull) ? 0U : dstIdx;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,133 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   PxiImgWriter.h
+ * @brief  Pixelix image writer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef PXI_IMG_WRITER_H
+#define PXI_IMG_WRITER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <FS.h>
+#include <YAGfxBitmap.h>
+#include <TypedAllocator.hpp>
+#include <PsAllocator.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Writes a bitmap as single frame Pixelix image (.pxi) in the pixel format
+ * of the target, see PxiFormat.h for the file format.
+ */
+class PxiImgWriter
+{
+public:
+
+    /**
+     * Construct a new Pixelix image writer.
+     */
+    PxiImgWriter()
+    {
+    }
+
+    /**
+     * Destroy the Pixelix image writer.
+     */
+    ~PxiImgWriter()
+    {
+    }
+
+    /**
+     * Write a bitmap to a Pixelix image file. An existing file is overwritten.
+     * The pixel data is only stored RLE compressed, if it becomes smaller.
+     *
+     * @param[in] fs            Filesystem
+     * @param[in] fileName      Name of the file
+     * @param[in] bitmap        Bitmap, which to write
+     * @param[in] isCompressed  Try to compress the pixel data with RLE.
+     * @param[in] sourceCrc     CRC-32 of the source image file, if it is a sidecar image.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool write(FS& fs, const String& fileName, const YAGfxBitmap& bitmap, bool isCompressed = true, uint32_t sourceCrc = 0U);
+
+private:
+
+    /**
+     * Data allocator type, used for the pixel data.
+     */
+    typedef TypedAllocator<uint8_t, PsAllocator> DataAllocator;
+
+    /**
+     * Convert the bitmap to pixel data in the pixel format of the target.
+     *
+     * @param[in] bitmap    Bitmap
+     * @param[out] data     Pixel data buffer, which must hold all pixels.
+     */
+    void convert(const YAGfxBitmap& bitmap, uint8_t* data);
+
+    /**
+     * RLE compress pixel data.
+     *
+     * @param[in] src           Pixel data
+     * @param[in] pixelCount    Number of pixels
+     * @param[in] bytesPerPixel Number of bytes per pixel
+     * @param[out] dst          Buffer for the compressed pixel data
+     * @param[in] dstSize       Buffer size in bytes
+     *
+     * @return Size of the compressed pixel data in bytes or 0, if the buffer is too small.
+     */
+    size_t compress(const uint8_t* src, uint32_t pixelCount, uint8_t bytesPerPixel, uint8_t* dst, size_t dstSize);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* PXI_IMG_WRITER_H */
+
+/** @} */
@@ -0,0 +1,144 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TextStrip.cpp
+ * @brief  Off-screen text strip
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TextStrip.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool TextStrip::create(uint16_t width, uint16_t height)
+{
+    bool isSuccessful = YAGfxAlphaBitmap::create(width, height);
+
+    if (true == isSuccessful)
+    {
+        fillAlpha(0U);
+    }
+
+    return isSuccessful;
+}
+
+void TextStrip::drawPixel(int16_t x, int16_t y, const Color& color)
+{
+    YAGfxAlphaBitmap::drawPixel(x, y, color);
+    setAlpha(x, y, UINT8_MAX);
+}
+
+void TextStrip::blendPixel(int16_t x, int16_t y, const Color& color, uint8_t alpha)
+{
+    if ((0 > x) ||
+        (0 > y) ||
+        (getWidth() <= x) ||
+        (getHeight() <= y) ||
+        (0U == alpha))
+    {
+        /* Outside the strip or transparent, nothing to draw. */
+        ;
+    }
+    else
+    {
+        uint8_t  dstAlpha = getAlpha(x, y);
+        uint16_t newAlpha = alpha + (((UINT8_MAX - alpha) * dstAlpha) / UINT8_MAX);
+
+        /* A transparent pixel takes over the color, otherwise the colors are mixed. */
+        if (0U == dstAlpha)
+        {
+            YAGfxAlphaBitmap::drawPixel(x, y, color);
+        }
+        else
+        {
+            YAGfxAlphaBitmap::blendPixel(x, y, color, alpha);
+        }
+
+        setAlpha(x, y, static_cast<uint8_t>(newAlpha));
+    }
+}
+
+Color* TextStrip::getFrameBufferXAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset)
+{
+    (void)x;
+    (void)y;
+    (void)length;
+    (void)offset;
+
+    return nullptr;
+}
+
+Color* TextStrip::getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset)
+{
+    (void)x;
+    (void)y;
+    (void)length;
+    (void)offset;
+
+    return nullptr;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
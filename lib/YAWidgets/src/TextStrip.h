@@ -0,0 +1,175 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TextStrip.h
+ * @brief  Off-screen text strip
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef TEXT_STRIP_H
+#define TEXT_STRIP_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * An off-screen bitmap, which holds a pre-rendered text line.
+ * After creation all pixels are transparent. Every drawn pixel becomes
+ * opaque and every blended pixel keeps its coverage, therefore the strip
+ * can be blended over any background with the source over blend mode.
+ *
+ * Drawing into the strip is done pixel by pixel, because only then the
+ * alpha channel can be maintained. The framebuffer is still available
+ * for reading, which keeps blending the strip fast.
+ */
+class TextStrip : public YAGfxAlphaBitmap
+{
+public:
+
+    /**
+     * Constructs the text strip, but without internal buffer.
+     */
+    TextStrip() :
+        YAGfxAlphaBitmap()
+    {
+    }
+
+    /**
+     * Destroys the text strip.
+     */
+    ~TextStrip()
+    {
+    }
+
+    /**
+     * Create internal pixel buffer and alpha channel.
+     * All pixels are transparent after creation.
+     * If a pixel buffer already exists, it will fail.
+     *
+     * @param[in] width     Strip width in pixels
+     * @param[in] height    Strip height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height);
+
+    /**
+     * Draw a single pixel at given position, which becomes opaque.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const Color& color) final;
+
+    /**
+     * Blend a single pixel with a specific color into the existing pixel.
+     * The coverage is kept in the alpha channel, therefore anti-aliased
+     * text is blended correctly into any background later on.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     * @param[in] alpha Color coverage [0; 255] - 0: transparent / 255: opaque.
+     */
+    void blendPixel(int16_t x, int16_t y, const Color& color, uint8_t alpha) final;
+
+    /* Keep the const framebuffer access of the bitmap. */
+    using YAGfxAlphaBitmap::getFrameBufferXAddr;
+    using YAGfxAlphaBitmap::getFrameBufferYAddr;
+
+    /**
+     * No write access to the framebuffer, which forces every drawing
+     * operation to use drawPixel().
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[in]   length  Requested number of pixels
+     * @param[out]  offset  Address offset to the next pixel in x-direction
+     *
+     * @return nullptr
+     */
+    Color* getFrameBufferXAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) final;
+
+    /**
+     * No write access to the framebuffer, which forces every drawing
+     * operation to use drawPixel().
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[in]   length  Requested number of pixels
+     * @param[out]  offset  Address offset to the next pixel in y-direction
+     *
+     * @return nullptr
+     */
+    Color* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) final;
+
+private:
+
+    /**
+     * Not allowed to copy the text strip.
+     *
+     * @param[in] strip Text strip, which to copy.
+     */
+    TextStrip(const TextStrip& strip)            = delete;
+
+    /**
+     * Not allowed to assign a text strip.
+     *
+     * @param[in] strip Text strip, which to assign.
+     *
+     * @return Text strip
+     */
+    TextStrip& operator=(const TextStrip& strip) = delete;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TEXT_STRIP_H */
+
+/** @} */
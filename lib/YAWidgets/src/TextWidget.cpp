@@ -40,11 +40,22 @@
 #include <Fonts.h>
 #include <Util.h>
 #include <Logging.h>
+#include <MemUtil.h>
 
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
 
+#ifndef CONFIG_TEXT_STRIP_MAX_PIXELS
+/** Max. number of pixels of a text strip, if no PSRAM is available. */
+#define CONFIG_TEXT_STRIP_MAX_PIXELS        2048U
+#endif /* CONFIG_TEXT_STRIP_MAX_PIXELS */
+
+#ifndef CONFIG_TEXT_STRIP_MAX_PIXELS_PSRAM
+/** Max. number of pixels of a text strip, if PSRAM is available. */
+#define CONFIG_TEXT_STRIP_MAX_PIXELS_PSRAM  65536U
+#endif /* CONFIG_TEXT_STRIP_MAX_PIXELS_PSRAM */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -117,6 +128,8 @@ TextWidget::TextWidget(uint16_t width, uint16_t height, int16_t x, int16_t y) :
         DEFAULT_TEXT_COLOR_GRADIENT_LENGTH,
         DEFAULT_TEXT_COLOR_GRADIENT_VERTICAL),
     m_gfxText(DEFAULT_FONT, m_solidBrush),
+    m_stripState(STRIP_STATE_INVALID),
+    m_strip(),
     m_hAlign(Alignment::Horizontal::HORIZONTAL_LEFT),
     m_vAlign(Alignment::Vertical::VERTICAL_TOP),
     m_vAlignPosY(0)
@@ -151,6 +164,8 @@ TextWidget::TextWidget(const String& str, const Color& color) :
         DEFAULT_TEXT_COLOR_GRADIENT_LENGTH,
         DEFAULT_TEXT_COLOR_GRADIENT_VERTICAL),
     m_gfxText(DEFAULT_FONT, m_solidBrush),
+    m_stripState(STRIP_STATE_INVALID),
+    m_strip(),
     m_hAlign(Alignment::Horizontal::HORIZONTAL_LEFT),
     m_vAlign(Alignment::Vertical::VERTICAL_TOP),
     m_vAlignPosY(0)
@@ -192,6 +207,8 @@ TextWidget::TextWidget(const TextWidget& widget) :
     m_solidBrush(widget.m_solidBrush),
     m_linearGradientBrush(widget.m_linearGradientBrush),
     m_gfxText(widget.m_gfxText),
+    m_stripState(STRIP_STATE_INVALID), /* The strip is rendered again on demand. */
+    m_strip(),
     m_hAlign(widget.m_hAlign),
     m_vAlign(widget.m_vAlign),
     m_vAlignPosY(widget.m_vAlignPosY)
@@ -223,6 +240,9 @@ TextWidget& TextWidget::operator=(const TextWidget& widget)
         m_hAlign              = widget.m_hAlign;
         m_vAlign              = widget.m_vAlign;
         m_vAlignPosY          = widget.m_vAlignPosY;
+
+        /* The strip is rendered again on demand. */
+        invalidateStrip();
     }
 
     return *this;
@@ -273,6 +293,8 @@ void TextWidget::clear()
     m_ast.clear();
 
     m_vAlignPosY = 0U;
+
+    invalidateStrip();
 }
 
 String TextWidget::getStr() const
@@ -629,6 +651,7 @@ void TextWidget::paint(YAGfx& gfx)
         m_ast           = std::move(m_astNew);
 
         alignTextVertical();
+        invalidateStrip();
     }
 
     /* Update text brightness, even if fade effect is disabled. */
@@ -640,15 +663,132 @@ void TextWidget::paint(YAGfx& gfx)
 
     /* Update the cursor position, it may have changed by scrolling. */
     calculateCursorPos(cursorX, cursorY);
-    m_gfxText.setTextCursorPos(cursorX, cursorY);
 
-    /* Show the text. */
-    show(gfx, m_ast, m_scrollCtrl.isEnabled());
+    /* A scrolling text line is rendered once into the strip, afterwards only
+     * the visible part is blended into the canvas.
+     */
+    if (true == isStripUsable())
+    {
+        /* The strip depends on the canvas height. */
+        if ((STRIP_STATE_VALID == m_stripState) &&
+            (gfx.getHeight() != m_strip.getHeight()))
+        {
+            invalidateStrip();
+        }
+
+        if (STRIP_STATE_INVALID == m_stripState)
+        {
+            m_stripState = (true == renderStrip(gfx)) ? STRIP_STATE_VALID : STRIP_STATE_UNSUPPORTED;
+        }
+    }
+
+    if ((true == isStripUsable()) &&
+        (STRIP_STATE_VALID == m_stripState))
+    {
+        gfx.drawBitmap(cursorX, 0, m_strip, YAGfx::BLEND_MODE_SRC_OVER);
+    }
+    else
+    {
+        /* Show the text. */
+        m_gfxText.setTextCursorPos(cursorX, cursorY);
+        show(gfx, m_ast, m_scrollCtrl.isEnabled());
+    }
 
     /* Handle fade effect. */
     handleFadeEffect();
 }
 
+bool TextWidget::isStripUsable()
+{
+    bool isUsable = false;
+
+    if ((true == m_scrollCtrl.isEnabled()) &&
+        (ScrollController::DIRECTION_HORIZONTAL == m_scrollCtrl.getDirection()) &&
+        (FADE_STATE_IDLE == m_fadeState) &&
+        (FADING_BRIGHTNESS_HIGH == m_fadeBrightness) &&
+        (STRIP_STATE_UNSUPPORTED != m_stripState))
+    {
+        isUsable = m_gfxText.getBrush().isRowSolid();
+    }
+
+    return isUsable;
+}
+
+bool TextWidget::isStripSupported() const
+{
+    uint32_t astLength   = m_ast.length();
+    uint32_t idx         = 0U;
+    bool     isSupported = true;
+
+    /* Keywords, which move the text cursor or result in colors depended
+     * on the x-coordinate, are not supported.
+     */
+    while ((astLength > idx) && (true == isSupported))
+    {
+        const TWToken& token = m_ast[idx];
+
+        if (TWToken::TYPE_LINE_FEED == token.getType())
+        {
+            isSupported = false;
+        }
+        else if (TWToken::TYPE_KEYWORD == token.getType())
+        {
+            const char* keyword = token.getStr().c_str();
+
+            if ((true == isKeywordEqual("{lgh *}", keyword)) ||
+                (true == isKeywordEqual("{hm *}", keyword)) ||
+                ((true == isKeywordEqual("{lgtc}", keyword)) && (false == m_linearGradientBrush.isRowSolid())))
+            {
+                isSupported = false;
+            }
+        }
+        else
+        {
+            /* Nothing to do. */
+            ;
+        }
+
+        ++idx;
+    }
+
+    return isSupported;
+}
+
+bool TextWidget::renderStrip(YAGfx& gfx)
+{
+    bool     isSuccessful = false;
+    uint16_t width        = m_scrollCtrl.getContentSize();
+    uint16_t height       = gfx.getHeight();
+    uint32_t maxPixels    = CONFIG_TEXT_STRIP_MAX_PIXELS;
+
+    if (true == MemUtil::isPsramAvailable())
+    {
+        maxPixels = CONFIG_TEXT_STRIP_MAX_PIXELS_PSRAM;
+    }
+
+    m_strip.release();
+
+    if ((0U < width) &&
+        (0U < height) &&
+        ((static_cast<uint32_t>(width) * height) <= maxPixels) &&
+        (true == isStripSupported()) &&
+        (true == m_strip.create(width, height)))
+    {
+        int16_t cursorX = 0;
+        int16_t cursorY = 0;
+
+        /* Same baseline as on the canvas, but starting at the left border of the strip. */
+        calculateCursorPos(cursorX, cursorY);
+        m_gfxText.setTextCursorPos(0, cursorY);
+
+        show(m_strip, m_ast, true);
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
 void TextWidget::specialCharacterCodeKeywordToText(TWAbstractSyntaxTree& ast)
 {
     uint32_t astLength = ast.length();
@@ -662,15 +802,16 @@ void TextWidget::specialCharacterCodeKeywordToText(TWAbstractSyntaxTree& ast)
         {
             if (true == isKeywordEqual("{0x*}", token.getStr().c_str()))
             {
-                size_t  length      = token.getStr().length();
-                String  charCodeStr = token.getStr().substring(1U, length - 1U); /* {0x*} */
-                uint8_t charCode    = 0U;
-                bool    convStatus  = Util::strToUInt8(charCodeStr, charCode);
+                size_t   length       = token.getStr().length();
+                String   codePointStr = token.getStr().substring(1U, length - 1U); /* {0x*} */
+                uint32_t codePoint    = 0U;
+                String   charStr;
 
-                if (true == convStatus)
+                if ((true == Util::strToUInt32(codePointStr, codePoint)) &&
+                    (true == Utf8::appendCodePoint(charStr, codePoint)))
                 {
                     token.setType(TWToken::TYPE_TEXT);
-                    token.setStr(String(static_cast<char>(charCode)));
+                    token.setStr(charStr);
                 }
             }
         }
@@ -942,9 +1083,8 @@ void TextWidget::handleSolidColor(YAGfx& gfx, const String& keyword)
     {
         Color textColor = colorRGB888;
 
-        textColor.setIntensity(m_fadeBrightness);
-
         m_solidBrush.setColor(textColor);
+        m_solidBrush.setIntensity(m_fadeBrightness);
         m_gfxText.setBrush(m_solidBrush);
     }
 }
@@ -984,11 +1124,9 @@ bool TextWidget::handleLinearGradient(YAGfx& gfx, const String& keyword)
             Color startColor = colorRGB888_1;
             Color endColor   = colorRGB888_2;
 
-            startColor.setIntensity(m_fadeBrightness);
-            endColor.setIntensity(m_fadeBrightness);
-
             m_linearGradientBrush.setStartColor(startColor);
             m_linearGradientBrush.setEndColor(endColor);
+            m_linearGradientBrush.setIntensity(m_fadeBrightness);
             m_linearGradientBrush.setOffset(offset);
             m_linearGradientBrush.setLength(gradLength);
 
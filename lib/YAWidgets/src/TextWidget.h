@@ -54,6 +54,7 @@
 #include "Alignment.h"
 #include "TWAbstractSyntaxTree.h"
 #include "ScrollController.h"
+#include "TextStrip.h"
 
 /******************************************************************************
  * Macros
@@ -83,7 +84,13 @@
  * - "{vt}" : Vertical alignment top
  * - "{vc}" : Vertical alignment center
  * - "{vb}" : Vertical alignment bottom
- * - "{0xCC}" : Special character hex code
+ * - "{0xCC}" : Special character by its Unicode code point in hex, e.g. {0xB0} for the degree sign
+ *
+ * A single text line, which scrolls from right to left, is rendered only once
+ * into an off-screen text strip. Every frame just blends the visible part of
+ * the strip into the canvas. This is not possible during fading or with
+ * colors, which depend on the x-coordinate. In these cases the text is
+ * rendered every frame.
  */
 class TextWidget : public Widget
 {
@@ -142,6 +149,7 @@ public:
     {
         Widget::setHeight(height);
         alignTextVertical();
+        invalidateStrip();
     }
 
     /**
@@ -182,22 +190,29 @@ public:
 
     /**
      * Get brush used to draw text.
+     * Because the brush may be changed by the caller, a pre-rendered text
+     * is rendered again.
      *
      * @return Brush used to draw text.
      */
     YAGfxBrush& getBrush()
     {
+        invalidateStrip();
+
         return m_gfxText.getBrush();
     }
 
     /**
      * Set brush used to draw text. The brush must be kept alive as long as the text widget is used.
+     * If the brush is changed later on, it shall be set again. Otherwise a
+     * pre-rendered scrolling text may not reflect the change.
      *
      * @param[in] brush Brush used to draw text.
      */
     void setBrush(YAGfxBrush& brush)
     {
         m_gfxText.setBrush(brush);
+        invalidateStrip();
     }
 
     /**
@@ -206,6 +221,7 @@ public:
     void setSolidBrush()
     {
         m_gfxText.setBrush(m_solidBrush);
+        invalidateStrip();
     }
 
     /**
@@ -214,6 +230,7 @@ public:
     void setLinearGradientBrush()
     {
         m_gfxText.setBrush(m_linearGradientBrush);
+        invalidateStrip();
     }
 
     /**
@@ -225,6 +242,7 @@ public:
     {
         m_solidBrush.setColor(color);
         m_gfxText.setBrush(m_solidBrush);
+        invalidateStrip();
     }
 
     /**
@@ -244,6 +262,7 @@ public:
         m_linearGradientBrush.setLength(length);
         m_linearGradientBrush.setDirection(vertical);
         m_gfxText.setBrush(m_linearGradientBrush);
+        invalidateStrip();
     }
 
     /**
@@ -255,6 +274,7 @@ public:
     {
         m_gfxText.setFont(font);
         m_prepareNewText = true;
+        invalidateStrip();
     }
 
     /**
@@ -309,6 +329,7 @@ public:
     {
         m_vAlign = align;
         alignTextVertical();
+        invalidateStrip();
     }
 
     /**
@@ -385,6 +406,16 @@ private:
      */
     static const FormatKeywordRow FORMAT_KEYWORD_TABLE_2[];
 
+    /**
+     * State of the off-screen text strip.
+     */
+    enum StripState
+    {
+        STRIP_STATE_INVALID = 0, /**< Strip needs to be rendered. */
+        STRIP_STATE_VALID,       /**< Strip contains the current text. */
+        STRIP_STATE_UNSUPPORTED  /**< Current text can't be rendered into a strip. */
+    };
+
     /**
      * Fade state.
      */
@@ -411,6 +442,8 @@ private:
     YAGfxSolidBrush          m_solidBrush;          /**< Solid text color brush. */
     YAGfxLinearGradientBrush m_linearGradientBrush; /**< Linear gradient text color brush. */
     YAGfxText                m_gfxText;             /**< GFX for current text. */
+    StripState               m_stripState;          /**< State of the text strip. */
+    TextStrip                m_strip;               /**< Pre-rendered scrolling text line. */
 
     /**
      * Horizontal alignment which is the default one.
@@ -498,6 +531,42 @@ private:
      */
     void calculateCursorPos(int16_t& curX, int16_t& curY) const;
 
+    /**
+     * Mark the text strip as invalid and release it. It will be rendered
+     * again, when needed.
+     */
+    void invalidateStrip()
+    {
+        m_stripState = STRIP_STATE_INVALID;
+        m_strip.release();
+    }
+
+    /**
+     * Can the current text be shown with the text strip in this frame?
+     * This requires a single line text, which scrolls horizontal with
+     * full brightness and colors, which don't depend on the x-coordinate.
+     *
+     * @return If the text strip can be used, it will return true otherwise false.
+     */
+    bool isStripUsable();
+
+    /**
+     * Check whether the format keywords of the current text allow to
+     * render it into a strip.
+     *
+     * @return If supported, it will return true otherwise false.
+     */
+    bool isStripSupported() const;
+
+    /**
+     * Render the current text into the text strip.
+     *
+     * @param[in] gfx   Graphics interface, which determines the strip height.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool renderStrip(YAGfx& gfx);
+
     /**
      * Handle the fade effect.
      */
@@ -523,7 +592,7 @@ private:
     /**
      * Walks throught the AST and integrates the special character code
      * keywords. Thats means the token will be converted to a text token and
-     * its string will be the character code.
+     * its string will be the UTF-8 encoded character.
      *
      * @param[in, out] ast  The abstract syntax tree (AST)
      */
@@ -36,6 +36,7 @@
 #include "Utf8.h"
 
 #include <stdint.h>
+#include <BaseGfxUtf8.hpp>
 
 /******************************************************************************
  * Compiler Switches
@@ -53,6 +54,7 @@
  * Prototypes
  *****************************************************************************/
 
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -80,129 +82,75 @@ void Utf8::toIntern(const String& utf8, String& intern)
 
     while (utf8Length > utf8Index)
     {
-        uint16_t ucs2Char   = 0U;
-        char     internChar = 0;
+        uint32_t codePoint = 0U;
 
-        if (0 == (utf8[utf8Index] & 0x80))
-        {
-            ucs2Char   = utf8[utf8Index];
-            utf8Index += 1U;
-        }
-        else if (0xC0 == (utf8[utf8Index] & 0xE0))
-        {
-            ucs2Char   = ((utf8[utf8Index] & 0x1F) << 6) | (utf8[utf8Index + 1U] & 0x3F);
-            utf8Index += 2U;
-        }
-        else if (0xE0 == (utf8[utf8Index] & 0xF0))
-        {
-            ucs2Char   = ((utf8[utf8Index] & 0x0F) << 12) | ((utf8[utf8Index + 1U] & 0x3F) << 6) | (utf8[utf8Index + 2U] & 0x3F);
-            utf8Index += 3U;
-        }
-        else if (0xF0 == (utf8[utf8Index] & 0xF8))
-        {
-            ucs2Char   = ((utf8[utf8Index] & 0x07) << 18) | ((utf8[utf8Index + 1U] & 0x3F) << 12) | ((utf8[utf8Index + 2U] & 0x03) << 6) | (utf8[utf8Index + 3U] & 0x3F);
-            utf8Index += 4U;
-        }
-        else
-        {
-            ucs2Char   = 0U;
-            utf8Index += 1U;
-        }
+        utf8Index += BaseGfxUtf8::decode(&utf8.c_str()[utf8Index], codePoint);
 
         /* U+0000 - U+001F */
-        if (0x0020U > ucs2Char)
+        if (0x0020U > codePoint)
         {
             /* Skip control characters, except line feed.*/
-            if (0x000AU == ucs2Char)
+            if (0x000AU == codePoint)
             {
-                internChar = static_cast<char>(ucs2Char);
+                (void)appendCodePoint(intern, codePoint);
             }
         }
-        /* U+0020 - U+007E */
-        else if (0x007FU > ucs2Char)
-        {
-            internChar = static_cast<char>(ucs2Char);
-        }
-        /* U+007F - U+00A0 */
-        else if (0x00A1U > ucs2Char)
+        /* U+007F - U+009F */
+        else if ((0x007FU <= codePoint) && (0x00A0U > codePoint))
         {
-            /* N/A */
+            /* Skip control characters. */
+            ;
         }
-        /* 0x00A1 - 0x00FF ? */
-        else if (0x0100U > ucs2Char)
+        /* Invalid or truncated sequence. */
+        else if (BaseGfxUtf8::REPLACEMENT_CHARACTER == codePoint)
         {
-            internChar = static_cast<char>(ucs2Char - 0x22U);
+            /* Skip it. */
+            ;
         }
-        /* Single character extensions. */
         else
         {
-            switch (ucs2Char)
-            {
-            case 0x011DU:
-                internChar = 0xDE;
-                break;
-            case 0x152U:
-                internChar = 0xDF;
-                break;
-
-            case 0x153U:
-                internChar = 0xE0;
-                break;
-
-            case 0x160U:
-                internChar = 0xE1;
-                break;
-
-            case 0x161U:
-                internChar = 0xE2;
-                break;
-
-            case 0x178U:
-                internChar = 0xE3;
-                break;
-
-            case 0x17DU:
-                internChar = 0xE4;
-                break;
-
-            case 0x17EU:
-                internChar = 0xE5;
-                break;
-
-            case 0x0EA4U:
-                internChar = 0xE6;
-                break;
-
-            case 0x13A0U:
-                internChar = 0xE7;
-                break;
-
-            case 0x2022U:
-                internChar = 0xE8;
-                break;
-
-            case 0x2026U:
-                internChar = 0xE9;
-                break;
-
-            case 0x20ACU:
-                internChar = 0xEA;
-                break;
-
-            case 0xFFFDU:
-                internChar = 0xEB;
-                break;
-
-            default:
-                break;
-            }
+            (void)appendCodePoint(intern, codePoint);
         }
+    }
+}
 
-        if (0 != internChar)
-        {
-            intern += internChar;
-        }
+bool Utf8::appendCodePoint(String& str, uint32_t codePoint)
+{
+    bool isAppended = true;
+
+    if (0x0080U > codePoint)
+    {
+        str += static_cast<char>(codePoint);
+    }
+    else if (0x0800U > codePoint)
+    {
+        str += static_cast<char>(0xC0U | (codePoint >> 6U));
+        str += static_cast<char>(0x80U | (codePoint & 0x3FU));
     }
+    /* Surrogates are not valid code points. */
+    else if ((0xD800U <= codePoint) && (0xE000U > codePoint))
+    {
+        isAppended = false;
+    }
+    else if (0x10000U > codePoint)
+    {
+        str += static_cast<char>(0xE0U | (codePoint >> 12U));
+        str += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+        str += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+    else if (0x110000U > codePoint)
+    {
+        str += static_cast<char>(0xF0U | (codePoint >> 18U));
+        str += static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU));
+        str += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+        str += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+    else
+    {
+        isAppended = false;
+    }
+
+    return isAppended;
 }
 
 /******************************************************************************
@@ -44,6 +44,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
+#include <stdint.h>
 #include <WString.h>
 
 namespace Utf8
@@ -64,18 +65,35 @@ namespace Utf8
 /**
  * Convert UTF-8 string to internal string representation.
  *
- * The internal string representation is a single byte character encoding, which
- * is used for text rendering. It contains only characters which can be rendered
- * by the used font. All other characters are skipped.
+ * The internal string representation is UTF-8 encoded as well, but contains
+ * only valid sequences of characters which can be rendered. All other
+ * characters are skipped. Characters without a glyph in the used font are
+ * skipped later during rendering.
  *
- * Note, the control characters (U+0000 - U+001F) are skipped, except line feed (U+000A).
- * The line feed is kept, because it is used for multi-line text rendering.
+ * Note, the control characters (U+0000 - U+001F, U+007F - U+009F) are skipped,
+ * except line feed (U+000A). The line feed is kept, because it is used for
+ * multi-line text rendering.
+ *
+ * Invalid or truncated sequences are skipped. They are decoded to the
+ * replacement character (U+FFFD), see BaseGfxUtf8::decode(), therefore it is
+ * skipped too.
  *
  * @param[in]   utf8    UTF-8 string
  * @param[out]  intern  Internal string representation
  */
 extern void toIntern(const String& utf8, String& intern);
 
+/**
+ * Append a single character UTF-8 encoded to a string.
+ * Invalid code points (surrogates and beyond U+10FFFF) are skipped.
+ *
+ * @param[in,out]   str         String
+ * @param[in]       codePoint   Unicode code point of the character
+ *
+ * @return If the character is appended, it will return true otherwise false.
+ */
+extern bool appendCodePoint(String& str, uint32_t codePoint);
+
 } /* namespace Utf8 */
 
 #endif /* UTF8_H */
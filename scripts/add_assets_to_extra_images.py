@@ -0,0 +1,161 @@
+"""
+This script builds the asset bundle from the ./assets directory and adds it to
+FLASH_EXTRA_IMAGES with the offset of the assets partition in the partition table.
+This way the asset bundle will be flashed together with the firmware binary during
+the upload process.
+
+Boards without a assets partition can't draw images from flash. For them the
+filesystem image is built from the ./data and the ./assets directory, so the
+images are in the filesystem instead.
+"""
+
+# MIT License
+#
+# Copyright (c) 2019 - 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# pyright: reportUndefinedVariable=false
+
+################################################################################
+# Imports
+################################################################################
+
+import os
+import re
+import shutil
+import sys
+from typing import Optional, Tuple
+
+import assetbundle_build
+import imgconvert_pxi
+Import("env") # pylint: disable=undefined-variable
+
+################################################################################
+# Variables
+################################################################################
+
+PROJECT_DIR = env.subst("$PROJECT_DIR") # pylint: disable=undefined-variable
+BUILD_DIR = env.subst("$BUILD_DIR") # pylint: disable=undefined-variable
+ASSET_DIR = os.path.join(PROJECT_DIR, "assets")
+ASSET_BUNDLE = os.path.join(BUILD_DIR, "assets.bin")
+FS_STAGING_DIR = os.path.join(BUILD_DIR, "data")
+
+################################################################################
+# Classes
+################################################################################
+
+################################################################################
+# Functions
+################################################################################
+
+def get_asset_partition() -> Optional[Tuple[int, int]]:
+    """
+    Get the assets partition from the partition table of the environment.
+
+    Returns:
+        tuple: Offset and size in bytes or None, if the board has no assets partition.
+    """
+    partition = None
+    partition_table_file_name = os.path.join(PROJECT_DIR, env.BoardConfig().get("build.partitions")) # pylint: disable=undefined-variable
+
+    if os.path.isfile(partition_table_file_name):
+        partition = assetbundle_build.get_partition(partition_table_file_name, assetbundle_build.PARTITION_LABEL)
+    else:
+        print(f"Partition table {partition_table_file_name} not found.", file=sys.stderr)
+
+    return partition
+
+def get_pixel_format() -> int:
+    """
+    Get the pixel format of the assets by the color depth in the build flags.
+
+    Returns:
+        int: Pixel format
+    """
+    pixel_format = imgconvert_pxi.PIXEL_FORMAT_RGB888
+
+    for build_flag in env["BUILD_FLAGS"]: # pylint: disable=undefined-variable
+        match = re.search("-D CONFIG_COLOR_DEPTH=([0-9]+).*", build_flag)
+        if match and (int(match.group(1)) == 16):
+            pixel_format = imgconvert_pxi.PIXEL_FORMAT_RGB565
+
+    return pixel_format
+
+def handle_upload(partition: Tuple[int, int]) -> None:
+    """
+    Handle the upload process by building the asset bundle and adding it to FLASH_EXTRA_IMAGES.
+
+    Args:
+        partition (tuple): Offset and size of the assets partition in bytes.
+    """
+    assets = assetbundle_build.find_assets(ASSET_DIR)
+    bundle = assetbundle_build.build(assets, get_pixel_format(), True)
+
+    if bundle is None:
+        raise ValueError("Failed to build the asset bundle!")
+
+    if len(bundle) > partition[1]:
+        raise ValueError(f"Asset bundle with {len(bundle)} bytes doesn't fit into the assets partition!")
+
+    os.makedirs(BUILD_DIR, exist_ok=True)
+
+    with open(ASSET_BUNDLE, "wb") as file:
+        file.write(bundle)
+
+    print(f"Asset bundle: {len(assets)} asset(s), {len(bundle)} bytes")
+
+    env.Append( # pylint: disable=undefined-variable
+        FLASH_EXTRA_IMAGES=[
+            (f"0x{partition[0]:X}", f"{ASSET_BUNDLE}")
+        ]
+    )
+
+def handle_buildfs() -> None:
+    """
+    Handle the filesystem build process by staging the data and the asset directory.
+    The filesystem image is built from the staging directory.
+    """
+    data_dir = env.subst("$PROJECT_DATA_DIR") # pylint: disable=undefined-variable
+
+    if os.path.isdir(FS_STAGING_DIR):
+        shutil.rmtree(FS_STAGING_DIR)
+
+    shutil.copytree(data_dir, FS_STAGING_DIR)
+
+    for name, file_path in assetbundle_build.find_assets(ASSET_DIR):
+        staged_file_path = os.path.join(FS_STAGING_DIR, name.lstrip("/"))
+
+        os.makedirs(os.path.dirname(staged_file_path), exist_ok=True)
+        shutil.copyfile(file_path, staged_file_path)
+
+    env.Replace(PROJECT_DATA_DIR=FS_STAGING_DIR) # pylint: disable=undefined-variable
+
+################################################################################
+# Main
+################################################################################
+
+if os.path.isdir(ASSET_DIR):
+    asset_partition = get_asset_partition()
+
+    if asset_partition is not None:
+        if "upload" in sys.argv:
+            handle_upload(asset_partition)
+    elif ("buildfs" in sys.argv) or ("uploadfs" in sys.argv):
+        handle_buildfs()
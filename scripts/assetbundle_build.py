@@ -0,0 +1,316 @@
+"""Builds the asset bundle for the asset flash partition.
+
+Usage: python assetbundle_build.py [<asset directory>] [--output FILE] [--depth 16|32] [--no-rle] [--partition-table CSV] [--fs-dir DIR]
+
+All images (BMP, GIF, PNG) in the asset directory are converted to the
+Pixelix image format (.pxi), already existing Pixelix images are taken as
+they are. Every asset gets the full path of its file in the filesystem as
+name, e.g. "/configuration/sun.bmp" for ./assets/configuration/sun.bmp.
+If such a file doesn't exist in the filesystem, the firmware draws the
+asset directly from the mapped flash.
+
+The asset directory must be separate from the data directory, which the
+filesystem image is built from. A bundled image, which is in the
+filesystem too, is never drawn from flash. Such images are reported.
+
+With --partition-table the bundle size is checked against the asset
+partition and the command to flash the bundle is shown.
+
+The upload via USB builds and flashes the bundle automatically, see
+add_assets_to_extra_images.py.
+
+See lib/YAWidgets/src/AssetBundle.h for the bundle format.
+
+Requires Pillow (pip install pillow).
+"""
+
+# MIT License
+#
+# Copyright (c) 2019 - 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+################################################################################
+# Imports
+################################################################################
+import argparse
+import os
+import struct
+import sys
+
+import imgconvert_pxi
+
+################################################################################
+# Variables
+################################################################################
+
+# Bundle signature.
+SIGNATURE = b"PXB"
+
+# Bundle version.
+VERSION = 1
+
+# Size of the bundle header in bytes.
+HEADER_SIZE = 16
+
+# Size of an entry in the entry table in bytes.
+ENTRY_SIZE = 64
+
+# Max. size of an asset name in bytes, including the string termination.
+MAX_NAME_SIZE = 56
+
+# Alignment of the asset data in bytes.
+DATA_ALIGNMENT = 4
+
+# Image file extensions, which are converted.
+IMAGE_FILE_EXTENSIONS = [".bmp", ".gif", ".png"]
+
+# Pixelix image file extension.
+PXI_FILE_EXTENSION = ".pxi"
+
+# Label of the asset partition.
+PARTITION_LABEL = "assets"
+
+################################################################################
+# Classes
+################################################################################
+
+################################################################################
+# Functions
+################################################################################
+
+def find_assets(asset_dir):
+    """Find all images in the asset directory.
+
+    Args:
+        asset_dir (str): Asset directory
+
+    Returns:
+        list: Assets (name, file path), sorted by name.
+    """
+    assets = []
+
+    for root, _, files in os.walk(asset_dir):
+        for file_name in files:
+            ext = os.path.splitext(file_name)[1].lower()
+
+            if (ext in IMAGE_FILE_EXTENSIONS) or (ext == PXI_FILE_EXTENSION):
+                file_path = os.path.join(root, file_name)
+                name = "/" + os.path.relpath(file_path, asset_dir).replace(os.sep, "/")
+
+                assets.append((name, file_path))
+
+    return sorted(assets)
+
+def load_asset(file_path, pixel_format, use_rle):
+    """Load an asset and convert it to the Pixelix image format.
+
+    Args:
+        file_path (str): Image file path
+        pixel_format (int): Pixel format
+        use_rle (bool): Use RLE compression, if the pixel data becomes smaller.
+
+    Returns:
+        bytes: Pixelix image
+    """
+    if os.path.splitext(file_path)[1].lower() == PXI_FILE_EXTENSION:
+        with open(file_path, "rb") as file:
+            data = file.read()
+    else:
+        width, height, frames = imgconvert_pxi.load_frames(file_path)
+        data = imgconvert_pxi.convert(width, height, frames, pixel_format, use_rle)
+
+    return data
+
+def find_shadowed_assets(assets, fs_dir):
+    """Find all assets, which exist in the filesystem data directory too.
+    The firmware prefers the filesystem, so these assets are never used.
+
+    Args:
+        assets (list): Assets (name, file path)
+        fs_dir (str): Data directory of the filesystem image
+
+    Returns:
+        list: Names of the shadowed assets
+    """
+    shadowed = []
+
+    for name, _ in assets:
+        if os.path.isfile(os.path.join(fs_dir, name.lstrip("/"))):
+            shadowed.append(name)
+
+    return shadowed
+
+def build(assets, pixel_format, use_rle):
+    """Build the asset bundle.
+
+    Args:
+        assets (list): Assets (name, file path)
+        pixel_format (int): Pixel format
+        use_rle (bool): Use RLE compression, if the pixel data becomes smaller.
+
+    Returns:
+        bytes: Asset bundle or None, if an asset name is too long.
+    """
+    entries = bytearray()
+    data = bytearray()
+    offset = HEADER_SIZE + len(assets) * ENTRY_SIZE
+    bundle = None
+
+    for name, file_path in assets:
+        encoded_name = name.encode("utf-8")
+
+        if len(encoded_name) >= MAX_NAME_SIZE:
+            print(f"Asset name {name} is too long, max. {MAX_NAME_SIZE - 1} bytes.")
+            break
+
+        asset = load_asset(file_path, pixel_format, use_rle)
+
+        entries += struct.pack(f"<{MAX_NAME_SIZE}sII", encoded_name, offset + len(data), len(asset))
+        data += asset
+
+        # Align the next asset.
+        data += bytes((DATA_ALIGNMENT - len(data) % DATA_ALIGNMENT) % DATA_ALIGNMENT)
+
+    else:
+        size = offset + len(data)
+        bundle = struct.pack("<3sBHHII", SIGNATURE, VERSION, len(assets), 0, size, 0) + entries + data
+
+    return bundle
+
+def get_partition(partition_table, label):
+    """Get offset and size of a partition from a partition table.
+
+    Args:
+        partition_table (str): Partition table file (.csv)
+        label (str): Partition label
+
+    Returns:
+        tuple: Offset and size in bytes or None, if not found.
+    """
+    partition = None
+
+    with open(partition_table, "r", encoding="utf-8") as file:
+        for line in file:
+            columns = [column.strip() for column in line.split(",")]
+
+            if (len(columns) >= 5) and (columns[0] == label):
+                partition = (int(columns[3], 0), int(columns[4], 0))
+                break
+
+    return partition
+
+def main():
+    """The program main entry point.
+
+    Returns:
+        int: Program exit status
+    """
+    parser = argparse.ArgumentParser(description="Builds the asset bundle for the asset flash partition.")
+
+    parser.add_argument(
+        "asset_dir",
+        metavar="ASSET_DIR",
+        type=str,
+        nargs="?",
+        default="./assets",
+        help="Asset directory, which is not part of the filesystem. Default: ./assets"
+    )
+    parser.add_argument(
+        "--output",
+        metavar="FILE",
+        type=str,
+        default="assets.bin",
+        help="Output file name. Default: assets.bin"
+    )
+    parser.add_argument(
+        "--depth",
+        type=int,
+        choices=imgconvert_pxi.SUPPORTED_DEPTHS,
+        default=32,
+        help="Color depth of the target (CONFIG_COLOR_DEPTH). Default: 32"
+    )
+    parser.add_argument(
+        "--no-rle",
+        action="store_true",
+        help="Store the pixel data uncompressed."
+    )
+    parser.add_argument(
+        "--partition-table",
+        metavar="CSV",
+        type=str,
+        default=None,
+        help="Partition table, e.g. ./partitionTables/8MB.csv"
+    )
+    parser.add_argument(
+        "--fs-dir",
+        metavar="DIR",
+        type=str,
+        default="./data",
+        help="Data directory of the filesystem image, to report shadowed assets. Default: ./data"
+    )
+
+    args = parser.parse_args()
+    exit_code = 1
+
+    if not os.path.isdir(args.asset_dir):
+        print(f"Asset directory {args.asset_dir} not found.")
+    else:
+        pixel_format = imgconvert_pxi.PIXEL_FORMAT_RGB888
+
+        if args.depth == 16:
+            pixel_format = imgconvert_pxi.PIXEL_FORMAT_RGB565
+
+        assets = find_assets(args.asset_dir)
+
+        if os.path.isdir(args.fs_dir):
+            for name in find_shadowed_assets(assets, args.fs_dir):
+                print(f"Warning: Asset {name} is in {args.fs_dir} too and will never be drawn from flash.")
+
+        bundle = build(assets, pixel_format, not args.no_rle)
+        partition = None
+
+        if args.partition_table is not None:
+            partition = get_partition(args.partition_table, PARTITION_LABEL)
+
+        if bundle is None:
+            pass
+        elif (args.partition_table is not None) and (partition is None):
+            print(f"No {PARTITION_LABEL} partition in {args.partition_table}.")
+        elif (partition is not None) and (len(bundle) > partition[1]):
+            print(f"Asset bundle with {len(bundle)} bytes doesn't fit into the {PARTITION_LABEL} partition with {partition[1]} bytes.")
+        else:
+            with open(args.output, "wb") as file:
+                file.write(bundle)
+
+            print(f"{args.output}: {len(assets)} asset(s), {len(bundle)} bytes")
+
+            if partition is not None:
+                print(f"Flash it with: esptool.py write_flash 0x{partition[0]:X} {args.output}")
+
+            exit_code = 0
+
+    return exit_code
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,373 @@
+"""Converts a TrueType font to an anti-aliased font (GFXfontAA) C header.
+
+Usage: python fontconvert_aa.py <font file> <size in px> [--bpp 2|4|8] [--first 0x20] [--last 0x7E] [--ranges RANGES] [--name NAME]
+
+The glyph metrics are the same as in the Adafruit GFXfont format. Every pixel
+is stored with its coverage, the most significant bits first. Every glyph row
+starts at a byte boundary and the glyph bitmaps are cropped to the covered
+pixels. The generated header includes gfxfontaa.h and keeps all data in flash.
+
+With --ranges, e.g. "0x20-0x7E,0xA1-0xFF,0x391-0x3C9", the glyphs of sparse
+Unicode ranges are generated together with a GFXunicodeMap, see gfxunicode.h.
+Such a font can hold up to 256 glyphs.
+
+Requires Pillow (pip install pillow).
+"""
+
+# MIT License
+#
+# Copyright (c) 2019 - 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+################################################################################
+# Imports
+################################################################################
+import argparse
+import os
+import re
+import sys
+
+################################################################################
+# Variables
+################################################################################
+
+# Supported number of coverage bits per pixel.
+SUPPORTED_BPP = [2, 4, 8]
+
+# Max. size of all glyph bitmaps, limited by the 16 bit bitmap offset of a glyph.
+MAX_BITMAP_SIZE = 65536
+
+# Max. number of glyphs, limited by the 8 bit character codes of the GFXfont.
+MAX_GLYPHS = 256
+
+# Max. Unicode code point.
+MAX_CODE_POINT = 0x10FFFF
+
+################################################################################
+# Classes
+################################################################################
+
+################################################################################
+# Functions
+################################################################################
+
+def quantize(value, bits_per_pixel):
+    """Quantize a 8 bit coverage to the given number of bits.
+
+    Args:
+        value (int): Coverage [0; 255]
+        bits_per_pixel (int): Number of bits per pixel.
+
+    Returns:
+        int: Quantized coverage [0; 2^bits_per_pixel - 1]
+    """
+    max_coverage = (1 << bits_per_pixel) - 1
+
+    return (value * max_coverage + 127) // 255
+
+def crop(rows):
+    """Crop a glyph to its covered pixels.
+
+    Args:
+        rows (list): Glyph rows, every row is a list of coverage values.
+
+    Returns:
+        tuple: Cropped rows, left offset and top offset.
+    """
+    top = 0
+    left = 0
+
+    while (len(rows) > 0) and (max(rows[0], default=0) == 0):
+        rows = rows[1:]
+        top += 1
+
+    while (len(rows) > 0) and (max(rows[-1], default=0) == 0):
+        rows = rows[:-1]
+
+    if len(rows) > 0:
+        width = len(rows[0])
+        left = next(x for x in range(width) if any(row[x] != 0 for row in rows))
+        right = next(x for x in reversed(range(width)) if any(row[x] != 0 for row in rows))
+        rows = [row[left:right + 1] for row in rows]
+
+    return rows, left, top
+
+def pack_rows(rows, bits_per_pixel):
+    """Pack the glyph rows, the most significant bits first. Every row starts
+    at a byte boundary.
+
+    Args:
+        rows (list): Glyph rows, every row is a list of quantized coverage values.
+        bits_per_pixel (int): Number of bits per pixel.
+
+    Returns:
+        list: Packed bytes
+    """
+    packed = []
+
+    for row in rows:
+        value = 0
+        bit_cnt = 0
+
+        for coverage in row:
+            value = (value << bits_per_pixel) | coverage
+            bit_cnt += bits_per_pixel
+
+            if bit_cnt == 8:
+                packed.append(value)
+                value = 0
+                bit_cnt = 0
+
+        if bit_cnt > 0:
+            packed.append(value << (8 - bit_cnt))
+
+    return packed
+
+def render_glyph(font, char, bits_per_pixel, ascent):
+    """Render a single glyph.
+
+    Args:
+        font (ImageFont.FreeTypeFont): Font
+        char (str): Character
+        bits_per_pixel (int): Number of bits per pixel.
+        ascent (int): Font ascent in pixels.
+
+    Returns:
+        dict: Packed bitmap and glyph metrics.
+    """
+    mask, offset = font.getmask2(char, mode="L")
+    width, height = mask.size
+    rows = [[quantize(mask.getpixel((x, y)), bits_per_pixel) for x in range(width)] for y in range(height)]
+    rows, left, top = crop(rows)
+
+    return {
+        "bitmap": pack_rows(rows, bits_per_pixel),
+        "width": len(rows[0]) if len(rows) > 0 else 0,
+        "height": len(rows),
+        "x_advance": int(round(font.getlength(char))),
+        "x_offset": offset[0] + left,
+        "y_offset": offset[1] + top - ascent
+    }
+
+def to_c_identifier(name):
+    """Convert a name to a valid C identifier.
+
+    Args:
+        name (str): Name
+
+    Returns:
+        str: C identifier
+    """
+    identifier = re.sub(r"[^0-9a-zA-Z_]", "_", name)
+
+    if identifier[0].isdigit():
+        identifier = "_" + identifier
+
+    return identifier
+
+def parse_ranges(ranges_str):
+    """Parse Unicode code point ranges, e.g. "0x20-0x7E,0xB0".
+
+    Args:
+        ranges_str (str): Comma separated ranges, a range is a single code point
+            or the first and last code point separated by a dash.
+
+    Returns:
+        list: Ranges as (first, last) tuples, sorted ascending or None, if invalid.
+    """
+    ranges = []
+
+    for range_str in ranges_str.split(","):
+        bounds = range_str.strip().split("-")
+
+        try:
+            first = int(bounds[0], 0)
+            last = int(bounds[-1], 0)
+        except ValueError:
+            return None
+
+        if (len(bounds) > 2) or (first > last) or (last > MAX_CODE_POINT):
+            return None
+
+        ranges.append((first, last))
+
+    ranges.sort()
+
+    for idx in range(1, len(ranges)):
+        if ranges[idx - 1][1] >= ranges[idx][0]:
+            return None
+
+    return ranges
+
+def convert(font_file, size, bits_per_pixel, ranges, name, unicode_map):
+    """Convert a TrueType font to a GFXfontAA C header.
+
+    Args:
+        font_file (str): Font file
+        size (int): Font size in pixels.
+        bits_per_pixel (int): Number of bits per pixel.
+        ranges (list): Code point ranges as (first, last) tuples, sorted ascending.
+        name (str): Font name in the header.
+        unicode_map (bool): Generate a unicode map or use the code points as character codes.
+
+    Returns:
+        str: C header or None, if the font doesn't fit into the format.
+    """
+    from PIL import ImageFont # pylint: disable=import-outside-toplevel
+
+    font = ImageFont.truetype(font_file, size)
+    ascent, descent = font.getmetrics()
+    bitmap = []
+    glyphs = []
+
+    for first, last in ranges:
+        for code in range(first, last + 1):
+            glyph = render_glyph(font, chr(code), bits_per_pixel, ascent)
+            glyph["offset"] = len(bitmap)
+            glyph["code"] = code
+            bitmap.extend(glyph["bitmap"])
+            glyphs.append(glyph)
+
+    if len(glyphs) > MAX_GLYPHS:
+        print(f"The ranges contain {len(glyphs)} glyphs, but only {MAX_GLYPHS} are supported.")
+        return None
+
+    if len(bitmap) > MAX_BITMAP_SIZE:
+        print(f"Glyph bitmaps need {len(bitmap)} bytes, but only {MAX_BITMAP_SIZE} are supported.")
+        return None
+
+    if unicode_map is True:
+        first_code = 0
+        last_code = len(glyphs) - 1
+    else:
+        first_code = ranges[0][0]
+        last_code = ranges[0][1]
+
+    lines = []
+    lines.append(f"/* Generated by fontconvert_aa.py from {os.path.basename(font_file)}, {size} px, {bits_per_pixel} bpp. */")
+    lines.append("")
+    lines.append(f"#ifndef {name.upper()}_H")
+    lines.append(f"#define {name.upper()}_H")
+    lines.append("")
+    lines.append("#include <gfxfontaa.h>")
+
+    if unicode_map is True:
+        lines.append("#include <gfxunicode.h>")
+
+    lines.append("")
+    lines.append(f"const uint8_t {name}Bitmaps[] PROGMEM = {{")
+
+    for idx in range(0, len(bitmap), 12):
+        chunk = ", ".join(f"0x{value:02X}" for value in bitmap[idx:idx + 12])
+        lines.append(f"    {chunk},")
+
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const GFXglyph {name}Glyphs[] PROGMEM = {{")
+
+    for glyph in glyphs:
+        char = chr(glyph["code"]) if chr(glyph["code"]).isprintable() and chr(glyph["code"]) not in "\\*/" else " "
+        lines.append(f"    {{ {glyph['offset']}, {glyph['width']}, {glyph['height']}, {glyph['x_advance']}, "
+                     f"{glyph['x_offset']}, {glyph['y_offset']} }}, /* 0x{glyph['code']:02X} '{char}' */")
+
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const GFXfontAA {name} PROGMEM = {{")
+    lines.append("    {")
+    lines.append(f"        (uint8_t*){name}Bitmaps,")
+    lines.append(f"        (GFXglyph*){name}Glyphs,")
+    lines.append(f"        0x{first_code:02X},")
+    lines.append(f"        0x{last_code:02X},")
+    lines.append(f"        {ascent + descent}")
+    lines.append("    },")
+    lines.append(f"    {bits_per_pixel}")
+    lines.append("};")
+    lines.append("")
+
+    if unicode_map is True:
+        glyph_index = 0
+
+        lines.append(f"const GFXunicodeRange {name}UnicodeRanges[] PROGMEM = {{")
+
+        for first, last in ranges:
+            lines.append(f"    {{ 0x{first:04X}U, 0x{last:04X}U, {glyph_index}U }},")
+            glyph_index += last - first + 1
+
+        lines.append("};")
+        lines.append("")
+        lines.append(f"const GFXunicodeMap {name}UnicodeMap PROGMEM = {{")
+        lines.append(f"    {name}UnicodeRanges,")
+        lines.append(f"    {len(ranges)}")
+        lines.append("};")
+        lines.append("")
+
+    lines.append(f"#endif /* {name.upper()}_H */")
+    lines.append("")
+
+    return "\n".join(lines)
+
+def main():
+    """Main entry point.
+
+    Returns:
+        int: Exit code
+    """
+    parser = argparse.ArgumentParser(description="Converts a TrueType font to an anti-aliased GFXfontAA C header.")
+    parser.add_argument("font_file", help="TrueType font file")
+    parser.add_argument("size", type=int, help="Font size in pixels")
+    parser.add_argument("--bpp", type=int, choices=SUPPORTED_BPP, default=4, help="Coverage bits per pixel")
+    parser.add_argument("--first", type=lambda value: int(value, 0), default=0x20, help="First character code")
+    parser.add_argument("--last", type=lambda value: int(value, 0), default=0x7E, help="Last character code")
+    parser.add_argument("--ranges", default=None, help="Unicode code point ranges, e.g. 0x20-0x7E,0xA1-0xFF")
+    parser.add_argument("--name", default=None, help="Font name in the generated header")
+    args = parser.parse_args()
+    exit_code = 1
+
+    unicode_map = args.ranges is not None
+
+    if unicode_map is True:
+        ranges = parse_ranges(args.ranges)
+    elif (args.first > args.last) or (args.last > 0xFF):
+        ranges = None
+    else:
+        ranges = [(args.first, args.last)]
+
+    if ranges is None:
+        print("Invalid character range, the character codes must be in [0x00; 0xFF] and the ranges must not overlap.")
+    else:
+        name = args.name
+
+        if name is None:
+            name = os.path.splitext(os.path.basename(args.font_file))[0] + f"{args.size}px{args.bpp}bpp"
+
+        header = convert(args.font_file, args.size, args.bpp, ranges, to_c_identifier(name), unicode_map)
+
+        if header is not None:
+            sys.stdout.write(header)
+            exit_code = 0
+
+    return exit_code
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())
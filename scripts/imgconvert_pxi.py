@@ -0,0 +1,290 @@
+"""Converts an image (BMP, GIF, PNG, ...) to the Pixelix image format (.pxi).
+
+Usage: python imgconvert_pxi.py <image file> [--output FILE] [--depth 16|32] [--no-rle]
+
+The pixels are stored in the color format of the target, which is selected
+with --depth and must match CONFIG_COLOR_DEPTH of the firmware. With 16 bit
+the pixels are stored as RGB565, otherwise as RGB888. Animated images, e.g.
+animated GIFs, are stored with all frames and their delays. Transparent
+pixels become black. The pixel data is RLE compressed, if it becomes smaller.
+
+See lib/YAWidgets/src/PxiFormat.h for the file format.
+
+Requires Pillow (pip install pillow).
+"""
+
+# MIT License
+#
+# Copyright (c) 2019 - 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+################################################################################
+# Imports
+################################################################################
+import argparse
+import os
+import struct
+import sys
+
+################################################################################
+# Variables
+################################################################################
+
+# File signature.
+SIGNATURE = b"PXI"
+
+# Format version.
+VERSION = 1
+
+# Flag: Pixel data is RLE compressed.
+FLAG_RLE = 0x01
+
+# Packet header flag: The packet is a run of a single pixel.
+RLE_RUN_FLAG = 0x80
+
+# Max. number of pixels in a RLE packet.
+RLE_MAX_PIXELS = 128
+
+# Pixel format: 3 bytes per pixel (red, green, blue).
+PIXEL_FORMAT_RGB888 = 0
+
+# Pixel format: 2 bytes per pixel (RGB565, little endian).
+PIXEL_FORMAT_RGB565 = 1
+
+# Supported color depths of the target.
+SUPPORTED_DEPTHS = [16, 32]
+
+# Delay in ms, used if an animation frame has no delay.
+DEFAULT_DELAY = 100
+
+# Max. image width and height.
+MAX_SIZE = 65535
+
+################################################################################
+# Classes
+################################################################################
+
+################################################################################
+# Functions
+################################################################################
+
+def to_pixel_data(image, pixel_format):
+    """Convert a RGBA image to pixel data, row by row from top to bottom.
+
+    Args:
+        image (Image): RGBA image
+        pixel_format (int): Pixel format
+
+    Returns:
+        list: Pixels, every pixel as bytes.
+    """
+    pixels = []
+
+    for red, green, blue, alpha in image.getdata():
+        # Transparent pixels become black.
+        if alpha == 0:
+            red, green, blue = 0, 0, 0
+
+        if pixel_format == PIXEL_FORMAT_RGB565:
+            value = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3)
+            pixels.append(struct.pack("<H", value))
+        else:
+            pixels.append(bytes([red, green, blue]))
+
+    return pixels
+
+def compress(pixels):
+    """RLE compress pixels.
+
+    A run of at least two equal pixels is stored as run packet, all other
+    pixels are collected in literal packets.
+
+    Args:
+        pixels (list): Pixels, every pixel as bytes.
+
+    Returns:
+        bytes: Compressed pixel data
+    """
+    data = bytearray()
+    pixel_idx = 0
+    pixel_count = len(pixels)
+
+    while pixel_idx < pixel_count:
+        count = 1
+
+        # Count equal pixels.
+        while (pixel_idx + count < pixel_count) and \
+              (count < RLE_MAX_PIXELS) and \
+              (pixels[pixel_idx] == pixels[pixel_idx + count]):
+            count += 1
+
+        if count > 1:
+            data.append(RLE_RUN_FLAG | (count - 1))
+            data += pixels[pixel_idx]
+        else:
+            # Collect pixels until the next run starts.
+            while (pixel_idx + count < pixel_count) and \
+                  (count < RLE_MAX_PIXELS) and \
+                  ((pixel_idx + count + 1 >= pixel_count) or \
+                   (pixels[pixel_idx + count] != pixels[pixel_idx + count + 1])):
+                count += 1
+
+            data.append(count - 1)
+            data += b"".join(pixels[pixel_idx:pixel_idx + count])
+
+        pixel_idx += count
+
+    return bytes(data)
+
+def load_frames(image_file):
+    """Load all frames of an image.
+
+    Args:
+        image_file (str): Image file name
+
+    Returns:
+        tuple: Width, height and list of frames (RGBA image, delay in ms).
+    """
+    from PIL import Image, ImageSequence # pylint: disable=import-outside-toplevel
+
+    frames = []
+
+    with Image.open(image_file) as image:
+        width, height = image.size
+        is_animated = getattr(image, "is_animated", False)
+
+        for frame in ImageSequence.Iterator(image):
+            delay = 0
+
+            if is_animated is True:
+                delay = frame.info.get("duration", 0)
+
+                if delay == 0:
+                    delay = DEFAULT_DELAY
+
+            frames.append((frame.convert("RGBA"), delay))
+
+    return width, height, frames
+
+def convert(width, height, frames, pixel_format, use_rle):
+    """Convert frames to the Pixelix image format.
+
+    Args:
+        width (int): Image width in pixels
+        height (int): Image height in pixels
+        frames (list): Frames (RGBA image, delay in ms)
+        pixel_format (int): Pixel format
+        use_rle (bool): Use RLE compression, if the pixel data becomes smaller.
+
+    Returns:
+        bytes: Pixelix image
+    """
+    raw_frames = [b"".join(to_pixel_data(image, pixel_format)) for image, _ in frames]
+    frame_data = raw_frames
+    flags = 0
+
+    if use_rle is True:
+        rle_frames = [compress(to_pixel_data(image, pixel_format)) for image, _ in frames]
+
+        # All frames share the flag, therefore the total size decides.
+        if sum(len(data) for data in rle_frames) < sum(len(data) for data in raw_frames):
+            frame_data = rle_frames
+            flags |= FLAG_RLE
+
+    pxi = bytearray()
+    pxi += struct.pack("<3sBHHBBHI", SIGNATURE, VERSION, width, height, pixel_format, flags, len(frames), 0)
+
+    for (_, delay), data in zip(frames, frame_data):
+        pxi += struct.pack("<II", delay, len(data))
+        pxi += data
+
+    return bytes(pxi)
+
+def main():
+    """The program main entry point.
+
+    Returns:
+        int: Program exit status
+    """
+    parser = argparse.ArgumentParser(description="Converts an image to the Pixelix image format (.pxi).")
+
+    parser.add_argument(
+        "image_file",
+        metavar="IMAGE_FILE",
+        type=str,
+        help="Image file (BMP, GIF, PNG, ...)"
+    )
+    parser.add_argument(
+        "--output",
+        metavar="FILE",
+        type=str,
+        default=None,
+        help="Output file name. Default: Image file name with .pxi extension"
+    )
+    parser.add_argument(
+        "--depth",
+        type=int,
+        choices=SUPPORTED_DEPTHS,
+        default=32,
+        help="Color depth of the target (CONFIG_COLOR_DEPTH). Default: 32"
+    )
+    parser.add_argument(
+        "--no-rle",
+        action="store_true",
+        help="Store the pixel data uncompressed."
+    )
+
+    args = parser.parse_args()
+    exit_code = 1
+
+    if not os.path.isfile(args.image_file):
+        print(f"Image file {args.image_file} not found.")
+    else:
+        width, height, frames = load_frames(args.image_file)
+
+        if (width > MAX_SIZE) or (height > MAX_SIZE) or (len(frames) > 0xFFFF):
+            print("Image is too big.")
+        else:
+            pixel_format = PIXEL_FORMAT_RGB888
+
+            if args.depth == 16:
+                pixel_format = PIXEL_FORMAT_RGB565
+
+            output = args.output
+
+            if output is None:
+                output = os.path.splitext(args.image_file)[0] + ".pxi"
+
+            pxi = convert(width, height, frames, pixel_format, not args.no_rle)
+
+            with open(output, "wb") as file:
+                file.write(pxi)
+
+            print(f"{output}: {width}x{height}, {len(frames)} frame(s), {len(pxi)} bytes")
+            exit_code = 0
+
+    return exit_code
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())
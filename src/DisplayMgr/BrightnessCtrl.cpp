@@ -302,6 +302,8 @@ BrightnessCtrl::BrightnessCtrl() :
     m_illuminanceChannel(nullptr),
     m_autoBrightnessTimer(),
     m_brightness(0U),
+    m_appliedBrightness(0U),
+    m_isBrightnessApplied(false),
     m_minBrightnessHardLimit(0U),
     m_maxBrightnessHardLimit(0U),
     m_minBrightnessSoftLimit(0U),
@@ -234,12 +234,28 @@ public:
     /**
      * Apply brightness to display. This method should be called
      * in the display update context to avoid race conditions.
+     * The display is only touched if the brightness changed since
+     * the last call.
      *
      * @param[in] display   The display, which to control.
+     *
+     * @return If the brightness was applied, it will return true otherwise false.
      */
-    void applyBrightness(IDisplay& display)
+    bool applyBrightness(IDisplay& display)
     {
-        display.setBrightness(m_brightness);
+        bool isApplied = false;
+
+        if ((false == m_isBrightnessApplied) ||
+            (m_appliedBrightness != m_brightness))
+        {
+            display.setBrightness(m_brightness);
+
+            m_appliedBrightness   = m_brightness;
+            m_isBrightnessApplied = true;
+            isApplied             = true;
+        }
+
+        return isApplied;
     }
 
     /**
@@ -312,6 +328,12 @@ private:
     /** Display brightness in digits [0; 255]. */
     uint8_t m_brightness;
 
+    /** Display brightness in digits [0; 255], which was applied to the display. */
+    uint8_t m_appliedBrightness;
+
+    /** Is the brightness applied to the display at least once? */
+    bool m_isBrightnessApplied;
+
     /** Min. brightness hard limit level in digits [0; 255]. */
     uint8_t m_minBrightnessHardLimit;
 
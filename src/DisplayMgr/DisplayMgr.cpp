@@ -147,6 +147,11 @@ bool DisplayMgr::begin()
         LOG_FATAL("Couldn't create double framebuffer.");
         isError = true;
     }
+    else if (false == m_tripleFrameBuffer.create(Display::getInstance().getWidth(), Display::getInstance().getHeight()))
+    {
+        LOG_FATAL("Couldn't create triple framebuffer.");
+        isError = true;
+    }
     else if (false == m_mutexInterf.create())
     {
         isError = true;
@@ -155,6 +160,16 @@ bool DisplayMgr::begin()
     {
         isError = true;
     }
+    else if (false == m_mutexDisplay.create())
+    {
+        isError = true;
+    }
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+    else if (false == m_frameQueue.create(FRAME_QUEUE_LENGTH))
+    {
+        isError = true;
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
     else
     {
         ;
@@ -174,12 +189,37 @@ bool DisplayMgr::begin()
         }
     }
 
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+    /* Present task not started yet? */
+    if ((false == isError) &&
+        (false == m_presentTask.isRunning()))
+    {
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+        m_presentStatisticsLogTimer.start(STATISTICS_LOG_PERIOD);
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+
+        if (false == m_presentTask.start(this))
+        {
+            isError = true;
+        }
+        else
+        {
+            LOG_DEBUG("Present task is up.");
+        }
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
     /* Update task not started yet? */
     if ((false == isError) &&
         (false == m_updateTask.isRunning()))
     {
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-        m_statisticsLogTimer.start(STATISTICS_LOG_PERIOD);
+        m_renderStatisticsLogTimer.start(STATISTICS_LOG_PERIOD);
+
+#if (0 == CONFIG_DISPLAY_MGR_PRESENT_TASK)
+        /* Without present task, the update task presents the frames too. */
+        m_presentStatisticsLogTimer.start(STATISTICS_LOG_PERIOD);
+#endif /* (0 == CONFIG_DISPLAY_MGR_PRESENT_TASK) */
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
         if (false == m_updateTask.start(this))
@@ -229,13 +269,30 @@ void DisplayMgr::end()
         LOG_DEBUG("Update task is down.");
     }
 
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+    /* Stop the present task. */
+    if (false == m_presentTask.stop())
+    {
+        LOG_ERROR("Failed to stop present task.");
+    }
+    else
+    {
+        LOG_DEBUG("Present task is down.");
+    }
+
+    m_frameQueue.destroy();
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-    m_statisticsLogTimer.stop();
+    m_renderStatisticsLogTimer.stop();
+    m_presentStatisticsLogTimer.stop();
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
+    m_mutexDisplay.destroy();
     m_mutexUpdate.destroy();
     m_mutexInterf.destroy();
 
+    m_tripleFrameBuffer.release();
     m_doubleFrameBuffer.release();
     m_slotList.destroy();
 
@@ -747,7 +804,8 @@ void DisplayMgr::getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId)
         int16_t                    x;
         int16_t                    y;
         size_t                     index = 0;
-        MutexGuard<MutexRecursive> guard(m_mutexInterf);
+        MutexGuard<MutexRecursive> guard1(m_mutexInterf);
+        MutexGuard<MutexRecursive> guard2(m_mutexDisplay);
 
         /* Copy framebuffer after it is completely updated. */
         for (y = 0; y < display.getHeight(); ++y)
@@ -789,7 +847,7 @@ void DisplayMgr::setNetworkStatus(bool isConnected)
 void DisplayMgr::displayOff()
 {
     MutexGuard<MutexRecursive> guard1(m_mutexInterf);
-    MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
+    MutexGuard<MutexRecursive> guard2(m_mutexDisplay);
 
     Display::getInstance().off();
 }
@@ -797,16 +855,19 @@ void DisplayMgr::displayOff()
 void DisplayMgr::displayOn()
 {
     MutexGuard<MutexRecursive> guard1(m_mutexInterf);
-    MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
+    MutexGuard<MutexRecursive> guard2(m_mutexDisplay);
 
     Display::getInstance().on();
+
+    /* The display was cleared, therefore the next frame must not be skipped. */
+    m_isRefreshRequested = true;
 }
 
 bool DisplayMgr::isDisplayOn() const
 {
     bool                       isDisplayOn = false;
     MutexGuard<MutexRecursive> guard1(m_mutexInterf);
-    MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
+    MutexGuard<MutexRecursive> guard2(m_mutexDisplay);
 
     isDisplayOn = Display::getInstance().isOn();
 
@@ -840,22 +901,32 @@ void DisplayMgr::setIndicatorState(uint8_t indicatorId, IIndicatorView::State st
 DisplayMgr::DisplayMgr() :
     m_mutexInterf(),
     m_mutexUpdate(),
+    m_mutexDisplay(),
     m_processTask("processTask", processTask, PROCESS_TASK_STACK_SIZE, PROCESS_TASK_PRIORITY, PROCESS_TASK_RUN_CORE),
     m_updateTask("updateTask", updateTask, UPDATE_TASK_STACK_SIZE, UPDATE_TASK_PRIORITY, UPDATE_TASK_RUN_CORE),
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+    m_presentTask("presentTask", presentTask, PRESENT_TASK_STACK_SIZE, PRESENT_TASK_PRIORITY, PRESENT_TASK_RUN_CORE),
+    m_frameQueue(),
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
     m_slotList(),
     m_selectedSlotId(SlotList::SLOT_ID_INVALID),
     m_selectedPlugin(nullptr),
     m_requestedPlugin(nullptr),
     m_slotTimer(),
     m_doubleFrameBuffer(),
+    m_tripleFrameBuffer(),
+    m_isRefreshRequested(false),
     m_fadeEffectController(m_doubleFrameBuffer),
     m_isNetworkConnected(false),
-    m_indicatorView()
+    m_indicatorView(),
+    m_updatePeriod(UPDATE_TASK_PERIOD)
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
     ,
-    m_statistics(),
-    m_statisticsLogTimer(),
+    m_renderStatistics(),
+    m_renderStatisticsLogTimer(),
+    m_presentStatistics(),
+    m_presentStatisticsLogTimer(),
     m_timestampLastUpdate(0U)
 
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
@@ -1165,11 +1236,11 @@ void DisplayMgr::process()
     }
 }
 
-void DisplayMgr::update()
+bool DisplayMgr::render()
 {
-    IDisplay&                  display = Display::getInstance();
     MutexGuard<MutexRecursive> guard(m_mutexUpdate);
     YAGfxDynamicBitmap&        selectedFrameBuffer = m_doubleFrameBuffer.getSelectedFramebuffer();
+    bool                       isPublished         = false;
 
     /* Update frame buffer with plugin content. */
     if (nullptr != m_selectedPlugin)
@@ -1180,14 +1251,83 @@ void DisplayMgr::update()
     /* Update frame buffer with indicators (foreground). */
     m_indicatorView.update(selectedFrameBuffer);
 
-    /* Update the display buffer. */
-    m_fadeEffectController.update(display);
+    /* Only if the framebuffer content changed or a fade effect is running,
+     * the back buffer needs to be updated.
+     */
+    if ((false == selectedFrameBuffer.getDirtyArea().isEmpty()) ||
+        (true == m_fadeEffectController.isRunning()))
+    {
+        m_fadeEffectController.update(m_tripleFrameBuffer.getBackBuffer());
+    }
+
+    /* Hand the frame over to the presentation, but only if it changed. */
+    isPublished = m_tripleFrameBuffer.publish();
+
+    /* Schedule the next update according to the frame interval of the
+     * selected plugin. A running fade effect requires the default rate.
+     */
+    if (true == m_fadeEffectController.isRunning())
+    {
+        m_updatePeriod = UPDATE_TASK_PERIOD;
+    }
+    else if (nullptr != m_selectedPlugin)
+    {
+        uint32_t frameInterval = m_selectedPlugin->getFrameInterval();
+
+        if (UPDATE_TASK_PERIOD_MIN > frameInterval)
+        {
+            m_updatePeriod = UPDATE_TASK_PERIOD_MIN;
+        }
+        else if (UPDATE_TASK_PERIOD_MAX < frameInterval)
+        {
+            m_updatePeriod = UPDATE_TASK_PERIOD_MAX;
+        }
+        else
+        {
+            m_updatePeriod = frameInterval;
+        }
+    }
+    else
+    {
+        m_updatePeriod = UPDATE_TASK_PERIOD_MAX;
+    }
+
+    return isPublished;
+}
+
+bool DisplayMgr::present()
+{
+    IDisplay&                  display     = Display::getInstance();
+    MutexGuard<MutexRecursive> guard(m_mutexDisplay);
+    const YAGfxDynamicBitmap*  frontBuffer = m_tripleFrameBuffer.acquire();
+    bool                       isUpdated   = m_isRefreshRequested;
+
+    m_isRefreshRequested = false;
+
+    /* New frame available? */
+    if (nullptr != frontBuffer)
+    {
+        /* Only the changed pixels are written, which keeps the transfer to
+         * the physical display as small as possible.
+         */
+        display.copy(*frontBuffer);
+
+        isUpdated = true;
+    }
 
     /* Apply brightness changes safely before LED output to avoid race conditions. */
-    BrightnessCtrl::getInstance().applyBrightness(display);
+    if (true == BrightnessCtrl::getInstance().applyBrightness(display))
+    {
+        isUpdated = true;
+    }
 
-    /* Latch display buffer. */
-    display.show();
+    /* Latch display buffer, but skip the frame if nothing changed. */
+    if (true == isUpdated)
+    {
+        display.show();
+    }
+
+    return isUpdated;
 }
 
 void DisplayMgr::processTask(DisplayMgr* self)
@@ -1205,91 +1345,189 @@ void DisplayMgr::processTask(DisplayMgr* self)
     delay(PROCESS_TASK_PERIOD - (duration % PROCESS_TASK_PERIOD));
 }
 
-void DisplayMgr::updateTask(DisplayMgr* self)
+void DisplayMgr::presentAndWait(uint32_t maxWaitTime, bool isFramePublished, uint32_t renderTimestamp)
 {
-    uint32_t timestamp           = millis(); /* ms */
-    uint32_t duration            = 0U;       /* ms */
-    uint32_t timestampPhyUpdate  = 0U;       /* ms */
-    uint32_t durationPhyUpdate   = 0U;       /* ms */
-    bool     abort               = false;
-
-    /* Observe the physical display refresh and limit the duration to 70% of refresh period. */
-    const uint32_t MAX_LOOP_TIME = (UPDATE_TASK_PERIOD * 7U) / (10U);
-
-    /* Refresh display content periodically */
-    self->update();
-
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-    /* Update statistics for active plugin processing time. */
-    self->m_statistics.pluginProcessing.update(millis() - timestamp);
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+    uint32_t timestamp = millis(); /* ms */
+    bool     isUpdated = present();
 
     /* Wait until the physical update is ready to avoid flickering
      * and artifacts on the display, because of e.g. webserver flash
-     * access.
+     * access. The task is blocked meanwhile, which leaves the CPU to
+     * the other tasks. A skipped frame has nothing to wait for.
      */
-    timestampPhyUpdate = millis();
-    while ((false == Display::getInstance().isReady()) && (false == abort))
+    if (true == isUpdated)
     {
-        durationPhyUpdate = millis() - timestampPhyUpdate;
-
-        if (MAX_LOOP_TIME <= durationPhyUpdate)
-        {
-            abort = true;
-        }
+        (void)Display::getInstance().waitUntilReady(maxWaitTime);
     }
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
     /* Update statistics for physical display update time. */
-    self->m_statistics.displayUpdate.update(durationPhyUpdate);
+    m_presentStatistics.displayUpdate.update(millis() - timestamp);
 
-    /* Update statistics for total processing time. */
-    self->m_statistics.total.update(self->m_statistics.pluginProcessing.getCurrent() + self->m_statistics.displayUpdate.getCurrent());
+    /* Update statistics for the time from render start until the frame is shown. */
+    if ((true == isUpdated) &&
+        (true == isFramePublished))
+    {
+        m_presentStatistics.latency.update(millis() - renderTimestamp);
+    }
+
+    /* Count the frames, which were skipped because of unchanged content. */
+    ++m_presentStatistics.frames;
+
+    if (false == isUpdated)
+    {
+        ++m_presentStatistics.skippedFrames;
+    }
+
+    logPresentStatistics();
+#else  /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+    UTIL_NOT_USED(timestamp);
+    UTIL_NOT_USED(isFramePublished);
+    UTIL_NOT_USED(renderTimestamp);
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+}
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
 
-    if (true == self->m_statisticsLogTimer.isTimeout())
+void DisplayMgr::logRenderStatistics()
+{
+    if (true == m_renderStatisticsLogTimer.isTimeout())
     {
-        LOG_DEBUG("Refresh period   : min %2u avg %2u max %2u",
-            self->m_statistics.refreshPeriod.getMin(),
-            self->m_statistics.refreshPeriod.getAvg(),
-            self->m_statistics.refreshPeriod.getMax());
+        LOG_DEBUG("Refresh period   : min %2u avg %2u max %2u jitter %2u",
+            m_renderStatistics.refreshPeriod.getMin(),
+            m_renderStatistics.refreshPeriod.getAvg(),
+            m_renderStatistics.refreshPeriod.getMax(),
+            m_renderStatistics.refreshPeriod.getMax() - m_renderStatistics.refreshPeriod.getMin());
 
         LOG_DEBUG("Plugin processing: min %2u avg %2u max %2u",
-            self->m_statistics.pluginProcessing.getMin(),
-            self->m_statistics.pluginProcessing.getAvg(),
-            self->m_statistics.pluginProcessing.getMax());
+            m_renderStatistics.pluginProcessing.getMin(),
+            m_renderStatistics.pluginProcessing.getAvg(),
+            m_renderStatistics.pluginProcessing.getMax());
+
+        LOG_DEBUG("Total            : min %2u avg %2u max %2u",
+            m_renderStatistics.total.getMin(),
+            m_renderStatistics.total.getAvg(),
+            m_renderStatistics.total.getMax());
+
+        /* Reset the statistics to get a new min./max. determination. */
+        m_renderStatistics.pluginProcessing.reset();
+        m_renderStatistics.total.reset();
+        m_renderStatistics.refreshPeriod.reset();
+
+        m_renderStatisticsLogTimer.restart();
+    }
+}
 
+void DisplayMgr::logPresentStatistics()
+{
+    if (true == m_presentStatisticsLogTimer.isTimeout())
+    {
         LOG_DEBUG("Display update   : min %2u avg %2u max %2u",
-            self->m_statistics.displayUpdate.getMin(),
-            self->m_statistics.displayUpdate.getAvg(),
-            self->m_statistics.displayUpdate.getMax());
+            m_presentStatistics.displayUpdate.getMin(),
+            m_presentStatistics.displayUpdate.getAvg(),
+            m_presentStatistics.displayUpdate.getMax());
 
-        LOG_DEBUG("Total            : min %2u avg %2u max %2u",
-            self->m_statistics.total.getMin(),
-            self->m_statistics.total.getAvg(),
-            self->m_statistics.total.getMax());
+        LOG_DEBUG("Latency          : min %2u avg %2u max %2u",
+            m_presentStatistics.latency.getMin(),
+            m_presentStatistics.latency.getAvg(),
+            m_presentStatistics.latency.getMax());
+
+        LOG_DEBUG("Skipped frames   : %u of %u",
+            m_presentStatistics.skippedFrames,
+            m_presentStatistics.frames);
 
         /* Reset the statistics to get a new min./max. determination. */
-        self->m_statistics.pluginProcessing.reset();
-        self->m_statistics.displayUpdate.reset();
-        self->m_statistics.total.reset();
-        self->m_statistics.refreshPeriod.reset();
+        m_presentStatistics.displayUpdate.reset();
+        m_presentStatistics.latency.reset();
+        m_presentStatistics.frames        = 0U;
+        m_presentStatistics.skippedFrames = 0U;
 
-        self->m_statisticsLogTimer.restart();
+        m_presentStatisticsLogTimer.restart();
     }
+}
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+
+void DisplayMgr::updateTask(DisplayMgr* self)
+{
+    uint32_t timestamp   = millis(); /* ms */
+    uint32_t duration    = 0U;       /* ms */
+    bool     isPublished = false;
+
+    /* Render display content periodically */
+    isPublished = self->render();
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+    /* Update statistics for active plugin processing time. */
+    self->m_renderStatistics.pluginProcessing.update(millis() - timestamp);
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+
+    /* Signal the new frame to the present task. If the queue is full, the
+     * present task will show the latest frame anyway, because it is
+     * exchanged via the triple framebuffer.
+     */
+    if (true == isPublished)
+    {
+        (void)self->m_frameQueue.sendToBack(timestamp, 0U);
+    }
+
+#else /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
+    /* Observe the physical display refresh and limit the duration to 70% of refresh period. */
+    self->presentAndWait((UPDATE_TASK_PERIOD * 7U) / (10U), isPublished, timestamp);
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
     /* Calculate overall duration */
     duration = millis() - timestamp;
 
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+    /* Update statistics for total processing time. */
+    self->m_renderStatistics.total.update(duration);
+
+    self->logRenderStatistics();
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+
     /* Updating the display shall take place in aquidistant intervals. */
-    delay(UPDATE_TASK_PERIOD - (duration % UPDATE_TASK_PERIOD));
+    delay(self->m_updatePeriod - (duration % self->m_updatePeriod));
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-    self->m_statistics.refreshPeriod.update(millis() - self->m_timestampLastUpdate);
+    self->m_renderStatistics.refreshPeriod.update(millis() - self->m_timestampLastUpdate);
     self->m_timestampLastUpdate = millis();
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 }
 
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+
+void DisplayMgr::presentTask(DisplayMgr* self)
+{
+    uint32_t renderTimestamp = 0U;
+    bool     isPublished     = false;
+
+    /* Wait for the next frame, but check for brightness changes and refresh
+     * requests in the default update period too.
+     */
+    if (true == self->m_frameQueue.receive(&renderTimestamp, pdMS_TO_TICKS(UPDATE_TASK_PERIOD)))
+    {
+        /* Only the latest frame is shown, therefore its render timestamp counts. */
+        while (true == self->m_frameQueue.receive(&renderTimestamp, 0U))
+        {
+            ;
+        }
+
+        isPublished = true;
+    }
+
+    /* The present task runs independent of the rendering, therefore it may
+     * wait for the physical display update up to the max. update period.
+     */
+    self->presentAndWait(UPDATE_TASK_PERIOD_MAX, isPublished, renderTimestamp);
+}
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -41,6 +41,16 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_DISPLAY_MGR_PRESENT_TASK
+
+/**
+ * Present the frames in a separate task (1) on the other core than the
+ * rendering or present them in the update task after rendering (0).
+ */
+#define CONFIG_DISPLAY_MGR_PRESENT_TASK 1
+
+#endif /* CONFIG_DISPLAY_MGR_PRESENT_TASK */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -50,12 +60,14 @@
 #include <SimpleTimer.hpp>
 #include <Mutex.hpp>
 #include <Task.hpp>
+#include <Queue.hpp>
 #include <IndicatorViewBase.hpp>
 
 #include "IPluginMaintenance.hpp"
 #include "SlotList.h"
 #include "FadeEffectController.h"
 #include "DoubleFrameBuffer.h"
+#include "TripleFrameBuffer.h"
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
 #include <StatisticValue.hpp>
@@ -458,27 +470,78 @@ private:
     /** The update task stack size in bytes */
     static const uint32_t UPDATE_TASK_STACK_SIZE   = 4096U;
 
-    /** The update task period in ms. */
+    /** The update task period in ms, used by default and during fading. */
     static const uint32_t UPDATE_TASK_PERIOD       = 20U;
 
+    /** The min. update task period in ms, used if a plugin requests the fastest update. */
+    static const uint32_t UPDATE_TASK_PERIOD_MIN   = 10U;
+
+    /**
+     * The max. update task period in ms. It limits the latency of slot changes,
+     * indicators and brightness changes.
+     */
+    static const uint32_t UPDATE_TASK_PERIOD_MAX   = 250U;
+
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+
+    /** The update task renders with the plugins on the same core as the process task. */
+    static const BaseType_t UPDATE_TASK_RUN_CORE   = APP_CPU_NUM;
+
+#else /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
     /** The update task shall run on the MCU core with less load. */
     static const BaseType_t UPDATE_TASK_RUN_CORE   = tskNO_AFFINITY;
 
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
     /** The update task priority shall be higher than the other application tasks. */
     static const UBaseType_t UPDATE_TASK_PRIORITY  = 4U;
 
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+
+    /** The present task stack size in bytes */
+    static const uint32_t PRESENT_TASK_STACK_SIZE  = 4096U;
+
+    /** The present task drives the physical display on the other core than the rendering. */
+    static const BaseType_t PRESENT_TASK_RUN_CORE  = PRO_CPU_NUM;
+
+    /** The present task priority shall be equal to the update task priority. */
+    static const UBaseType_t PRESENT_TASK_PRIORITY = 4U;
+
+    /** Max. number of frame signals in the frame queue. */
+    static const size_t FRAME_QUEUE_LENGTH         = 2U;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
     /** Mutex to protect concurrent access through the public interface. */
     mutable MutexRecursive m_mutexInterf;
 
-    /** Mutex to protect the display update against concurrent access. */
+    /** Mutex to protect the rendering of the display content against concurrent access. */
     mutable MutexRecursive m_mutexUpdate;
 
+    /** Mutex to protect the physical display against concurrent access. */
+    mutable MutexRecursive m_mutexDisplay;
+
     /** Process task */
     Task<DisplayMgr> m_processTask;
 
     /** Update task */
     Task<DisplayMgr> m_updateTask;
 
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+
+    /** Present task */
+    Task<DisplayMgr> m_presentTask;
+
+    /**
+     * Frame queue, which signals the present task a published frame by its
+     * render timestamp in ms. The frame itself is exchanged via the triple
+     * framebuffer.
+     */
+    Queue<uint32_t> m_frameQueue;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
+
     /** List of all slots with their connected plugins. */
     SlotList m_slotList;
 
@@ -495,28 +558,45 @@ private:
     SimpleTimer          m_slotTimer;
 
     DoubleFrameBuffer    m_doubleFrameBuffer;    /**< Double framebuffer. */
+    TripleFrameBuffer    m_tripleFrameBuffer;    /**< Triple framebuffer, which decouples rendering and presentation. */
+    bool                 m_isRefreshRequested;   /**< Is a refresh of the physical display requested, independent of the content? */
     FadeEffectController m_fadeEffectController; /**< Fade effect controller. */
     bool                 m_isNetworkConnected;   /**< Is a network connection established? */
     IndicatorViewBase    m_indicatorView;        /**< Indicator view shown as overlay to indicate user defined states. */
+    uint32_t             m_updatePeriod;         /**< Update task period in ms, derived from the frame interval of the selected plugin. */
 
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
 
     /**
-     * A collection of statistics, which are interesting for debugging purposes.
+     * A collection of rendering statistics, which are interesting for debugging purposes.
+     * They are only accessed by the update task.
      */
-    struct Statistics
+    struct RenderStatistics
     {
         StatisticValue<uint32_t, 0U, 10U> pluginProcessing;
-        StatisticValue<uint32_t, 0U, 10U> displayUpdate;
         StatisticValue<uint32_t, 0U, 10U> total;
         StatisticValue<uint32_t, 0U, 10U> refreshPeriod;
     };
 
+    /**
+     * A collection of presentation statistics, which are interesting for debugging purposes.
+     * They are only accessed by the task, which presents the frames.
+     */
+    struct PresentStatistics
+    {
+        StatisticValue<uint32_t, 0U, 10U> displayUpdate;
+        StatisticValue<uint32_t, 0U, 10U> latency;       /**< Time from the render start until the frame is shown in ms. */
+        uint32_t                          frames;        /**< Number of frames. */
+        uint32_t                          skippedFrames; /**< Number of skipped frames, because of unchanged content. */
+    };
+
     /** Statistics log period in ms. */
     static const uint32_t STATISTICS_LOG_PERIOD = 4000U; /* [ms] */
-    Statistics            m_statistics;                  /**< Statistics data. */
-    SimpleTimer           m_statisticsLogTimer;          /**< Statistics log timer. */
+    RenderStatistics      m_renderStatistics;            /**< Rendering statistics data. */
+    SimpleTimer           m_renderStatisticsLogTimer;    /**< Rendering statistics log timer. */
+    PresentStatistics     m_presentStatistics;           /**< Presentation statistics data. */
+    SimpleTimer           m_presentStatisticsLogTimer;   /**< Presentation statistics log timer. */
     uint32_t              m_timestampLastUpdate;         /**< Timestamp of last display update. */
 
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
@@ -562,12 +642,52 @@ private:
     void process(void);
 
     /**
-     * Process the slots. This shall be called periodically in
-     * a higher period than the DEFAULT_PERIOD.
+     * Render the content of the selected plugin and publish it as new frame.
      *
-     * It will handle which slot to show on the display.
+     * If the framebuffer content didn't change and no fading is running,
+     * no new frame is published.
+     *
+     * @return If a new frame was published, it will return true otherwise false.
+     */
+    bool render(void);
+
+    /**
+     * Present the latest published frame on the physical display.
+     * It doesn't wait for the rendering, because the frames are
+     * exchanged via the triple framebuffer.
+     *
+     * If no new frame is available and the brightness is unchanged, the
+     * frame is skipped and the physical display is not touched at all.
+     *
+     * @return If the display was updated, it will return true otherwise false.
+     */
+    bool present(void);
+
+    /**
+     * Present the latest published frame and wait until the physical
+     * display update is finished.
+     *
+     * @param[in] maxWaitTime       Max. time in ms to wait for the physical display update.
+     * @param[in] isFramePublished  Was a new frame published since the last call?
+     * @param[in] renderTimestamp   Timestamp in ms, when the rendering of the published frame started.
      */
-    void update(void);
+    void presentAndWait(uint32_t maxWaitTime, bool isFramePublished, uint32_t renderTimestamp);
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+
+    /**
+     * Log the rendering statistics periodically and reset them afterwards.
+     * Call it only in the update task.
+     */
+    void logRenderStatistics(void);
+
+    /**
+     * Log the presentation statistics periodically and reset them afterwards.
+     * Call it only in the task, which presents the frames.
+     */
+    void logPresentStatistics(void);
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
     /**
      * Display update task is responsible to refresh the display content.
@@ -582,6 +702,18 @@ private:
      * @param[in] self Display manager instance.
      */
     static void updateTask(DisplayMgr* self);
+
+#if (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK)
+
+    /**
+     * Display present task is responsible to show the rendered frames
+     * on the physical display.
+     *
+     * @param[in] self Display manager instance.
+     */
+    static void presentTask(DisplayMgr* self);
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_PRESENT_TASK) */
 };
 
 /******************************************************************************
@@ -110,10 +110,14 @@ public:
     /**
      * Select the next framebuffer.
      * This will switch between the two framebuffers.
+     *
+     * The display shows the content of the other framebuffer, therefore
+     * the whole selected framebuffer is marked as dirty.
      */
     void selectNextFramebuffer()
     {
         m_selectedIndex = (m_selectedIndex + 1) % FB_MAX;
+        m_framebuffers[m_selectedIndex].markAllDirty();
     }
 
     /**
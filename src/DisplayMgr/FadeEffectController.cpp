@@ -86,7 +86,7 @@ void FadeEffectController::update(YAGfx& gfx)
     /* No fade effect? */
     if (nullptr == m_fadeEffect)
     {
-        gfx.drawBitmap(0, 0, selectedFrameBuffer);
+        copyDirtyArea(gfx, selectedFrameBuffer);
         m_state = FADE_IDLE;
     }
     /* Process fade effect. */
@@ -99,7 +99,7 @@ void FadeEffectController::update(YAGfx& gfx)
         {
         /* No fading at all */
         case FADE_IDLE:
-            gfx.drawBitmap(0, 0, selectedFrameBuffer);
+            copyDirtyArea(gfx, selectedFrameBuffer);
             break;
 
         /* Fade new display content in */
@@ -137,6 +137,11 @@ void FadeEffectController::start()
      */
     m_doubleFrameBuffer.selectNextFramebuffer();
 
+    /* Unchanged frames are skipped without updating the controller,
+     * therefore a requested fade effect change may still be pending.
+     */
+    changeFadeEffectOnDemand();
+
     m_state = FADE_OUT;
 
     if (nullptr != m_fadeEffect)
@@ -153,6 +158,16 @@ void FadeEffectController::start()
  * Private Methods
  *****************************************************************************/
 
+void FadeEffectController::copyDirtyArea(YAGfx& gfx, YAGfxDynamicBitmap& framebuffer)
+{
+    /* The display shows the framebuffer content of the last update. Its
+     * dirty area is not cleared during fading, therefore only the changed
+     * part needs to be copied.
+     */
+    gfx.copy(framebuffer, framebuffer.getDirtyArea());
+    framebuffer.clearDirtyArea();
+}
+
 void FadeEffectController::changeFadeEffectOnDemand()
 {
     if (m_fadeEffectIndex != m_nextFadeEffectIndex)
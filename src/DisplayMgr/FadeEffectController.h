@@ -194,6 +194,15 @@ private:
      */
     FadeEffectController& operator=(const FadeEffectController& other) = delete;
 
+    /**
+     * Copy the dirty area of the framebuffer to the display and clear it
+     * afterwards.
+     *
+     * @param[in] gfx           Display graphics interface
+     * @param[in] framebuffer   Framebuffer which to copy
+     */
+    void copyDirtyArea(YAGfx& gfx, YAGfxDynamicBitmap& framebuffer);
+
     /**
      * Change fade effect on demand.
      * If the user has selected a new fade effect, it will change the current fade effect.
@@ -0,0 +1,175 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TripleFrameBuffer.cpp
+ * @brief  Triple frame buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TripleFrameBuffer.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool TripleFrameBuffer::create(uint16_t width, uint16_t height)
+{
+    bool    isSuccessful = true;
+    uint8_t idx;
+
+    for (idx = 0U; idx < FB_MAX; ++idx)
+    {
+        if (false == m_framebuffers[idx].create(width, height))
+        {
+            isSuccessful = false;
+            break;
+        }
+
+        m_staleAreas[idx].clear();
+    }
+
+    if (false == isSuccessful)
+    {
+        release();
+    }
+    else
+    {
+        m_backIndex  = 0U;
+        m_readyIndex = 1U;
+        m_frontIndex = 2U;
+    }
+
+    return isSuccessful;
+}
+
+void TripleFrameBuffer::release()
+{
+    uint8_t idx;
+
+    for (idx = 0U; idx < FB_MAX; ++idx)
+    {
+        m_framebuffers[idx].release();
+        m_staleAreas[idx].clear();
+    }
+
+    m_backIndex  = 0U;
+    m_readyIndex = 1U;
+    m_frontIndex = 2U;
+}
+
+bool TripleFrameBuffer::publish()
+{
+    bool                isPublished = false;
+    YAGfxDynamicBitmap& backBuffer  = m_framebuffers[m_backIndex];
+    BaseGfxDirtyArea    changedArea = backBuffer.getDirtyArea();
+
+    if (false == changedArea.isEmpty())
+    {
+        uint8_t publishedIndex = m_backIndex;
+        uint8_t idx;
+
+        backBuffer.clearDirtyArea();
+
+        /* The other framebuffers differ now from the published one in the changed area. */
+        for (idx = 0U; idx < FB_MAX; ++idx)
+        {
+            if (publishedIndex != idx)
+            {
+                m_staleAreas[idx].add(changedArea);
+            }
+        }
+
+        /* Hand the frame over to the present side and take the previous
+         * ready framebuffer in exchange. If it was not presented yet, it
+         * is dropped.
+         */
+        m_backIndex = m_readyIndex.exchange(publishedIndex | FRESH_FLAG) & INDEX_MASK;
+
+        /* Bring the new back buffer up to date. The published framebuffer
+         * is not written by anyone until it becomes the back buffer again.
+         */
+        m_framebuffers[m_backIndex].copy(m_framebuffers[publishedIndex], m_staleAreas[m_backIndex]);
+        m_framebuffers[m_backIndex].clearDirtyArea();
+        m_staleAreas[m_backIndex].clear();
+
+        isPublished = true;
+    }
+
+    return isPublished;
+}
+
+const YAGfxDynamicBitmap* TripleFrameBuffer::acquire()
+{
+    const YAGfxDynamicBitmap* frontBuffer = nullptr;
+
+    if (0U != (m_readyIndex.load() & FRESH_FLAG))
+    {
+        m_frontIndex = m_readyIndex.exchange(m_frontIndex) & INDEX_MASK;
+        frontBuffer  = &m_framebuffers[m_frontIndex];
+    }
+
+    return frontBuffer;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,192 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TripleFrameBuffer.h
+ * @brief  Triple frame buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup DISPLAY_MGR
+ *
+ * @{
+ */
+
+#ifndef TRIPLE_FRAME_BUFFER_H
+#define TRIPLE_FRAME_BUFFER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <atomic>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * This class provides a triple buffered framebuffer, which decouples the
+ * rendering of a frame from its presentation on the physical display.
+ *
+ * The render side (single producer) draws into the back buffer and
+ * publishes it. The present side (single consumer) acquires the latest
+ * published frame as front buffer. Both sides exchange the buffers by an
+ * atomic index swap, therefore no side has to wait for the other one.
+ * If the render side is faster, older frames are dropped.
+ *
+ * The back buffer always contains the last published frame. That means
+ * only the changes of a new frame need to be drawn.
+ *
+ * The framebuffers memory is allocated dynamically.
+ */
+class TripleFrameBuffer
+{
+public:
+
+    /**
+     * Construct the triple framebuffer.
+     */
+    TripleFrameBuffer() :
+        m_framebuffers(),
+        m_staleAreas(),
+        m_backIndex(0U),
+        m_readyIndex(1U),
+        m_frontIndex(2U)
+    {
+        /* Nothing to do */
+    }
+
+    /**
+     * Destruct the triple framebuffer.
+     */
+    ~TripleFrameBuffer()
+    {
+        /* Nothing to do */
+    }
+
+    /**
+     * Create framebuffers.
+     *
+     * @param[in] width     Width in pixels
+     * @param[in] height    Height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height);
+
+    /**
+     * Release framebuffers.
+     */
+    void release();
+
+    /**
+     * Get the back buffer, which is used by the render side.
+     * It contains the last published frame.
+     *
+     * @return Back buffer
+     */
+    YAGfxDynamicBitmap& getBackBuffer()
+    {
+        return m_framebuffers[m_backIndex];
+    }
+
+    /**
+     * Publish the back buffer, if its content changed. Afterwards the
+     * render side gets a new back buffer, which is updated to the
+     * published frame.
+     *
+     * Shall only be called by the render side.
+     *
+     * @return If a new frame was published, it will return true otherwise false.
+     */
+    bool publish();
+
+    /**
+     * Acquire the latest published frame.
+     *
+     * Shall only be called by the present side. The returned front buffer
+     * is valid until the next call.
+     *
+     * @return Front buffer or nullptr, if no new frame is available.
+     */
+    const YAGfxDynamicBitmap* acquire();
+
+private:
+
+    /**
+     * Max. number of frame buffers.
+     */
+    static const uint8_t FB_MAX     = 3U;
+
+    /**
+     * Flag in the ready index, which signals a new published frame.
+     */
+    static const uint8_t FRESH_FLAG = 0x80U;
+
+    /**
+     * Mask to get the framebuffer index of the ready index.
+     */
+    static const uint8_t INDEX_MASK = 0x7FU;
+
+    YAGfxDynamicBitmap   m_framebuffers[FB_MAX]; /**< Three framebuffers, used for triple buffering. */
+    BaseGfxDirtyArea     m_staleAreas[FB_MAX];   /**< Per framebuffer the area, which differs from the last published frame. Used by render side only. */
+    uint8_t              m_backIndex;            /**< Index of the back buffer, owned by the render side. */
+    std::atomic<uint8_t> m_readyIndex;           /**< Index of the last published framebuffer, incl. fresh flag. Shared by both sides. */
+    uint8_t              m_frontIndex;           /**< Index of the front buffer, owned by the present side. */
+
+    /**
+     * Copy consturctor is not allowed.
+     *
+     * @param[in] other  Other instance, which to copy
+     */
+    TripleFrameBuffer(const TripleFrameBuffer& other)            = delete;
+
+    /**
+     * Assignment operator is not allowed.
+     *
+     * @param[in] other  Other instance, which to assign
+     *
+     * @return Reference to this instance
+     */
+    TripleFrameBuffer& operator=(const TripleFrameBuffer& other) = delete;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TRIPLE_FRAME_BUFFER_H */
+
+/** @} */
@@ -43,6 +43,8 @@
 #include <Wire.h>
 #include <IconTextPlugin.h>
 #include <ViewConfig.h>
+#include <Fonts.h>
+#include <AssetBundle.h>
 
 #include "ButtonDrv.h"
 #include "ClockDrv.h"
@@ -176,6 +178,18 @@ void InitState::entry(StateMachine& sm)
         /* Initialize sensors */
         SensorDataProvider::getInstance().begin();
 
+        /* Initialize fonts. Without glyph cache the text is still drawn, but slower. */
+        if (false == Fonts::init())
+        {
+            LOG_WARNING("Glyph cache not available.");
+        }
+
+        /* Map the asset bundle. Without it, all images are loaded from the filesystem. */
+        if (false == AssetBundle::getInstance().begin())
+        {
+            LOG_INFO("Asset bundle not available.");
+        }
+
         /* Prepare everything for the plugins. */
         PluginMgr::getInstance().begin();
     }
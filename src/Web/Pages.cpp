@@ -52,6 +52,7 @@
 #include <SettingsService.h>
 #include <FileSystem.h>
 #include <BitmapWidget.h>
+#include <Fonts.h>
 
 #include <mbedtls/version.h>
 #include <freertos/task.h>
@@ -131,6 +132,8 @@ static const TmplKeyWordFunc gTmplKeyWordToFunc[] = {
     { "FREERTOS_VERSION", []() -> String { return tskKERNEL_VERSION_NUMBER; } },
     { "FS_SIZE", []() -> String { return String(FILESYSTEM.totalBytes()); } },
     { "FS_SIZE_USED", []() -> String { return String(FILESYSTEM.usedBytes()); } },
+    { "GLYPH_CACHE_ENTRIES", []() -> String { return String(Fonts::getGlyphCache().getUsedEntries()) + "/" + String(Fonts::getGlyphCache().getMaxEntries()); } },
+    { "GLYPH_CACHE_HIT_RATE", []() -> String { return String(Fonts::getGlyphCache().getHitRate()); } },
     { "HEAP_SIZE", []() -> String { return String(MemUtil::getTotalHeapSize()); } },
     { "HEAP_SIZE_AVAILABLE", []() -> String { return String(MemUtil::getFreeHeapSize()); } },
     { "IMAGE_FILE_EXTENSIONS", []() -> String { return tmpl::getImageFileExtensions(); } },
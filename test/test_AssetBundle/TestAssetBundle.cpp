@@ -0,0 +1,292 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TestAssetBundle.cpp
+ * @brief  Test asset bundle.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <FS.h>
+#include <AssetBundle.h>
+#include <PxiImgPlayer.h>
+#include <BitmapWidget.h>
+#include <YAGfxBitmap.h>
+#include <Util.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testAssetBundle();
+static void testAssetBundleInvalid();
+static void testAssetBundleBitmapWidget();
+static size_t loadBundle(uint8_t* data, size_t size);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Test bundle, created with scripts/assetbundle_build.py. */
+static const char BUNDLE_FILE_NAME[] = "./test/test_AssetBundle/testBundle.bin";
+
+/** Max. size of the test bundle in bytes. */
+static const size_t BUNDLE_MAX_SIZE  = 512U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testAssetBundle);
+    RUN_TEST(testAssetBundleInvalid);
+    RUN_TEST(testAssetBundleBitmapWidget);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    AssetBundle::getInstance().end();
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test finding assets in the bundle.
+ */
+static void testAssetBundle()
+{
+    AssetBundle&   bundle    = AssetBundle::getInstance();
+    uint8_t        bundleData[BUNDLE_MAX_SIZE];
+    size_t         bundleSize = loadBundle(bundleData, sizeof(bundleData));
+    const uint8_t* data       = nullptr;
+    size_t         size       = 0U;
+    PxiImgPlayer   player;
+
+    /* No asset partition in the native environment. */
+    TEST_ASSERT_FALSE(bundle.begin());
+    TEST_ASSERT_FALSE(bundle.isOpen());
+    TEST_ASSERT_FALSE(bundle.find("/configuration/animation.pxi", data, size));
+
+    /* Test bundle:
+     * /configuration/animation.pxi: 8x4 pixels, 3 frames, RLE compressed
+     * /plugins/Test/icon.pxi: 3x2 pixels, 1 frame, uncompressed
+     */
+    TEST_ASSERT_TRUE(bundle.open(bundleData, bundleSize));
+    TEST_ASSERT_TRUE(bundle.isOpen());
+    TEST_ASSERT_EQUAL_UINT16(2U, bundle.getCount());
+
+    TEST_ASSERT_FALSE(bundle.find("/configuration/animation", data, size));
+    TEST_ASSERT_FALSE(bundle.find("/plugins/Test/icon.bmp", data, size));
+
+    TEST_ASSERT_TRUE(bundle.find("/configuration/animation.pxi", data, size));
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.openMapped(data, size));
+    TEST_ASSERT_EQUAL_UINT16(3U, player.getFrameCount());
+
+    /* The asset data is inside the bundle, its not copied. */
+    TEST_ASSERT_TRUE(bundle.find("/plugins/Test/icon.pxi", data, size));
+    TEST_ASSERT_TRUE((bundleData <= data) && ((bundleData + bundleSize) >= (data + size)));
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.openMapped(data, size));
+    TEST_ASSERT_EQUAL_UINT16(3U, player.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2U, player.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(1U, player.getFrameCount());
+
+    bundle.close();
+    TEST_ASSERT_FALSE(bundle.isOpen());
+    TEST_ASSERT_FALSE(bundle.find("/plugins/Test/icon.pxi", data, size));
+}
+
+/**
+ * Test opening invalid bundles.
+ */
+static void testAssetBundleInvalid()
+{
+    AssetBundle& bundle = AssetBundle::getInstance();
+    uint8_t      bundleData[BUNDLE_MAX_SIZE];
+    size_t       bundleSize = loadBundle(bundleData, sizeof(bundleData));
+    uint32_t     value      = 0U;
+
+    /* Truncated bundle */
+    TEST_ASSERT_FALSE(bundle.open(bundleData, sizeof(AssetBundle::Header) - 1U));
+    TEST_ASSERT_FALSE(bundle.open(bundleData, bundleSize - 1U));
+
+    /* Invalid signature */
+    bundleData[0U] = 'Q';
+    TEST_ASSERT_FALSE(bundle.open(bundleData, bundleSize));
+    bundleData[0U] = 'P';
+
+    /* Unsupported version */
+    bundleData[3U] = AssetBundle::VERSION + 1U;
+    TEST_ASSERT_FALSE(bundle.open(bundleData, bundleSize));
+    bundleData[3U] = AssetBundle::VERSION;
+
+    /* Asset outside of the bundle */
+    value = bundleSize;
+    memcpy(&bundleData[sizeof(AssetBundle::Header) + AssetBundle::MAX_NAME_SIZE], &value, sizeof(value));
+    TEST_ASSERT_FALSE(bundle.open(bundleData, bundleSize));
+    TEST_ASSERT_FALSE(bundle.isOpen());
+
+    /* Not terminated asset name */
+    bundleSize = loadBundle(bundleData, sizeof(bundleData));
+    memset(&bundleData[sizeof(AssetBundle::Header)], 'a', AssetBundle::MAX_NAME_SIZE);
+    TEST_ASSERT_FALSE(bundle.open(bundleData, bundleSize));
+
+    bundleSize = loadBundle(bundleData, sizeof(bundleData));
+    TEST_ASSERT_TRUE(bundle.open(bundleData, bundleSize));
+}
+
+/**
+ * Test the bitmap widget, which prefers the filesystem over the asset bundle.
+ */
+static void testAssetBundleBitmapWidget()
+{
+    AssetBundle&       bundle = AssetBundle::getInstance();
+    uint8_t            bundleData[BUNDLE_MAX_SIZE];
+    size_t             bundleSize = loadBundle(bundleData, sizeof(bundleData));
+    FS                 localFileSystem;
+    BitmapWidget       bitmapWidget(3U, 2U);
+    YAGfxDynamicBitmap canvas;
+    Color              expected;
+
+    TEST_ASSERT_TRUE(canvas.create(3U, 2U));
+
+    /* Without bundle, the file is not found. */
+    TEST_ASSERT_FALSE(bitmapWidget.load(localFileSystem, "/plugins/Test/icon.pxi"));
+
+    TEST_ASSERT_TRUE(bundle.open(bundleData, bundleSize));
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, "/plugins/Test/icon.pxi"));
+
+    /* Drawn directly from the bundle. */
+    bitmapWidget.update(canvas);
+
+    expected.set(255U, 0U, 0U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(0, 0));
+    expected.set(0U, 255U, 0U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(1, 0));
+    expected.set(0U, 0U, 255U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(2, 0));
+    expected.set(255U, 255U, 255U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(0, 1));
+    expected.set(0U, 0U, 0U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(1, 1));
+    expected.set(16U, 32U, 48U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(2, 1));
+
+    /* Images, which are not in the bundle, are loaded from the filesystem. */
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, "./test/test_PxiImgPlayer/testAnimation.pxi"));
+
+    /* The filesystem takes precedence over the bundle. The icon asset gets
+     * the name of an existing file, whose first frame starts with red rows.
+     */
+    bundle.close();
+    strncpy(reinterpret_cast<char*>(&bundleData[sizeof(AssetBundle::Header) + sizeof(AssetBundle::Entry)]), "./test/test_PxiImgPlayer/testAnimation.pxi", AssetBundle::MAX_NAME_SIZE);
+    TEST_ASSERT_TRUE(bundle.open(bundleData, bundleSize));
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, "./test/test_PxiImgPlayer/testAnimation.pxi"));
+
+    bitmapWidget.update(canvas);
+
+    expected.set(255U, 0U, 0U);
+    TEST_ASSERT_TRUE(expected == canvas.getColor(1, 0));
+}
+
+/**
+ * Load the test bundle.
+ *
+ * @param[out] data  Buffer for the bundle
+ * @param[in]  size  Buffer size in bytes
+ *
+ * @return Size of the bundle in bytes
+ */
+static size_t loadBundle(uint8_t* data, size_t size)
+{
+    FS     localFileSystem;
+    File   fd         = localFileSystem.open(BUNDLE_FILE_NAME);
+    size_t bundleSize = 0U;
+
+    TEST_ASSERT_TRUE(fd);
+    bundleSize = fd.read(data, size);
+    fd.close();
+
+    TEST_ASSERT_GREATER_THAN(sizeof(AssetBundle::Header), bundleSize);
+    TEST_ASSERT_LESS_THAN(size, bundleSize);
+
+    return bundleSize;
+}
@@ -189,7 +189,7 @@ static void testBitmapWidget()
     {
         for(x = 0; x < BITMAP_WIDTH; ++x)
         {
-            uint32_t    bitmapColor         = x + y * BITMAP_WIDTH;
+            uint32_t    bitmapColor         = Color(x + y * BITMAP_WIDTH);
             Color*      displayBufferColor  = &displayBuffer[x + y * YAGfxTest::WIDTH];
 
             TEST_ASSERT_EQUAL_UINT16(bitmapColor, static_cast<uint32_t>(*displayBufferColor));
@@ -38,6 +38,7 @@
 #include <BmpImgLoader.h>
 #include <YAGfxBitmap.h>
 #include <Util.h>
+#include <chrono>
 
 /******************************************************************************
  * Compiler Switches
@@ -56,6 +57,11 @@
  *****************************************************************************/
 
 static void testBmpImgLoader();
+static void testBmpImgLoaderTopDown();
+static void testBmpImgLoaderRle8();
+static void testBmpImgLoaderRle4();
+static void testBmpImgLoaderSpeed();
+static void verifyColors(const YAGfxDynamicBitmap& bitmap, const uint32_t* expectedColors);
 
 /******************************************************************************
  * Local Variables
@@ -91,6 +97,10 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testBmpImgLoader);
+    RUN_TEST(testBmpImgLoaderTopDown);
+    RUN_TEST(testBmpImgLoaderRle8);
+    RUN_TEST(testBmpImgLoaderRle4);
+    RUN_TEST(testBmpImgLoaderSpeed);
 
     return UNITY_END();
 }
@@ -136,10 +146,10 @@ static void testBmpImgLoader()
     TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test24bpp.bmp", bitmap));
     TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
     TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
-    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 0));
-    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
-    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
-    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(1, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x0000ff)), bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x00ff00)), bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xff0000)), bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xffffff)), bitmap.getColor(1, 1));
 
     /* Load test image:
      * 2x2 pixels
@@ -171,10 +181,10 @@ static void testBmpImgLoader()
     TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test24bppPalette.bmp", bitmap));
     TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
     TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
-    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 0));
-    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
-    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
-    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(1, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x0000ff)), bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x00ff00)), bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xff0000)), bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xffffff)), bitmap.getColor(1, 1));
 
     /* Load test image:
      * 2x2 pixels
@@ -189,8 +199,146 @@ static void testBmpImgLoader()
     TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test32bppPalette.bmp", bitmap));
     TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
     TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
-    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 0));
-    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
-    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
-    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(1, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x0000ff)), bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x00ff00)), bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xff0000)), bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xffffff)), bitmap.getColor(1, 1));
+}
+
+/**
+ * Test bitmap image loader with a top-down image.
+ */
+static void testBmpImgLoaderTopDown()
+{
+    BmpImgLoader       loader;
+    YAGfxDynamicBitmap bitmap;
+    FS                 localFileSystem;
+
+    /* Load test image:
+     * 2x2 pixels
+     * (0, 0) blue
+     * (1, 0) green
+     * (0, 1) red
+     * (1, 1) white
+     * 24 bpp, no compression, negative height (top-down)
+     * No color palette
+     */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test24bppTopDown.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x0000ff)), bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0x00ff00)), bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xff0000)), bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(0xffffff)), bitmap.getColor(1, 1));
+}
+
+/**
+ * Test bitmap image loader with a RLE8 compressed image.
+ */
+static void testBmpImgLoaderRle8()
+{
+    BmpImgLoader       loader;
+    YAGfxDynamicBitmap bitmap;
+    FS                 localFileSystem;
+
+    /* Covers encoded mode, absolute mode with padding, delta and end of line. */
+    const uint32_t     EXPECTED_COLORS[] = {
+        /*        0          1          2          3          4          5 */
+        /* 0 */ 0x000000U, 0x000000U, 0x000000U, 0x000000U, 0xffffffU, 0x000000U,
+        /* 1 */ 0x0000ffU, 0x0000ffU, 0x000000U, 0x000000U, 0x000000U, 0x000000U,
+        /* 2 */ 0x00ff00U, 0x0000ffU, 0xffffffU, 0xff0000U, 0xff0000U, 0xff0000U,
+        /* 3 */ 0xff0000U, 0xff0000U, 0xff0000U, 0xff0000U, 0xff0000U, 0xff0000U
+    };
+
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test8bppRle.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(6, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4, bitmap.getHeight());
+    verifyColors(bitmap, EXPECTED_COLORS);
+}
+
+/**
+ * Test bitmap image loader with a RLE4 compressed image.
+ */
+static void testBmpImgLoaderRle4()
+{
+    BmpImgLoader       loader;
+    YAGfxDynamicBitmap bitmap;
+    FS                 localFileSystem;
+
+    /* Covers encoded mode with alternating indices and absolute mode. */
+    const uint32_t     EXPECTED_COLORS[] = {
+        /*        0          1          2          3          4          5 */
+        /* 0 */ 0x0000ffU, 0xffffffU, 0xff0000U, 0x000000U, 0x000000U, 0x000000U,
+        /* 1 */ 0xff0000U, 0x00ff00U, 0xff0000U, 0x00ff00U, 0xff0000U, 0x000000U
+    };
+
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test4bppRle.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(6, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    verifyColors(bitmap, EXPECTED_COLORS);
+}
+
+/**
+ * Measure loading a 64x64 pixel 24 bpp image and verify its gradient.
+ */
+static void testBmpImgLoaderSpeed()
+{
+    const uint32_t                        COUNT = 100U;
+    BmpImgLoader                          loader;
+    YAGfxDynamicBitmap                    bitmap;
+    FS                                    localFileSystem;
+    uint32_t                              run;
+    int16_t                               x;
+    int16_t                               y;
+    std::chrono::steady_clock::time_point timestampBegin;
+    std::chrono::steady_clock::time_point timestampEnd;
+
+    timestampBegin = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < COUNT; ++run)
+    {
+        TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test_BmpImgLoader/test24bpp64x64.bmp", bitmap));
+    }
+
+    timestampEnd = std::chrono::steady_clock::now();
+
+    printf("BmpImgLoader::load() -> Runtime: %lu ms (%u loops with %u x %u)\n",
+        std::chrono::duration_cast<std::chrono::milliseconds>(timestampEnd - timestampBegin).count(),
+        COUNT,
+        bitmap.getWidth(),
+        bitmap.getHeight());
+
+    TEST_ASSERT_EQUAL_UINT16(64, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(64, bitmap.getHeight());
+
+    /* The red channel follows x, the green channel follows y and blue is constant. */
+    for (y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for (x = 0; x < bitmap.getWidth(); ++x)
+        {
+            uint32_t expectedColor = (static_cast<uint32_t>(x * 4) << 16U) | (static_cast<uint32_t>(y * 4) << 8U) | 0x80U;
+
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(expectedColor)), bitmap.getColor(x, y));
+        }
+    }
+}
+
+/**
+ * Verify all pixels of a bitmap.
+ *
+ * @param[in] bitmap            The bitmap to verify.
+ * @param[in] expectedColors    Expected colors, row by row.
+ */
+static void verifyColors(const YAGfxDynamicBitmap& bitmap, const uint32_t* expectedColors)
+{
+    int16_t x;
+    int16_t y;
+
+    for (y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for (x = 0; x < bitmap.getWidth(); ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(expectedColors[x + y * bitmap.getWidth()])), bitmap.getColor(x, y));
+        }
+    }
 }
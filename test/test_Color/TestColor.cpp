@@ -35,6 +35,7 @@
  *****************************************************************************/
 #include <unity.h>
 #include <Rgb888.h>
+#include <Rgb888Packed.h>
 #include <Rgb565.h>
 #include <ColorUtil.hpp>
 #include <Util.h>
@@ -57,6 +58,7 @@
 
 static void testColorUtil();
 static void testColor888();
+static void testColor888Packed();
 static void testColor565();
 
 /******************************************************************************
@@ -94,6 +96,7 @@ extern int main(int argc, char** argv)
 
     RUN_TEST(testColorUtil);
     RUN_TEST(testColor888);
+    RUN_TEST(testColor888Packed);
     RUN_TEST(testColor565);
 
     return UNITY_END();
@@ -142,23 +145,23 @@ static void testColorUtil()
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb888Blue(ColorDef::GREEN));
     TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb888Blue(ColorDef::BLUE));
 
-    TEST_ASSERT_EQUAL_UINT8(0xf8U, ColorUtil::rgb565Red(0xffffU));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb565Red(0xffffU));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Red(0x0000U));
-    TEST_ASSERT_EQUAL_UINT8(0xf8U, ColorUtil::rgb565Red(0xf800U));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb565Red(0xf800U));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Red(0x07e0U));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Red(0x001fU));
 
-    TEST_ASSERT_EQUAL_UINT8(0xfcU, ColorUtil::rgb565Green(0xffffU));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb565Green(0xffffU));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Green(0x0000U));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Green(0xf800U));
-    TEST_ASSERT_EQUAL_UINT8(0xfcU, ColorUtil::rgb565Green(0x07e0U));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb565Green(0x07e0U));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Green(0x001fU));
 
-    TEST_ASSERT_EQUAL_UINT8(0xf8U, ColorUtil::rgb565Blue(0xffffU));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb565Blue(0xffffU));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Blue(0x0000U));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Blue(0xf800U));
     TEST_ASSERT_EQUAL_UINT8(0x00U, ColorUtil::rgb565Blue(0x07e0U));
-    TEST_ASSERT_EQUAL_UINT8(0xf8U, ColorUtil::rgb565Blue(0x001fU));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, ColorUtil::rgb565Blue(0x001fU));
 
     TEST_ASSERT_EQUAL_UINT16(0x0821U, ColorUtil::to565(0x00080408U));
     TEST_ASSERT_EQUAL_UINT16(0xffffU, ColorUtil::to565(ColorDef::WHITE));
@@ -235,6 +238,86 @@ static void testColor888()
     TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getBlue());
 }
 
+/**
+ * Test packed RGB888 color.
+ */
+static void testColor888Packed()
+{
+    Rgb888Packed myColorA;
+    Rgb888Packed myColorB = ColorDef::TOMATO;
+    Rgb888Packed myColorC = myColorB;
+
+    /* Default color is black */
+    TEST_ASSERT_EQUAL_UINT32(0u, myColorA);
+
+    /* Does the color assignment works? */
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Red(ColorDef::TOMATO), myColorB.getRed());
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Green(ColorDef::TOMATO), myColorB.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Blue(ColorDef::TOMATO), myColorB.getBlue());
+
+    /* Does the color assignment via copy constructor works? */
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Red(ColorDef::TOMATO), myColorC.getRed());
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Green(ColorDef::TOMATO), myColorC.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Blue(ColorDef::TOMATO), myColorC.getBlue());
+
+    /* Check the 5-6-5 RGB format conversion. */
+    myColorA.set(ColorDef::WHITE);
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT16(0xffffu, static_cast<uint16_t>(myColorA));
+
+    myColorA.set(0x00080408U);
+    TEST_ASSERT_EQUAL_UINT8(0x08u, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x04u, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x08u, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT16(0x0821u, myColorA.toRgb565());
+
+    /* Does the color assignment via assignment operator works? */
+    myColorA = myColorB;
+    TEST_ASSERT_EQUAL_UINT8(myColorB.getRed(), myColorC.getRed());
+    TEST_ASSERT_EQUAL_UINT8(myColorB.getGreen(), myColorC.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(myColorB.getBlue(), myColorC.getBlue());
+
+    /* Get/Set single colors */
+    myColorA.setRed(0x12U);
+    myColorA.setGreen(0x34U);
+    myColorA.setBlue(0x56U);
+    TEST_ASSERT_EQUAL_UINT8(0x12u, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x34u, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x56u, myColorA.getBlue());
+
+    /* Dim color 25% darker */
+    myColorA = 0xc8c8c8u;
+    myColorA.setIntensity(192);
+    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getBlue());
+
+    /* Dim a color by 0%, which means no change.
+     * And additional check non-destructive base colors.
+     */
+    myColorA.setIntensity(255);
+    TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getBlue());
+
+    /* Turn the color wheel, the intensity is kept. */
+    myColorA.turnColorWheel(0U);
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x00u, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x00u, myColorA.getBlue());
+
+    /* Intensity is part of the comparison. */
+    myColorB = myColorA;
+    TEST_ASSERT_TRUE(myColorA == myColorB);
+    myColorB.setIntensity(128U);
+    TEST_ASSERT_TRUE(myColorA != myColorB);
+    TEST_ASSERT_EQUAL_UINT32(0x00ff0000u, static_cast<uint32_t>(myColorA));
+    TEST_ASSERT_EQUAL_UINT32(0x00800000u, static_cast<uint32_t>(myColorB));
+}
+
+
 /**
  * Test RGB565 color.
  */
@@ -262,9 +345,9 @@ static void testColor565()
 
     /* Check the 5-6-5 RGB format conversion. */
     myColorA.set(ColorDef::WHITE);
-    TEST_ASSERT_EQUAL_UINT8(0xf8u, myColorA.getRed());
-    TEST_ASSERT_EQUAL_UINT8(0xfcu, myColorA.getGreen());
-    TEST_ASSERT_EQUAL_UINT8(0xf8u, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0xffu, myColorA.getBlue());
     TEST_ASSERT_EQUAL_UINT16(0xffffu, myColorA.toRgb565());
 
     myColorA.set(0x00080408U);
@@ -285,20 +368,29 @@ static void testColor565()
     myColorA.setBlue(0x56U);
     TEST_ASSERT_EQUAL_UINT8(0x10u, myColorA.getRed());
     TEST_ASSERT_EQUAL_UINT8(0x34u, myColorA.getGreen());
-    TEST_ASSERT_EQUAL_UINT8(0x50u, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT8(0x52u, myColorA.getBlue());
 
-    /* Dim color 25% darker */
+    /* Dim color 25% darker.
+     * The 5-6-5 RGB format widens 0xc8 to 0xce for red/blue and 0xcb for green.
+     * The dimmed base colors 0x9b/0x98 are stored in 5-6-5 RGB format again.
+     */
     myColorA = 0xc8c8c8u;
     myColorA.setIntensity(192);
-    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getRed());
-    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getGreen());
-    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getBlue());
-
-    /* Dim a color by 0%, which means no change.
-     * And additional check non-destructive base colors.
+    TEST_ASSERT_EQUAL_UINT8(0x9cu, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x9au, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x9cu, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT8(Rgb565::MAX_BRIGHT, myColorA.getIntensity());
+    TEST_ASSERT_EQUAL_UINT16(ColorUtil::to565(0x9bu, 0x98u, 0x9bu), myColorA.toRgb565());
+
+    /* The intensity is applied destructive to the base colors, therefore
+     * max. intensity won't restore them.
      */
     myColorA.setIntensity(255);
-    TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getRed());
-    TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getGreen());
-    TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT8(0x9cu, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x9au, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x9cu, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT16(ColorUtil::to565(0x9bu, 0x98u, 0x9bu), myColorA.toRgb565());
+
+    /* The color needs only 16 bit per pixel. */
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint16_t), sizeof(Rgb565));
 }
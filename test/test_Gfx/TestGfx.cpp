@@ -36,6 +36,10 @@
 #include <unity.h>
 #include <Util.h>
 #include <chrono>
+#include <Rgb888.h>
+#include <Rgb888Packed.h>
+#include <TypedAllocator.hpp>
+#include <PsAllocator.hpp>
 
 #include "../common/YAGfxTest.hpp"
 
@@ -56,8 +60,16 @@
  *****************************************************************************/
 
 static void testGfx();
+static void testDirtyArea();
+static void testRasterizer();
+static void testBlendBitmap();
+static uint32_t countPixels(const YAGfx& gfx, const Color& color);
 static void testGfxSpeed();
 static void measureGfxSpeed(uint16_t width, uint16_t height, uint32_t count);
+static void testColorSpeed();
+
+template < typename TColor >
+static void measureColorSpeed(const char* name, uint16_t width, uint16_t height, uint32_t count);
 
 /******************************************************************************
  * Local Variables
@@ -93,7 +105,11 @@ extern int main(int argc, char** argv)
     UNITY_BEGIN();
 
     RUN_TEST(testGfx);
+    RUN_TEST(testDirtyArea);
+    RUN_TEST(testRasterizer);
+    RUN_TEST(testBlendBitmap);
     RUN_TEST(testGfxSpeed);
+    RUN_TEST(testColorSpeed);
 
     return UNITY_END();
 }
@@ -240,6 +256,328 @@ static void testGfx()
     TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH, YAGfxTest::HEIGHT, 0U));
 }
 
+/**
+ * Test the dirty area tracking.
+ */
+static void testDirtyArea()
+{
+    YAGfxDynamicBitmap bitmap;
+    YAGfxDynamicBitmap display;
+    BaseGfxDirtyArea   area;
+
+    /* Add rectangles. */
+    TEST_ASSERT_TRUE(area.isEmpty());
+    area.add(2, 3, 0U, 4U);
+    TEST_ASSERT_TRUE(area.isEmpty());
+    area.add(2, 3, 4U, 5U);
+    TEST_ASSERT_FALSE(area.isEmpty());
+    TEST_ASSERT_EQUAL_INT16(2, area.getX());
+    TEST_ASSERT_EQUAL_INT16(3, area.getY());
+    TEST_ASSERT_EQUAL_UINT16(4U, area.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(5U, area.getHeight());
+    area.add(0, 10, 1U, 1U);
+    TEST_ASSERT_EQUAL_INT16(0, area.getX());
+    TEST_ASSERT_EQUAL_INT16(3, area.getY());
+    TEST_ASSERT_EQUAL_UINT16(6U, area.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(8U, area.getHeight());
+    area.clear();
+    TEST_ASSERT_TRUE(area.isEmpty());
+
+    /* A new bitmap is completely dirty. */
+    TEST_ASSERT_TRUE(bitmap.create(32U, 8U));
+    TEST_ASSERT_TRUE(display.create(32U, 8U));
+    TEST_ASSERT_EQUAL_UINT16(32U, bitmap.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(8U, bitmap.getDirtyArea().getHeight());
+    bitmap.clearDirtyArea();
+    display.clearDirtyArea();
+
+    /* Drawing without changing any pixel keeps the area empty. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.drawPixel(4, 4, ColorDef::BLACK);
+    TEST_ASSERT_TRUE(bitmap.getDirtyArea().isEmpty());
+
+    /* Only the changed pixels are tracked. */
+    bitmap.drawPixel(4, 4, ColorDef::RED);
+    bitmap.drawHLine(0, 2, 10U, ColorDef::BLACK);
+    bitmap.drawHLine(6, 6, 3U, ColorDef::RED);
+    TEST_ASSERT_EQUAL_INT16(4, bitmap.getDirtyArea().getX());
+    TEST_ASSERT_EQUAL_INT16(4, bitmap.getDirtyArea().getY());
+    TEST_ASSERT_EQUAL_UINT16(5U, bitmap.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(3U, bitmap.getDirtyArea().getHeight());
+
+    /* Copy only the dirty area. The destination tracks the really changed pixels. */
+    display.copy(bitmap, bitmap.getDirtyArea());
+    bitmap.clearDirtyArea();
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == display.getColor(4, 4));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == display.getColor(8, 6));
+    TEST_ASSERT_EQUAL_INT16(4, display.getDirtyArea().getX());
+    TEST_ASSERT_EQUAL_INT16(4, display.getDirtyArea().getY());
+    TEST_ASSERT_EQUAL_UINT16(5U, display.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(3U, display.getDirtyArea().getHeight());
+    display.clearDirtyArea();
+
+    /* Copy the same content again, nothing changes. */
+    display.copy(bitmap);
+    TEST_ASSERT_TRUE(display.getDirtyArea().isEmpty());
+
+    /* A dirty area partly outside is clipped. */
+    area.add(-5, -5, 100U, 100U);
+    bitmap.drawPixel(31, 7, ColorDef::GREEN);
+    display.copy(bitmap, area);
+    TEST_ASSERT_TRUE(Color(ColorDef::GREEN) == display.getColor(31, 7));
+    TEST_ASSERT_EQUAL_INT16(31, display.getDirtyArea().getX());
+    TEST_ASSERT_EQUAL_INT16(7, display.getDirtyArea().getY());
+    TEST_ASSERT_EQUAL_UINT16(1U, display.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(1U, display.getDirtyArea().getHeight());
+    display.clearDirtyArea();
+
+    /* Changes over several rows of a contiguous framebuffer mark the complete rows. */
+    bitmap.drawPixel(30, 1, ColorDef::RED);
+    bitmap.drawPixel(2, 3, ColorDef::RED);
+    display.copy(bitmap);
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == display.getColor(30, 1));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == display.getColor(2, 3));
+    TEST_ASSERT_EQUAL_INT16(0, display.getDirtyArea().getX());
+    TEST_ASSERT_EQUAL_INT16(1, display.getDirtyArea().getY());
+    TEST_ASSERT_EQUAL_UINT16(32U, display.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(3U, display.getDirtyArea().getHeight());
+    display.clearDirtyArea();
+
+    /* Filling complete rows tracks only the really changed pixels. */
+    display.fillRect(0, 4, 32U, 2U, ColorDef::BLACK);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == display.getColor(4, 4));
+    TEST_ASSERT_EQUAL_INT16(4, display.getDirtyArea().getX());
+    TEST_ASSERT_EQUAL_INT16(4, display.getDirtyArea().getY());
+    TEST_ASSERT_EQUAL_UINT16(1U, display.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(1U, display.getDirtyArea().getHeight());
+}
+
+/**
+ * Test the polygon and anti-aliased primitives.
+ */
+static void testRasterizer()
+{
+    YAGfxDynamicBitmap bitmap;
+    YAGfxDynamicBitmap reference;
+    const BaseGfxPoint SQUARE[4U] = {
+        { 2, 1 }, { 6, 1 }, { 6, 5 }, { 2, 5 }
+    };
+    const BaseGfxPoint BOWTIE[4U] = {
+        { 0, 0 }, { 8, 8 }, { 8, 0 }, { 0, 8 }
+    };
+    int16_t            x;
+    int16_t            y;
+
+    TEST_ASSERT_TRUE(bitmap.create(32U, 16U));
+    TEST_ASSERT_TRUE(reference.create(32U, 16U));
+
+    /* A polygon fills the same pixels like a rectangle. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    reference.fillScreen(ColorDef::BLACK);
+    bitmap.fillPolygon(SQUARE, 4U, ColorDef::RED);
+    reference.fillRect(2, 1, 4U, 4U, ColorDef::RED);
+
+    for (y = 0; y < 16; ++y)
+    {
+        for (x = 0; x < 32; ++x)
+        {
+            TEST_ASSERT_TRUE(reference.getColor(x, y) == bitmap.getColor(x, y));
+        }
+    }
+
+    /* Too many corners are rejected. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.fillPolygon(SQUARE, YAGfx::MAX_POLYGON_POINTS + 1U, ColorDef::RED);
+    TEST_ASSERT_EQUAL_UINT32(0U, countPixels(bitmap, ColorDef::RED));
+
+    /* Triangle with 8 + 7 + ... + 1 pixels. */
+    bitmap.fillTriangle(0, 0, 8, 0, 0, 8, ColorDef::RED);
+    TEST_ASSERT_EQUAL_UINT32(36U, countPixels(bitmap, ColorDef::RED));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(7, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(0, 7));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(8, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(1, 7));
+
+    /* Self-intersecting polygon uses the even-odd rule. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.fillPolygon(BOWTIE, 4U, ColorDef::RED);
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(0, 4));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(4, 1));
+
+    /* Clipped polygon. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.fillTriangle(-100, -100, 120, -100, -100, 120, ColorDef::RED);
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(31, 15));
+
+    /* Thick line including the end points. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.drawThickLine(2, 5, 9, 5, 3U, ColorDef::RED);
+    TEST_ASSERT_EQUAL_UINT32(3U * 8U, countPixels(bitmap, ColorDef::RED));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(2, 4));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(9, 6));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(10, 5));
+
+    /* Rounded rectangle keeps the corner empty. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.fillRoundRect(0, 0, 10U, 8U, 3U, ColorDef::RED);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(9, 7));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(3, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(0, 3));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(5, 4));
+
+    /* The outline lies inside the filled one and keeps the inner part empty. */
+    reference.fillScreen(ColorDef::BLACK);
+    reference.drawRoundRect(0, 0, 10U, 8U, 3U, ColorDef::RED);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == reference.getColor(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == reference.getColor(3, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == reference.getColor(0, 3));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == reference.getColor(9, 4));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == reference.getColor(5, 4));
+
+    for (y = 0; y < 8; ++y)
+    {
+        for (x = 0; x < 10; ++x)
+        {
+            if (Color(ColorDef::RED) == reference.getColor(x, y))
+            {
+                TEST_ASSERT_TRUE(Color(ColorDef::RED) == bitmap.getColor(x, y));
+            }
+        }
+    }
+
+    /* Anti-aliased circle is solid inside and blended at the edge.
+     * The tolerance considers the RGB565 color format.
+     */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.fillCircleAA(8, 8, 5U, ColorDef::WHITE);
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(8, 8));
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(8, 4));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(8, 1));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(15, 8));
+    TEST_ASSERT_UINT8_WITHIN(8U, 128U, bitmap.getColor(8, 3).getRed());
+    TEST_ASSERT_UINT8_WITHIN(8U, 128U, bitmap.getColor(13, 8).getBlue());
+
+    /* Anti-aliased line distributes the coverage on two pixels. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.drawLineAA(0, 0, 4, 2, ColorDef::WHITE);
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(4, 2));
+    TEST_ASSERT_UINT8_WITHIN(8U, 127U, bitmap.getColor(1, 0).getRed());
+    TEST_ASSERT_UINT8_WITHIN(8U, 127U, bitmap.getColor(1, 1).getRed());
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(2, 1));
+}
+
+/**
+ * Test drawing bitmaps with blend modes and alpha channel.
+ */
+static void testBlendBitmap()
+{
+    YAGfxDynamicBitmap canvas;
+    YAGfxDynamicBitmap bitmap;
+    YAGfxAlphaBitmap   alphaBitmap;
+
+    TEST_ASSERT_TRUE(canvas.create(8U, 4U));
+    TEST_ASSERT_TRUE(bitmap.create(2U, 2U));
+    TEST_ASSERT_TRUE(alphaBitmap.create(4U, 1U));
+
+    /* A bitmap without alpha channel is opaque, source over is a copy. */
+    bitmap.fillScreen(ColorDef::RED);
+    bitmap.drawPixel(1, 1, ColorDef::BLUE);
+    TEST_ASSERT_NULL(bitmap.getAlphaXAddr(0, 0, 1U));
+    canvas.fillScreen(ColorDef::BLACK);
+    canvas.clearDirtyArea();
+    canvas.drawBitmap(1, 1, bitmap, YAGfx::BLEND_MODE_SRC_OVER);
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == canvas.getColor(1, 1));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLUE) == canvas.getColor(2, 2));
+    TEST_ASSERT_EQUAL_INT16(1, canvas.getDirtyArea().getX());
+    TEST_ASSERT_EQUAL_INT16(1, canvas.getDirtyArea().getY());
+    TEST_ASSERT_EQUAL_UINT16(2U, canvas.getDirtyArea().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2U, canvas.getDirtyArea().getHeight());
+
+    /* Drawing the same again changes nothing. */
+    canvas.clearDirtyArea();
+    canvas.drawBitmap(1, 1, bitmap, YAGfx::BLEND_MODE_SRC_OVER);
+    TEST_ASSERT_TRUE(canvas.getDirtyArea().isEmpty());
+
+    /* Clipped at the upper left border, the bitmap is shifted out. */
+    canvas.fillScreen(ColorDef::BLACK);
+    canvas.drawBitmap(-1, -1, bitmap, YAGfx::BLEND_MODE_SRC_OVER);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLUE) == canvas.getColor(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == canvas.getColor(1, 0));
+
+    /* Half transparent source over.
+     * The tolerances consider the RGB565 color format.
+     */
+    canvas.fillScreen(ColorDef::WHITE);
+    canvas.drawBitmap(0, 0, bitmap, YAGfx::BLEND_MODE_SRC_OVER, 128U);
+    TEST_ASSERT_UINT8_WITHIN(8U, 255U, canvas.getColor(0, 0).getRed());
+    TEST_ASSERT_UINT8_WITHIN(8U, 127U, canvas.getColor(0, 0).getGreen());
+    TEST_ASSERT_UINT8_WITHIN(8U, 127U, canvas.getColor(0, 0).getBlue());
+
+    /* Add saturates, multiply filters. */
+    canvas.fillScreen(0x404040U);
+    canvas.drawBitmap(0, 0, bitmap, YAGfx::BLEND_MODE_ADD);
+    TEST_ASSERT_UINT8_WITHIN(8U, 255U, canvas.getColor(0, 0).getRed());
+    TEST_ASSERT_UINT8_WITHIN(4U, 0x40U, canvas.getColor(0, 0).getGreen());
+    canvas.fillScreen(ColorDef::WHITE);
+    canvas.drawBitmap(0, 0, bitmap, YAGfx::BLEND_MODE_MULTIPLY);
+    TEST_ASSERT_UINT8_WITHIN(16U, 255U, canvas.getColor(0, 0).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, canvas.getColor(0, 0).getGreen());
+    canvas.fillScreen(ColorDef::BLACK);
+    canvas.drawBitmap(0, 0, bitmap, YAGfx::BLEND_MODE_MULTIPLY);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == canvas.getColor(0, 0));
+
+    /* Per pixel alpha, additionally scaled by the bitmap alpha. */
+    TEST_ASSERT_EQUAL_UINT8(255U, alphaBitmap.getAlpha(3, 0));
+    TEST_ASSERT_EQUAL_UINT8(0U, alphaBitmap.getAlpha(4, 0));
+    alphaBitmap.fillScreen(ColorDef::WHITE);
+    alphaBitmap.setAlpha(0, 0, 0U);
+    alphaBitmap.setAlpha(1, 0, 128U);
+    canvas.fillScreen(ColorDef::BLACK);
+    canvas.drawBitmap(0, 0, alphaBitmap, YAGfx::BLEND_MODE_SRC_OVER);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == canvas.getColor(0, 0));
+    TEST_ASSERT_UINT8_WITHIN(8U, 128U, canvas.getColor(1, 0).getRed());
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == canvas.getColor(2, 0));
+    canvas.fillScreen(ColorDef::BLACK);
+    canvas.drawBitmap(0, 0, alphaBitmap, YAGfx::BLEND_MODE_SRC_OVER, 128U);
+    TEST_ASSERT_UINT8_WITHIN(8U, 64U, canvas.getColor(1, 0).getRed());
+    TEST_ASSERT_UINT8_WITHIN(8U, 128U, canvas.getColor(2, 0).getRed());
+
+    /* Released, there is no alpha channel anymore. */
+    alphaBitmap.release();
+    TEST_ASSERT_NULL(alphaBitmap.getAlphaXAddr(0, 0, 1U));
+}
+
+/**
+ * Count the pixels with the given color.
+ *
+ * @param[in] gfx   Graphics functionality
+ * @param[in] color Color which to count
+ *
+ * @return Number of pixels
+ */
+static uint32_t countPixels(const YAGfx& gfx, const Color& color)
+{
+    uint32_t count = 0U;
+    int16_t  x;
+    int16_t  y;
+
+    for (y = 0; y < gfx.getHeight(); ++y)
+    {
+        for (x = 0; x < gfx.getWidth(); ++x)
+        {
+            if (color == gfx.getColor(x, y))
+            {
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
+
 /**
  * Measure performance of some graphic functions.
  */
@@ -381,3 +719,83 @@ static void measureGfxSpeed(uint16_t width, uint16_t height, uint32_t count)
     srcBitmap.release();
     dstBitmap.release();
 }
+
+/**
+ * Measure the copy and fill throughput of the different color formats.
+ */
+static void testColorSpeed()
+{
+    const uint32_t MAX_LOOPS = 20000U;
+
+    printf("--------------------------------------------------------------------------------\n");
+    printf("Color format measurement with 64x64\n");
+    printf("--------------------------------------------------------------------------------\n");
+    measureColorSpeed<Rgb888>("Rgb888", 64U, 64U, MAX_LOOPS);
+    measureColorSpeed<Rgb888Packed>("Rgb888Packed", 64U, 64U, MAX_LOOPS);
+    printf("--------------------------------------------------------------------------------\n");
+}
+
+/**
+ * Measure the copy and fill throughput of a color format.
+ * The content changes in every loop, so every pixel is written.
+ *
+ * @tparam TColor   Color format
+ *
+ * @param[in] name      Name of the color format
+ * @param[in] width     Bitmap width in pixel
+ * @param[in] height    Bitmap height in pixel
+ * @param[in] count     Number of loops
+ */
+template < typename TColor >
+static void measureColorSpeed(const char* name, uint16_t width, uint16_t height, uint32_t count)
+{
+    BaseGfxDynamicBitmap<TColor, TypedAllocator<TColor, PsAllocator>> srcBitmapA;
+    BaseGfxDynamicBitmap<TColor, TypedAllocator<TColor, PsAllocator>> srcBitmapB;
+    BaseGfxDynamicBitmap<TColor, TypedAllocator<TColor, PsAllocator>> dstBitmap;
+    uint32_t                                                          run;
+    std::chrono::steady_clock::time_point                             timestampBegin;
+    std::chrono::steady_clock::time_point                             timestampEnd;
+
+    TEST_ASSERT_TRUE(srcBitmapA.create(width, height));
+    TEST_ASSERT_TRUE(srcBitmapB.create(width, height));
+    TEST_ASSERT_TRUE(dstBitmap.create(width, height));
+
+    srcBitmapA.fillScreen(ColorDef::ROYALBLUE);
+    srcBitmapB.fillScreen(ColorDef::TOMATO);
+
+    timestampBegin = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < count; ++run)
+    {
+        dstBitmap.copy((0U == (run % 2U)) ? srcBitmapA : srcBitmapB);
+    }
+
+    timestampEnd = std::chrono::steady_clock::now();
+
+    printf("%s: BaseGfx::copy() -> Runtime: %lu ms (%u loops with %u x %u)\n",
+        name,
+        std::chrono::duration_cast<std::chrono::milliseconds>(timestampEnd - timestampBegin).count(),
+        count,
+        width,
+        height);
+
+    timestampBegin = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < count; ++run)
+    {
+        dstBitmap.fillRect(0, 0, width, height, (0U == (run % 2U)) ? ColorDef::ROYALBLUE : ColorDef::TOMATO);
+    }
+
+    timestampEnd = std::chrono::steady_clock::now();
+
+    printf("%s: BaseGfx::fillRect() -> Runtime: %lu ms (%u loops with %u x %u)\n",
+        name,
+        std::chrono::duration_cast<std::chrono::milliseconds>(timestampEnd - timestampBegin).count(),
+        count,
+        width,
+        height);
+
+    srcBitmapA.release();
+    srcBitmapB.release();
+    dstBitmap.release();
+}
@@ -35,7 +35,9 @@
  *****************************************************************************/
 #include <unity.h>
 #include <YAGfxText.h>
+#include <YAFont.h>
 #include <YAGfxBrush.h>
+#include <YAGfxBitmap.h>
 #include <TomThumb.h>
 #include <Util.h>
 
@@ -58,11 +60,56 @@
  *****************************************************************************/
 
 static void testGfxText();
+static void testBrushSpan();
+static void testAAFont();
+static void testUnicodeFont();
 
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
 
+/**
+ * Bitmap of a 4x2 glyph with 2 bit coverage per pixel.
+ * Row 0: full, 2/3, 1/3, none
+ * Row 1: none, full, full, full
+ */
+static uint8_t gAABitmap[] = {
+    0xE4, 0x3F
+};
+
+/** Glyph of the anti-aliased font. */
+static GFXglyph gAAGlyphs[] = {
+    { 0, 4, 2, 5, 0, -2 }
+};
+
+/** Anti-aliased font with a single glyph. */
+static const GFXfontAA gAAFont = {
+    { gAABitmap,
+      gAAGlyphs,
+      'A',
+      'A',
+      3 },
+    2
+};
+
+/**
+ * Sparse Unicode ranges of the TomThumb glyphs. The last range exceeds the
+ * glyph array on purpose.
+ */
+static const GFXunicodeRange gUnicodeRanges[] = {
+    { 0x0020U, 0x007EU, 0U },
+    { 0x00A1U, 0x00FFU, 95U },
+    { 0x20ACU, 0x20ACU, 202U },
+    { 0xFFFDU, 0xFFFDU, 203U },
+    { 0x1F300U, 0x1F3FFU, 200U }
+};
+
+/** Unicode map of the TomThumb glyphs. */
+static const GFXunicodeMap gUnicodeMap = {
+    gUnicodeRanges,
+    UTIL_ARRAY_NUM(gUnicodeRanges)
+};
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -93,6 +140,9 @@ extern int main(int argc, char** argv)
     UNITY_BEGIN();
 
     RUN_TEST(testGfxText);
+    RUN_TEST(testBrushSpan);
+    RUN_TEST(testAAFont);
+    RUN_TEST(testUnicodeFont);
 
     return UNITY_END();
 }
@@ -173,3 +223,266 @@ static void testGfxText()
     TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(glyph->xAdvance, "AA", boundingBoxWidth, boundingBoxHeight));
     TEST_ASSERT_EQUAL_UINT16(2U * TomThumb.yAdvance, boundingBoxHeight);
 }
+
+/**
+ * Test the span wise brush evaluation and the span wise text rendering.
+ */
+static void testBrushSpan()
+{
+    YAGfxDynamicBitmap       bitmap;
+    YAGfxText                gfxText;
+    YAGfxSolidBrush          solidBrush(ColorDef::RED);
+    YAGfxLinearGradientBrush gradientBrush(ColorDef::RED, ColorDef::BLUE, 4, 24U, false);
+    Color                    colors[40U];
+    uint16_t                 setPixels = 0U;
+    int16_t                  x;
+    int16_t                  y;
+
+    /* The span colors are the same like pixel by pixel. */
+    TEST_ASSERT_TRUE(solidBrush.isSolid());
+    TEST_ASSERT_FALSE(gradientBrush.isSolid());
+
+    gradientBrush.getColors(-4, 0, 40U, colors);
+
+    for (x = 0; x < 40; ++x)
+    {
+        TEST_ASSERT_TRUE(gradientBrush.getColor(x - 4, 0) == colors[x]);
+    }
+
+    gradientBrush.setDirection(true);
+    gradientBrush.getColors(0, 10, 40U, colors);
+
+    for (x = 0; x < 40; ++x)
+    {
+        TEST_ASSERT_TRUE(gradientBrush.getColor(x, 10) == colors[x]);
+    }
+
+    gradientBrush.setDirection(false);
+
+    /* The brush intensity dims only the drawn color, therefore setting it
+     * repeatedly doesn't accumulate and max. intensity restores the color.
+     */
+    solidBrush.setIntensity(128U);
+    solidBrush.setIntensity(128U);
+    TEST_ASSERT_EQUAL_UINT8(128U, solidBrush.getIntensity());
+    TEST_ASSERT_EQUAL_UINT8(Color(255U, 0U, 0U, 128U).getRed(), solidBrush.getColor(0, 0).getRed());
+    solidBrush.setIntensity(Color::MAX_BRIGHT);
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == solidBrush.getColor(0, 0));
+
+    /* A filled rectangle gets the brush colors. */
+    TEST_ASSERT_TRUE(bitmap.create(32U, 8U));
+    bitmap.fillScreen(ColorDef::BLACK);
+    bitmap.fillRect(-2, 1, 40U, 2U, gradientBrush);
+
+    for (x = 0; x < 32; ++x)
+    {
+        TEST_ASSERT_TRUE(gradientBrush.getColor(x, 1) == bitmap.getColor(x, 1));
+        TEST_ASSERT_TRUE(gradientBrush.getColor(x, 2) == bitmap.getColor(x, 2));
+        TEST_ASSERT_TRUE(Color(ColorDef::BLACK) == bitmap.getColor(x, 3));
+    }
+
+    /* Text is drawn with the brush colors at the pixel positions. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    gfxText.setFont(&TomThumb);
+    gfxText.setBrush(gradientBrush);
+    gfxText.setTextCursorPos(-1, 6);
+    gfxText.drawText(bitmap, "HELLO WORLD");
+
+    for (y = 0; y < 8; ++y)
+    {
+        for (x = 0; x < 32; ++x)
+        {
+            if (Color(ColorDef::BLACK) != bitmap.getColor(x, y))
+            {
+                TEST_ASSERT_TRUE(gradientBrush.getColor(x, y) == bitmap.getColor(x, y));
+                ++setPixels;
+            }
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN(0U, setPixels);
+}
+
+/**
+ * Test drawing text with an anti-aliased font.
+ */
+static void testAAFont()
+{
+    const GFXfontAA          invalidFont = { gAAFont.gfxFont, 3 };
+    YAGfxDynamicBitmap       bitmap;
+    YAGfxDynamicBitmap       expected;
+    YAGfxText                gfxText;
+    YAFont                   font(&gAAFont);
+    YAGfxSolidBrush          solidBrush(ColorDef::WHITE);
+    YAGfxLinearGradientBrush gradientBrush(ColorDef::RED, ColorDef::BLUE, 0, 8U, false);
+    const uint8_t            ALPHA[2][4] = {
+        { 255U, 170U, 85U, 0U },
+        { 0U, 255U, 255U, 255U }
+    };
+    int16_t x;
+    int16_t y;
+
+    TEST_ASSERT_EQUAL_UINT8(2U, font.getBitsPerPixel());
+    TEST_ASSERT_EQUAL_PTR(&gAAFont.gfxFont, font.getGfxFont());
+    TEST_ASSERT_EQUAL_UINT16(3U, font.getHeight());
+
+    /* Unsupported number of bits per pixel. */
+    font.setGfxFont(&invalidFont);
+    TEST_ASSERT_NULL(font.getGfxFont());
+    font.setGfxFont(&TomThumb);
+    TEST_ASSERT_EQUAL_UINT8(1U, font.getBitsPerPixel());
+    font.setGfxFont(&gAAFont);
+
+    TEST_ASSERT_TRUE(bitmap.create(8U, 4U));
+    TEST_ASSERT_TRUE(expected.create(8U, 4U));
+
+    /* Partly covered pixels are blended with the existing pixels. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    gfxText.setFont(font);
+    gfxText.setBrush(solidBrush);
+    gfxText.setTextCursorPos(1, 2);
+    gfxText.drawChar(bitmap, 'A');
+
+    expected.fillScreen(ColorDef::BLACK);
+
+    for (y = 0; y < 2; ++y)
+    {
+        for (x = 0; x < 4; ++x)
+        {
+            expected.blendPixel(1 + x, y, ColorDef::WHITE, ALPHA[y][x]);
+        }
+    }
+
+    for (y = 0; y < 4; ++y)
+    {
+        for (x = 0; x < 8; ++x)
+        {
+            TEST_ASSERT_TRUE(expected.getColor(x, y) == bitmap.getColor(x, y));
+        }
+    }
+
+    /* Same with the brush colors at the pixel positions. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    gfxText.setBrush(gradientBrush);
+    gfxText.setTextCursorPos(1, 2);
+    gfxText.drawChar(bitmap, 'A');
+
+    expected.fillScreen(ColorDef::BLACK);
+
+    for (y = 0; y < 2; ++y)
+    {
+        for (x = 0; x < 4; ++x)
+        {
+            expected.blendPixel(1 + x, y, gradientBrush.getColor(1 + x, y), ALPHA[y][x]);
+        }
+    }
+
+    for (y = 0; y < 4; ++y)
+    {
+        for (x = 0; x < 8; ++x)
+        {
+            TEST_ASSERT_TRUE(expected.getColor(x, y) == bitmap.getColor(x, y));
+        }
+    }
+
+    /* Glyphs are clipped at the canvas borders. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    gfxText.setBrush(solidBrush);
+    gfxText.setTextCursorPos(-2, 1);
+    gfxText.drawChar(bitmap, 'A');
+    gfxText.setTextCursorPos(6, 4);
+    gfxText.drawChar(bitmap, 'A');
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(7, 3));
+    TEST_ASSERT_TRUE(Color(ColorDef::WHITE) == bitmap.getColor(6, 2));
+}
+
+/**
+ * Test the glyph lookup by Unicode code point and the UTF-8 text rendering.
+ */
+static void testUnicodeFont()
+{
+    YAFont             font(&TomThumb);
+    YAGfxText          gfxText;
+    YAGfxDynamicBitmap bitmap;
+    YAGfxDynamicBitmap expected;
+    YAGfxSolidBrush    brush(ColorDef::WHITE);
+    uint16_t           boxWidth  = 0U;
+    uint16_t           boxHeight = 0U;
+    int16_t            x;
+    int16_t            y;
+
+    /* Without unicode map, the code point is the character code of the font. */
+    TEST_ASSERT_NULL(font.getUnicodeMap());
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs['A' - TomThumb.first], font.getGlyph('A'));
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs[0xB0U - TomThumb.first], font.getGlyph(0xB0U));
+    TEST_ASSERT_NULL(font.getGlyph(0x20ACU));
+
+    /* With unicode map, the code point ranges are searched. */
+    font.setGfxFont(&TomThumb, &gUnicodeMap);
+    TEST_ASSERT_EQUAL_PTR(&gUnicodeMap, font.getUnicodeMap());
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs['A' - TomThumb.first], font.getGlyph('A'));
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs[95U + 0xB0U - 0xA1U], font.getGlyph(0xB0U));
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs[202U], font.getGlyph(0x20ACU));
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs[203U], font.getGlyph(0xFFFDU));
+    TEST_ASSERT_NULL(font.getGlyph(0x1FU));
+    TEST_ASSERT_NULL(font.getGlyph(0x80U));
+    TEST_ASSERT_NULL(font.getGlyph(0x2022U));
+    TEST_ASSERT_NULL(font.getGlyph(0x10FFFFU));
+    TEST_ASSERT_NULL(font.getGlyph('\n'));
+
+    /* Glyphs beyond the glyph array are not available. */
+    TEST_ASSERT_EQUAL_PTR(&TomThumbGlyphs[203U], font.getGlyph(0x1F303U));
+    TEST_ASSERT_NULL(font.getGlyph(0x1F304U));
+
+    /* The map is kept by copy and replaced by setting another font. */
+    gfxText.setFont(font);
+    TEST_ASSERT_EQUAL_PTR(&gUnicodeMap, gfxText.getFont().getUnicodeMap());
+    font.setGfxFont(&TomThumb);
+    TEST_ASSERT_NULL(font.getUnicodeMap());
+
+    /* UTF-8 encoded text: degree sign and C */
+    TEST_ASSERT_TRUE(gfxText.getTextBoundingBox(32U, "\xC2\xB0""C", boxWidth, boxHeight));
+    TEST_ASSERT_EQUAL_UINT16(TomThumbGlyphs[95U + 0xB0U - 0xA1U].xAdvance + TomThumbGlyphs['C' - TomThumb.first].xAdvance, boxWidth);
+    TEST_ASSERT_EQUAL_UINT16(TomThumb.yAdvance, boxHeight);
+
+    TEST_ASSERT_TRUE(bitmap.create(16U, 8U));
+    TEST_ASSERT_TRUE(expected.create(16U, 8U));
+
+    /* Multi-byte character is drawn like its code point. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    gfxText.setBrush(brush);
+    gfxText.setTextCursorPos(0, 6);
+    gfxText.drawText(bitmap, "\xE2\x82\xAC!");
+
+    expected.fillScreen(ColorDef::BLACK);
+    gfxText.setTextCursorPos(0, 6);
+    gfxText.drawChar(expected, 0x20ACU);
+    gfxText.drawChar(expected, '!');
+
+    for (y = 0; y < 8; ++y)
+    {
+        for (x = 0; x < 16; ++x)
+        {
+            TEST_ASSERT_TRUE(expected.getColor(x, y) == bitmap.getColor(x, y));
+        }
+    }
+
+    /* Truncated sequence is drawn as replacement character. */
+    bitmap.fillScreen(ColorDef::BLACK);
+    gfxText.setTextCursorPos(0, 6);
+    gfxText.drawText(bitmap, "\xE2\x82!");
+
+    expected.fillScreen(ColorDef::BLACK);
+    gfxText.setTextCursorPos(0, 6);
+    gfxText.drawChar(expected, 0xFFFDU);
+    gfxText.drawChar(expected, '!');
+
+    for (y = 0; y < 8; ++y)
+    {
+        for (x = 0; x < 16; ++x)
+        {
+            TEST_ASSERT_TRUE(expected.getColor(x, y) == bitmap.getColor(x, y));
+        }
+    }
+}
@@ -37,6 +37,7 @@
 #include <GifFileLoader.h>
 #include <GifFileToMemLoader.h>
 #include <GifImgPlayer.h>
+#include <YAGfxBitmap.h>
 #include <Util.h>
 #include <FS.h>
 
@@ -58,10 +59,24 @@
  * Prototypes
  *****************************************************************************/
 
+/** Width of the animated test GIF image. */
+static const uint16_t SCENE_WIDTH  = 11U;
+
+/** Height of the animated test GIF image. */
+static const uint16_t SCENE_HEIGHT = 29U;
+
+/** Number of pixels of a scene of the animated test GIF image. */
+static const uint32_t SCENE_SIZE   = SCENE_WIDTH * SCENE_HEIGHT;
+
+/** Max. number of recorded scenes per animation loop. */
+static const uint8_t  MAX_SCENES   = 8U;
+
 static void testGifImgPlayerStatic();
 static void testGifImgPlayerAnimated();
 static void testGifImgPlayerMemStatic();
 static void testGifImgPlayerMemAnimated();
+static void testGifImgPlayerFrameCache();
+static uint8_t playLoop(GifImgPlayer& gifImgPlayer, YAGfxDynamicBitmap& bitmap, uint32_t scenes[][SCENE_SIZE]);
 
 /******************************************************************************
  * Local Variables
@@ -118,6 +133,7 @@ extern int main(int argc, char** argv)
     RUN_TEST(testGifImgPlayerAnimated);
     RUN_TEST(testGifImgPlayerMemStatic);
     RUN_TEST(testGifImgPlayerMemAnimated);
+    RUN_TEST(testGifImgPlayerFrameCache);
 
     return UNITY_END();
 }
@@ -168,7 +184,7 @@ static void testGifImgPlayerStatic()
 
             printf("%u, %u / 0x%X <-> 0x%X\n", x, y, EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
 
-            TEST_ASSERT_EQUAL_UINT32(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH])), static_cast<uint32_t>(color));
         }
     }
 
@@ -185,7 +201,7 @@ static void testGifImgPlayerStatic()
 
             printf("%u, %u / 0x%X <-> 0x%X\n", x, y, EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
 
-            TEST_ASSERT_EQUAL_UINT32(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH])), static_cast<uint32_t>(color));
         }
     }
 }
@@ -237,7 +253,7 @@ static void testGifImgPlayerMemStatic()
 
             printf("%u, %u / 0x%X <-> 0x%X\n", x, y, EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
 
-            TEST_ASSERT_EQUAL_UINT32(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH])), static_cast<uint32_t>(color));
         }
     }
 
@@ -254,7 +270,7 @@ static void testGifImgPlayerMemStatic()
 
             printf("%u, %u / 0x%X <-> 0x%X\n", x, y, EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
 
-            TEST_ASSERT_EQUAL_UINT32(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH], static_cast<uint32_t>(color));
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(EXPECTED_DATA[x + y * EXPECTED_DATA_WIDTH])), static_cast<uint32_t>(color));
         }
     }
 }
@@ -279,3 +295,107 @@ static void testGifImgPlayerMemAnimated()
 
     gifImgPlayer.close();
 }
+
+/**
+ * Test GIF image player playing back an animated GIF image from the frame cache.
+ */
+static void testGifImgPlayerFrameCache()
+{
+    GifFileLoader      gifFileLoader;
+    GifImgPlayer       gifImgPlayer;
+    YAGfxDynamicBitmap bitmap;
+    FS                 fileSystem;
+    static uint32_t    decodedScenes[MAX_SCENES][SCENE_SIZE];
+    static uint32_t    cachedScenes[MAX_SCENES][SCENE_SIZE];
+    uint8_t            decodedSceneCnt;
+    uint8_t            cachedSceneCnt;
+    uint8_t            idx;
+
+    TEST_ASSERT_TRUE(bitmap.create(SCENE_WIDTH, SCENE_HEIGHT));
+
+    /* The 1st loop is decoded and the 2nd loop is played back from the frame cache. */
+    gifImgPlayer.setInfiniteAnimation(true);
+    TEST_ASSERT_EQUAL(GifImgPlayer::RET_OK, gifImgPlayer.open(fileSystem, "./test/test_GifImgPlayer/TestAnimation.gif", gifFileLoader));
+    TEST_ASSERT_FALSE(gifImgPlayer.isPlayedFromCache());
+
+    decodedSceneCnt = playLoop(gifImgPlayer, bitmap, decodedScenes);
+    TEST_ASSERT_TRUE(gifImgPlayer.isPlayedFromCache());
+
+    cachedSceneCnt = playLoop(gifImgPlayer, bitmap, cachedScenes);
+    TEST_ASSERT_TRUE(gifImgPlayer.isPlayedFromCache());
+
+    TEST_ASSERT_GREATER_THAN(1U, decodedSceneCnt);
+    TEST_ASSERT_EQUAL_UINT8(decodedSceneCnt, cachedSceneCnt);
+
+    for (idx = 0U; idx < decodedSceneCnt; ++idx)
+    {
+        TEST_ASSERT_EQUAL_MEMORY(decodedScenes[idx], cachedScenes[idx], sizeof(decodedScenes[idx]));
+    }
+
+    /* Closing releases the frame cache. */
+    gifImgPlayer.close();
+    TEST_ASSERT_FALSE(gifImgPlayer.isPlayedFromCache());
+
+    /* With disabled frame cache, every loop is decoded. */
+    gifImgPlayer.setFrameCache(false);
+    TEST_ASSERT_EQUAL(GifImgPlayer::RET_OK, gifImgPlayer.open(fileSystem, "./test/test_GifImgPlayer/TestAnimation.gif", gifFileLoader));
+
+    cachedSceneCnt = playLoop(gifImgPlayer, bitmap, cachedScenes);
+    TEST_ASSERT_FALSE(gifImgPlayer.isPlayedFromCache());
+    TEST_ASSERT_EQUAL_UINT8(decodedSceneCnt, cachedSceneCnt);
+
+    cachedSceneCnt = playLoop(gifImgPlayer, bitmap, cachedScenes);
+    TEST_ASSERT_FALSE(gifImgPlayer.isPlayedFromCache());
+    TEST_ASSERT_EQUAL_UINT8(decodedSceneCnt, cachedSceneCnt);
+
+    for (idx = 0U; idx < decodedSceneCnt; ++idx)
+    {
+        TEST_ASSERT_EQUAL_MEMORY(decodedScenes[idx], cachedScenes[idx], sizeof(decodedScenes[idx]));
+    }
+
+    gifImgPlayer.close();
+}
+
+/**
+ * Play a single animation loop and record every scene, which differs from
+ * the previous one.
+ *
+ * @param[in]   gifImgPlayer    The GIF image player with an opened animation.
+ * @param[in]   bitmap          Bitmap, where to draw the scenes.
+ * @param[out]  scenes          Recorded scenes.
+ *
+ * @return Number of recorded scenes.
+ */
+static uint8_t playLoop(GifImgPlayer& gifImgPlayer, YAGfxDynamicBitmap& bitmap, uint32_t scenes[][SCENE_SIZE])
+{
+    uint8_t sceneCnt = 0U;
+
+    do
+    {
+        uint32_t scene[SCENE_SIZE];
+        int16_t  x;
+        int16_t  y;
+
+        TEST_ASSERT_TRUE(gifImgPlayer.play(bitmap));
+
+        for (y = 0; y < SCENE_HEIGHT; ++y)
+        {
+            for (x = 0; x < SCENE_WIDTH; ++x)
+            {
+                scene[x + y * SCENE_WIDTH] = static_cast<uint32_t>(bitmap.getColor(x, y));
+            }
+        }
+
+        if ((0U == sceneCnt) ||
+            (0 != memcmp(scenes[sceneCnt - 1U], scene, sizeof(scene))))
+        {
+            TEST_ASSERT_LESS_THAN(MAX_SCENES, sceneCnt);
+
+            memcpy(scenes[sceneCnt], scene, sizeof(scene));
+            ++sceneCnt;
+        }
+    }
+    while (false == gifImgPlayer.isTrailerFound());
+
+    return sceneCnt;
+}
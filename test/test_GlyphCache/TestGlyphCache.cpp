@@ -0,0 +1,266 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TestGlyphCache.cpp
+ * @brief  Test the glyph cache.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <GlyphCache.h>
+#include <YAFont.h>
+#include <YAGfxText.h>
+#include <YAGfxBrush.h>
+#include <YAGfxBitmap.h>
+#include <TomThumb.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testGlyphCache();
+static void testGlyphCacheDraw();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Bitmap of a 16x8 checkerboard glyph, which has more runs than a cache
+ * entry can hold.
+ */
+static uint8_t gCheckerBitmap[] = {
+    0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55,
+    0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55
+};
+
+/** Glyph of the checkerboard font. */
+static GFXglyph gCheckerGlyphs[] = {
+    { 0, 16, 8, 17, 0, -8 }
+};
+
+/** Font with only a single checkerboard glyph. */
+static const GFXfont gCheckerFont = {
+    gCheckerBitmap,
+    gCheckerGlyphs,
+    'A',
+    'A',
+    9
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char** argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testGlyphCache);
+    RUN_TEST(testGlyphCacheDraw);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test the glyph cache bookkeeping.
+ */
+static void testGlyphCache()
+{
+    GlyphCache          cache;
+    const GFXglyph&     glyphA   = TomThumbGlyphs['A' - TomThumb.first];
+    const GFXglyph&     glyphB   = TomThumbGlyphs['B' - TomThumb.first];
+    const GFXglyph&     glyphC   = TomThumbGlyphs['C' - TomThumb.first];
+    const BaseGlyphRun* runs     = nullptr;
+    uint16_t            runCount = 0U;
+    uint16_t            idx      = 0U;
+    uint16_t            pixelCnt = 0U;
+    uint16_t            bitCnt   = 0U;
+
+    /* Without entries every request is a miss. */
+    TEST_ASSERT_FALSE(cache.isCreated());
+    TEST_ASSERT_FALSE(cache.getRuns(TomThumb, glyphA, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().misses);
+    TEST_ASSERT_EQUAL_UINT8(0U, cache.getHitRate());
+
+    TEST_ASSERT_FALSE(cache.create(0U));
+    TEST_ASSERT_TRUE(cache.create(2U));
+    TEST_ASSERT_EQUAL_UINT16(2U, cache.getMaxEntries());
+    TEST_ASSERT_EQUAL_UINT16(0U, cache.getUsedEntries());
+    cache.resetStatistics();
+
+    /* First request rasterizes the glyph, the runs cover all set bits. */
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphA, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getStatistics().hits);
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().misses);
+    TEST_ASSERT_EQUAL_UINT16(1U, cache.getUsedEntries());
+
+    for (idx = 0U; idx < runCount; ++idx)
+    {
+        TEST_ASSERT_LESS_OR_EQUAL_UINT16(glyphA.width, runs[idx].x + runs[idx].length);
+        TEST_ASSERT_TRUE(glyphA.height > runs[idx].y);
+        pixelCnt += runs[idx].length;
+    }
+
+    BaseGlyphCache::decodeRuns(TomThumb, glyphA, [&bitCnt](int16_t x, int16_t y, uint16_t length) {
+        UTIL_NOT_USED(x);
+        UTIL_NOT_USED(y);
+        bitCnt += length;
+    });
+    TEST_ASSERT_EQUAL_UINT16(bitCnt, pixelCnt);
+
+    /* Second request is served from the cache. */
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphA, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().hits);
+    TEST_ASSERT_EQUAL_UINT8(50U, cache.getHitRate());
+
+    /* Fill the cache, use A again, then C replaces the least recently used B. */
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphB, runs, runCount));
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphA, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getStatistics().evictions);
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphC, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().evictions);
+    TEST_ASSERT_EQUAL_UINT16(2U, cache.getUsedEntries());
+
+    cache.resetStatistics();
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphA, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().hits);
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphB, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().misses);
+
+    /* A glyph with too many runs is not cached and evicts nothing. */
+    cache.resetStatistics();
+    TEST_ASSERT_FALSE(cache.getRuns(gCheckerFont, gCheckerGlyphs[0], runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().misses);
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getStatistics().evictions);
+    TEST_ASSERT_TRUE(cache.getRuns(TomThumb, glyphB, runs, runCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getStatistics().hits);
+
+    cache.release();
+    TEST_ASSERT_FALSE(cache.isCreated());
+    TEST_ASSERT_EQUAL_UINT16(0U, cache.getUsedEntries());
+}
+
+/**
+ * Test that a font draws the same with and without glyph cache.
+ */
+static void testGlyphCacheDraw()
+{
+    const uint16_t     WIDTH  = 64U;
+    const uint16_t     HEIGHT = 16U;
+    const char*        TEXT   = "Glyph cache AaBbCc 0123 A";
+    GlyphCache         cache;
+    YAGfxDynamicBitmap expected;
+    YAGfxDynamicBitmap actual;
+    YAGfxText          gfxText;
+    YAGfxSolidBrush    brush(ColorDef::WHITE);
+    int16_t            x = 0;
+    int16_t            y = 0;
+
+    TEST_ASSERT_TRUE(cache.create(8U));
+    TEST_ASSERT_TRUE(expected.create(WIDTH, HEIGHT));
+    TEST_ASSERT_TRUE(actual.create(WIDTH, HEIGHT));
+
+    gfxText.setBrush(brush);
+    gfxText.setFont(YAFont(&TomThumb));
+    gfxText.setTextCursorPos(-2, 6);
+    gfxText.drawText(expected, TEXT);
+
+    /* Draw twice, to draw from cache as well. */
+    gfxText.setFont(YAFont(&TomThumb, &cache));
+    gfxText.setTextCursorPos(-2, 6);
+    gfxText.drawText(actual, TEXT);
+    gfxText.setTextCursorPos(-2, 6);
+    gfxText.drawText(actual, TEXT);
+
+    TEST_ASSERT_TRUE(0U < cache.getStatistics().hits);
+
+    for (y = 0; y < HEIGHT; ++y)
+    {
+        for (x = 0; x < WIDTH; ++x)
+        {
+            TEST_ASSERT_TRUE(expected.getColor(x, y) == actual.getColor(x, y));
+        }
+    }
+}
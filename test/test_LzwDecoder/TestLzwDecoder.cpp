@@ -36,6 +36,8 @@
 #include <unity.h>
 #include <LzwDecoder.h>
 #include <Util.h>
+#include <FS.h>
+#include <chrono>
 
 /******************************************************************************
  * Compiler Switches
@@ -54,6 +56,12 @@
  *****************************************************************************/
 
 static void testLzwDecoder();
+static void testLzwDecoderLargeImages();
+static void measureDecodeSpeed(const char* fileName, uint16_t width, uint16_t height, uint8_t (*getExpectedIndex)(uint32_t pixelIdx), uint32_t count);
+static size_t loadFile(const char* fileName, uint8_t* buffer, size_t size);
+static bool findImageData(const uint8_t* gif, size_t size, uint8_t& lzwMinCodeSize, size_t& offset);
+static uint8_t getGradientIndex(uint32_t pixelIdx);
+static uint8_t getNoiseIndex(uint32_t pixelIdx);
 
 /******************************************************************************
  * Local Variables
@@ -84,6 +92,24 @@ static const uint8_t    EXPECTED_DATA[] =
     /* 9 */ 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01
 };
 
+/** Max. size of a test GIF image in byte. */
+static const size_t     MAX_GIF_SIZE = 32U * 1024U;
+
+/** Width of the gradient test GIF image. */
+static const uint16_t   GRADIENT_WIDTH = 320U;
+
+/** Height of the gradient test GIF image. */
+static const uint16_t   GRADIENT_HEIGHT = 240U;
+
+/** Width of the noise test GIF image. */
+static const uint16_t   NOISE_WIDTH = 160U;
+
+/** Height of the noise test GIF image. */
+static const uint16_t   NOISE_HEIGHT = 120U;
+
+/** Indices of the noise test GIF image, generated once. */
+static uint8_t          gNoiseIndices[NOISE_WIDTH * NOISE_HEIGHT];
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -114,6 +140,7 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testLzwDecoder);
+    RUN_TEST(testLzwDecoderLargeImages);
 
     return UNITY_END();
 }
@@ -152,24 +179,30 @@ static void testLzwDecoder()
 
     lzwDecoder.init(lzwMinCodeLength);
 
+    /* Provide the code stream in small data blocks, to cover codes crossing block boundaries. */
     result = lzwDecoder.decode(
-        [&srcIndex](uint8_t& data) -> bool
+        [&srcIndex](const uint8_t*& data, size_t& length) -> bool
         {
             TEST_ASSERT_LESS_THAN_INT32(sizeof(INPUT_DATA), srcIndex);
 
-            data = INPUT_DATA[srcIndex];
-            ++srcIndex;
+            data   = &INPUT_DATA[srcIndex];
+            length = ((sizeof(INPUT_DATA) - srcIndex) < 3U) ? (sizeof(INPUT_DATA) - srcIndex) : 3U;
 
-            printf("In: 0x%02X\n", data);
+            srcIndex += length;
 
             return true;
         },
-        [&dstIndex](uint8_t data) -> bool
+        [&dstIndex](const uint8_t* data, size_t length) -> bool
         {
-            TEST_ASSERT_LESS_THAN_INT32(sizeof(EXPECTED_DATA), dstIndex);
+            size_t idx;
+
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(EXPECTED_DATA), dstIndex + length);
 
-            TEST_ASSERT_EQUAL_UINT8(EXPECTED_DATA[dstIndex], data);
-            ++dstIndex;
+            for (idx = 0U; idx < length; ++idx)
+            {
+                TEST_ASSERT_EQUAL_UINT8(EXPECTED_DATA[dstIndex], data[idx]);
+                ++dstIndex;
+            }
 
             return true;
         }
@@ -177,6 +210,205 @@ static void testLzwDecoder()
 
     TEST_ASSERT_EQUAL(true, result);
     TEST_ASSERT_EQUAL(sizeof(INPUT_DATA), srcIndex);
+    TEST_ASSERT_EQUAL(sizeof(EXPECTED_DATA), dstIndex);
 
     lzwDecoder.deInit();
 }
+
+/**
+ * Test and benchmark the LZW decoder with large GIF images.
+ * The gradient image fills the code table with long strings, the noise
+ * image fills it fast with short strings and causes many clear codes.
+ */
+static void testLzwDecoderLargeImages()
+{
+    uint32_t seed = 1U;
+    uint32_t idx;
+
+    /* Same linear congruential generator, which was used to create the noise image. */
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(gNoiseIndices); ++idx)
+    {
+        seed               = seed * 1103515245U + 12345U;
+        gNoiseIndices[idx] = static_cast<uint8_t>(seed >> 16U);
+    }
+
+    printf("--------------------------------------------------------------------------------\n");
+    measureDecodeSpeed("./test/test_LzwDecoder/TestGradient.gif", GRADIENT_WIDTH, GRADIENT_HEIGHT, getGradientIndex, 100U);
+    measureDecodeSpeed("./test/test_LzwDecoder/TestNoise.gif", NOISE_WIDTH, NOISE_HEIGHT, getNoiseIndex, 100U);
+    printf("--------------------------------------------------------------------------------\n");
+}
+
+/**
+ * Decode the image data of a GIF image several times, verify the indices
+ * and print the runtime.
+ *
+ * @param[in] fileName          Name of the GIF image file.
+ * @param[in] width             Image width in pixel.
+ * @param[in] height            Image height in pixel.
+ * @param[in] getExpectedIndex  Function to get the expected index of a pixel.
+ * @param[in] count             Number of decode runs.
+ */
+static void measureDecodeSpeed(const char* fileName, uint16_t width, uint16_t height, uint8_t (*getExpectedIndex)(uint32_t pixelIdx), uint32_t count)
+{
+    static uint8_t                        gif[MAX_GIF_SIZE];
+    size_t                                gifSize        = loadFile(fileName, gif, sizeof(gif));
+    uint8_t                               lzwMinCodeSize = 0U;
+    size_t                                offset         = 0U;
+    uint32_t                              run;
+    uint32_t                              writeCnt       = 0U;
+    std::chrono::steady_clock::time_point timestampBegin;
+    std::chrono::steady_clock::time_point timestampEnd;
+
+    TEST_ASSERT_TRUE(findImageData(gif, gifSize, lzwMinCodeSize, offset));
+
+    timestampBegin = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < count; ++run)
+    {
+        LzwDecoder lzwDecoder;
+        size_t     srcIndex = offset;
+        uint32_t   dstIndex = 0U;
+
+        TEST_ASSERT_TRUE(lzwDecoder.init(lzwMinCodeSize));
+
+        /* The code stream is read data sub-block by data sub-block. */
+        TEST_ASSERT_TRUE(lzwDecoder.decode(
+            [&srcIndex, gifSize](const uint8_t*& data, size_t& length) -> bool
+            {
+                bool isSuccessful = false;
+
+                if ((srcIndex < gifSize) &&
+                    (0U != gif[srcIndex]) &&
+                    ((srcIndex + 1U + gif[srcIndex]) <= gifSize))
+                {
+                    length        = gif[srcIndex];
+                    data          = &gif[srcIndex + 1U];
+                    srcIndex     += 1U + length;
+                    isSuccessful  = true;
+                }
+
+                return isSuccessful;
+            },
+            [&dstIndex, &writeCnt, width, height, getExpectedIndex](const uint8_t* data, size_t length) -> bool
+            {
+                size_t idx;
+
+                TEST_ASSERT_LESS_OR_EQUAL_UINT32(static_cast<uint32_t>(width) * height, dstIndex + length);
+
+                for (idx = 0U; idx < length; ++idx)
+                {
+                    TEST_ASSERT_EQUAL_UINT8(getExpectedIndex(dstIndex), data[idx]);
+                    ++dstIndex;
+                }
+
+                ++writeCnt;
+
+                return true;
+            }
+        ));
+
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(width) * height, dstIndex);
+
+        lzwDecoder.deInit();
+    }
+
+    timestampEnd = std::chrono::steady_clock::now();
+
+    printf("LzwDecoder::decode() -> Runtime: %lu ms (%u loops with %u x %u, %u writes per loop)\n",
+        std::chrono::duration_cast<std::chrono::milliseconds>(timestampEnd - timestampBegin).count(),
+        count,
+        width,
+        height,
+        writeCnt / count);
+}
+
+/**
+ * Load a file completely into a buffer.
+ *
+ * @param[in]   fileName    Name of the file.
+ * @param[out]  buffer      Buffer for the file content.
+ * @param[in]   size        Buffer size in byte.
+ *
+ * @return Number of read bytes.
+ */
+static size_t loadFile(const char* fileName, uint8_t* buffer, size_t size)
+{
+    FS     fileSystem;
+    File   fd     = fileSystem.open(fileName, "r");
+    size_t length = 0U;
+
+    TEST_ASSERT_TRUE(fd);
+
+    length = fd.read(buffer, size);
+    fd.close();
+
+    TEST_ASSERT_LESS_THAN_INT32(size, length);
+
+    return length;
+}
+
+/**
+ * Find the image data of the first image in a GIF image without extensions.
+ *
+ * @param[in]   gif             GIF image.
+ * @param[in]   size            GIF image size in byte.
+ * @param[out]  lzwMinCodeSize  LZW min. code size.
+ * @param[out]  offset          Offset of the first image data sub-block.
+ *
+ * @return If found, it will return true otherwise false.
+ */
+static bool findImageData(const uint8_t* gif, size_t size, uint8_t& lzwMinCodeSize, size_t& offset)
+{
+    const size_t HEADER_SIZE                = 6U;
+    const size_t LOGICAL_SCREEN_DESC_SIZE   = 7U;
+    const size_t IMAGE_DESC_SIZE            = 10U;
+    const size_t PACKED_FIELD_IDX           = 10U;
+    bool         isFound                    = false;
+    size_t       idx                        = HEADER_SIZE + LOGICAL_SCREEN_DESC_SIZE;
+
+    /* Skip global color table. */
+    if ((idx < size) &&
+        (0U != (gif[PACKED_FIELD_IDX] & 0x80U)))
+    {
+        idx += 3U * (1U << ((gif[PACKED_FIELD_IDX] & 0x07U) + 1U));
+    }
+
+    /* Image descriptor without local color table expected. */
+    if (((idx + IMAGE_DESC_SIZE + 1U) < size) &&
+        (',' == gif[idx]) &&
+        (0U == (gif[idx + IMAGE_DESC_SIZE - 1U] & 0x80U)))
+    {
+        lzwMinCodeSize = gif[idx + IMAGE_DESC_SIZE];
+        offset         = idx + IMAGE_DESC_SIZE + 1U;
+        isFound        = true;
+    }
+
+    return isFound;
+}
+
+/**
+ * Get expected index of the gradient test GIF image.
+ *
+ * @param[in] pixelIdx  Pixel index.
+ *
+ * @return Color index
+ */
+static uint8_t getGradientIndex(uint32_t pixelIdx)
+{
+    uint32_t x = pixelIdx % GRADIENT_WIDTH;
+    uint32_t y = pixelIdx / GRADIENT_WIDTH;
+
+    return static_cast<uint8_t>(x + y);
+}
+
+/**
+ * Get expected index of the noise test GIF image.
+ *
+ * @param[in] pixelIdx  Pixel index.
+ *
+ * @return Color index
+ */
+static uint8_t getNoiseIndex(uint32_t pixelIdx)
+{
+    return gNoiseIndices[pixelIdx];
+}
@@ -0,0 +1,505 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TestPxiImgPlayer.cpp
+ * @brief  Test Pixelix image player and writer.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <FS.h>
+#include <PxiImgPlayer.h>
+#include <PxiImgWriter.h>
+#include <PxiFormat.h>
+#include <BitmapWidget.h>
+#include <YAGfxBitmap.h>
+#include <Util.h>
+#include <FileUtil.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testPxiImgPlayer();
+static void testPxiImgPlayerInvalid();
+static void testPxiImgPlayerPlay();
+static void testPxiImgPlayerMapped();
+static void testPxiImgWriter();
+static void testPxiSidecar();
+static Color getAnimationColor(uint16_t frameIdx, int16_t x, int16_t y);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Test animation, created with scripts/imgconvert_pxi.py. */
+static const char ANIMATION_FILE_NAME[]  = "./test/test_PxiImgPlayer/testAnimation.pxi";
+
+/** Temporary file, written by the tests. */
+static const char TMP_FILE_NAME[]        = "./test/test_PxiImgPlayer/tmp.pxi";
+
+/** Bitmap image with 2x2 pixels: blue, green / red, white. */
+static const char BITMAP_FILE_NAME[]     = "./test/test_BmpImgLoader/test24bpp.bmp";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testPxiImgPlayer);
+    RUN_TEST(testPxiImgPlayerInvalid);
+    RUN_TEST(testPxiImgPlayerPlay);
+    RUN_TEST(testPxiImgPlayerMapped);
+    RUN_TEST(testPxiImgWriter);
+    RUN_TEST(testPxiSidecar);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test loading a RLE compressed animation.
+ */
+static void testPxiImgPlayer()
+{
+    PxiImgPlayer player;
+    FS           localFileSystem;
+    uint16_t     frameIdx;
+    int16_t      x;
+    int16_t      y;
+
+    /* Load test animation:
+     * 8x4 pixels, 3 frames, RGB888, RLE compressed
+     * Row 0-1: red, green, blue in frame 0, 1, 2
+     * Row 2-3: gradient, last column transparent (black)
+     */
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.open(localFileSystem, ANIMATION_FILE_NAME));
+    TEST_ASSERT_EQUAL_UINT16(8U, player.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4U, player.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(3U, player.getFrameCount());
+    TEST_ASSERT_NULL(player.getFrame(3U));
+    TEST_ASSERT_EQUAL_UINT32(0U, player.getDelay(3U));
+
+    for (frameIdx = 0U; frameIdx < player.getFrameCount(); ++frameIdx)
+    {
+        const YAGfxBitmap* frame = player.getFrame(frameIdx);
+
+        TEST_ASSERT_NOT_NULL(frame);
+        TEST_ASSERT_EQUAL_UINT32(50U * (frameIdx + 1U), player.getDelay(frameIdx));
+
+        for (y = 0; y < player.getHeight(); ++y)
+        {
+            for (x = 0; x < player.getWidth(); ++x)
+            {
+                TEST_ASSERT_TRUE(getAnimationColor(frameIdx, x, y) == frame->getColor(x, y));
+            }
+        }
+    }
+
+    /* A copy has its own frames. */
+    {
+        PxiImgPlayer copy(player);
+
+        player.close();
+        TEST_ASSERT_EQUAL_UINT16(0U, player.getFrameCount());
+        TEST_ASSERT_NULL(player.getFrame(0U));
+
+        TEST_ASSERT_EQUAL_UINT16(3U, copy.getFrameCount());
+        TEST_ASSERT_NOT_NULL(copy.getFrame(2U));
+        TEST_ASSERT_TRUE(getAnimationColor(2U, 3, 3) == copy.getFrame(2U)->getColor(3, 3));
+
+        player = copy;
+        TEST_ASSERT_EQUAL_UINT16(3U, player.getFrameCount());
+        TEST_ASSERT_TRUE(getAnimationColor(1U, 0, 0) == player.getFrame(1U)->getColor(0, 0));
+    }
+}
+
+/**
+ * Test loading invalid Pixelix images.
+ */
+static void testPxiImgPlayerInvalid()
+{
+    PxiImgPlayer player;
+    FS           localFileSystem;
+    uint8_t      data[256U];
+    size_t       size = 0U;
+    File         fd   = localFileSystem.open(ANIMATION_FILE_NAME);
+
+    TEST_ASSERT_TRUE(fd);
+    size = fd.read(data, sizeof(data));
+    fd.close();
+    TEST_ASSERT_GREATER_THAN(sizeof(PxiFormat::FileHeader), size);
+    TEST_ASSERT_LESS_THAN(sizeof(data), size);
+
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_FILE_NOT_FOUND, player.open(localFileSystem, "./test/test_PxiImgPlayer/notExisting.pxi"));
+
+    /* Truncated file */
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_FILE_FORMAT_INVALID, player.open(data, sizeof(PxiFormat::FileHeader) - 1U));
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_FILE_FORMAT_INVALID, player.open(data, size - 1U));
+    TEST_ASSERT_EQUAL_UINT16(0U, player.getFrameCount());
+
+    /* Trailing data */
+    data[size] = 0U;
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.open(data, size + 1U));
+
+    /* Unsupported version */
+    data[3U] = PxiFormat::VERSION + 1U;
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_FILE_FORMAT_UNSUPPORTED, player.open(data, size));
+    TEST_ASSERT_EQUAL_UINT16(0U, player.getFrameCount());
+    data[3U] = PxiFormat::VERSION;
+
+    /* Invalid signature */
+    data[0U] = 'Q';
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_FILE_FORMAT_INVALID, player.open(data, size));
+    data[0U] = 'P';
+
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.open(data, size));
+}
+
+/**
+ * Test playing the animation.
+ */
+static void testPxiImgPlayerPlay()
+{
+    PxiImgPlayer       player;
+    FS                 localFileSystem;
+    YAGfxDynamicBitmap canvas;
+    uint16_t           frameIdx = 0U;
+    uint32_t           loops    = 0U;
+
+    TEST_ASSERT_TRUE(canvas.create(8U, 4U));
+    TEST_ASSERT_FALSE(player.play(canvas));
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.open(localFileSystem, ANIMATION_FILE_NAME));
+
+    /* Every frame is shown in order, until the animation starts again. */
+    while ((4U > frameIdx) && (100000000U > loops))
+    {
+        uint16_t expectedFrameIdx = frameIdx % player.getFrameCount();
+
+        TEST_ASSERT_TRUE(player.play(canvas));
+
+        if (false == (getAnimationColor(expectedFrameIdx, 0, 0) == canvas.getColor(0, 0)))
+        {
+            ++frameIdx;
+            expectedFrameIdx = frameIdx % player.getFrameCount();
+
+            TEST_ASSERT_TRUE(getAnimationColor(expectedFrameIdx, 0, 0) == canvas.getColor(0, 0));
+            TEST_ASSERT_TRUE(getAnimationColor(expectedFrameIdx, 4, 3) == canvas.getColor(4, 3));
+        }
+
+        ++loops;
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(4U, frameIdx);
+}
+
+/**
+ * Test drawing the animation directly from memory.
+ */
+static void testPxiImgPlayerMapped()
+{
+    PxiImgPlayer       player;
+    FS                 localFileSystem;
+    YAGfxDynamicBitmap canvas;
+    uint8_t            data[256U];
+    size_t             size = 0U;
+    File               fd   = localFileSystem.open(ANIMATION_FILE_NAME);
+    int16_t            x;
+    int16_t            y;
+
+    TEST_ASSERT_TRUE(fd);
+    size = fd.read(data, sizeof(data));
+    fd.close();
+
+    /* The frames are validated, but not decoded. */
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_FILE_FORMAT_INVALID, player.openMapped(data, size - 1U));
+    TEST_ASSERT_FALSE(player.isMapped());
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.openMapped(data, size));
+    TEST_ASSERT_TRUE(player.isMapped());
+    TEST_ASSERT_EQUAL_UINT16(8U, player.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4U, player.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(3U, player.getFrameCount());
+    TEST_ASSERT_EQUAL_UINT32(150U, player.getDelay(2U));
+    TEST_ASSERT_NULL(player.getFrame(0U));
+
+    /* Draw the first frame with an offset, the rest is clipped. */
+    TEST_ASSERT_TRUE(canvas.create(8U, 4U));
+    canvas.fillScreen(ColorDef::WHITE);
+    TEST_ASSERT_TRUE(player.play(canvas, 2, 1));
+
+    for (y = 0; y < canvas.getHeight(); ++y)
+    {
+        for (x = 0; x < canvas.getWidth(); ++x)
+        {
+            Color expected = ColorDef::WHITE;
+
+            if ((2 <= x) && (1 <= y))
+            {
+                expected = getAnimationColor(0U, x - 2, y - 1);
+            }
+
+            TEST_ASSERT_TRUE(expected == canvas.getColor(x, y));
+        }
+    }
+
+    /* A copy references the same data. */
+    {
+        PxiImgPlayer copy(player);
+
+        player.close();
+        TEST_ASSERT_FALSE(player.isMapped());
+
+        TEST_ASSERT_TRUE(copy.isMapped());
+        TEST_ASSERT_TRUE(copy.play(canvas));
+        TEST_ASSERT_TRUE(getAnimationColor(0U, 7, 3) == canvas.getColor(7, 3));
+        TEST_ASSERT_TRUE(getAnimationColor(0U, 4, 2) == canvas.getColor(4, 2));
+    }
+}
+
+/**
+ * Test writing a bitmap and loading it again.
+ */
+static void testPxiImgWriter()
+{
+    PxiImgWriter       writer;
+    PxiImgPlayer       player;
+    FS                 localFileSystem;
+    YAGfxDynamicBitmap bitmap;
+    YAGfxDynamicBitmap empty;
+    size_t             rawSize;
+    size_t             rleSize;
+    int16_t            x;
+    int16_t            y;
+    bool               isCompressed;
+
+    /* Left half gradient, right half uniform. */
+    TEST_ASSERT_TRUE(bitmap.create(40U, 10U));
+
+    for (y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for (x = 0; x < bitmap.getWidth(); ++x)
+        {
+            if (20 > x)
+            {
+                bitmap.drawPixel(x, y, Color(x * 12U, y * 24U, 0x80U));
+            }
+            else
+            {
+                bitmap.drawPixel(x, y, ColorDef::GREEN);
+            }
+        }
+    }
+
+    rawSize      = sizeof(PxiFormat::FileHeader) + sizeof(PxiFormat::FrameHeader) + (40U * 10U * PxiFormat::getBytesPerPixel(PxiFormat::PIXEL_FORMAT_NATIVE));
+    isCompressed = false;
+
+    do
+    {
+        File fd;
+
+        TEST_ASSERT_TRUE(writer.write(localFileSystem, TMP_FILE_NAME, bitmap, isCompressed));
+
+        fd = localFileSystem.open(TMP_FILE_NAME);
+        TEST_ASSERT_TRUE(fd);
+        rleSize = fd.size();
+        fd.close();
+
+        if (false == isCompressed)
+        {
+            TEST_ASSERT_EQUAL_UINT32(rawSize, rleSize);
+        }
+        else
+        {
+            TEST_ASSERT_LESS_THAN(rawSize, rleSize);
+        }
+
+        TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.open(localFileSystem, TMP_FILE_NAME));
+        TEST_ASSERT_EQUAL_UINT16(bitmap.getWidth(), player.getWidth());
+        TEST_ASSERT_EQUAL_UINT16(bitmap.getHeight(), player.getHeight());
+        TEST_ASSERT_EQUAL_UINT16(1U, player.getFrameCount());
+
+        /* The pixels are stored in the color format of the target without loss. */
+        for (y = 0; y < bitmap.getHeight(); ++y)
+        {
+            for (x = 0; x < bitmap.getWidth(); ++x)
+            {
+                TEST_ASSERT_TRUE(bitmap.getColor(x, y) == player.getFrame(0U)->getColor(x, y));
+            }
+        }
+
+        isCompressed = !isCompressed;
+    }
+    while (true == isCompressed);
+
+    /* Noise is not compressible, therefore its stored uncompressed. */
+    for (y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for (x = 0; x < bitmap.getWidth(); ++x)
+        {
+            bitmap.drawPixel(x, y, Color(x * 6U, y * 24U, (x + y) & 0x01U));
+        }
+    }
+
+    TEST_ASSERT_TRUE(writer.write(localFileSystem, TMP_FILE_NAME, bitmap));
+    TEST_ASSERT_EQUAL(PxiImgPlayer::RET_OK, player.open(localFileSystem, TMP_FILE_NAME));
+    TEST_ASSERT_TRUE(bitmap.getColor(39, 9) == player.getFrame(0U)->getColor(39, 9));
+
+    /* Empty bitmap */
+    TEST_ASSERT_FALSE(writer.write(localFileSystem, TMP_FILE_NAME, empty));
+
+    TEST_ASSERT_TRUE(localFileSystem.remove(TMP_FILE_NAME));
+}
+
+/**
+ * Test the bitmap widget, which prefers the sidecar image of a bitmap image.
+ */
+static void testPxiSidecar()
+{
+    PxiImgWriter       writer;
+    FS                 localFileSystem;
+    BitmapWidget       bitmapWidget(2U, 2U);
+    YAGfxDynamicBitmap bitmap;
+    YAGfxDynamicBitmap canvas;
+    String             sidecarFilename = BitmapWidget::getSidecarFilename(BITMAP_FILE_NAME);
+    uint32_t           crc             = 0U;
+
+    TEST_ASSERT_EQUAL_STRING("./test/test_BmpImgLoader/test24bpp.bmp.pxi", sidecarFilename.c_str());
+    TEST_ASSERT_TRUE(BitmapWidget::isSidecarFile(sidecarFilename));
+    TEST_ASSERT_TRUE(BitmapWidget::isSidecarFile("/images/SUN.BMP.PXI"));
+    TEST_ASSERT_FALSE(BitmapWidget::isSidecarFile(BITMAP_FILE_NAME));
+    TEST_ASSERT_FALSE(BitmapWidget::isSidecarFile(ANIMATION_FILE_NAME));
+
+    TEST_ASSERT_TRUE(canvas.create(2U, 2U));
+    TEST_ASSERT_TRUE(bitmap.create(2U, 2U));
+    bitmap.fillScreen(ColorDef::YELLOW);
+
+    /* Without sidecar image, the bitmap image is loaded. */
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, BITMAP_FILE_NAME));
+    bitmapWidget.update(canvas);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLUE) == canvas.getColor(0, 0));
+
+    /* The sidecar image is preferred. */
+    TEST_ASSERT_TRUE(FileUtil::getCrc32(localFileSystem, BITMAP_FILE_NAME, crc));
+    TEST_ASSERT_TRUE(writer.write(localFileSystem, sidecarFilename, bitmap, true, crc));
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, BITMAP_FILE_NAME));
+    bitmapWidget.update(canvas);
+    TEST_ASSERT_TRUE(Color(ColorDef::YELLOW) == canvas.getColor(0, 0));
+
+    /* An outdated sidecar image is removed and the bitmap image is loaded. */
+    TEST_ASSERT_TRUE(writer.write(localFileSystem, sidecarFilename, bitmap, true, crc + 1U));
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, BITMAP_FILE_NAME));
+    bitmapWidget.update(canvas);
+    TEST_ASSERT_TRUE(Color(ColorDef::BLUE) == canvas.getColor(0, 0));
+    TEST_ASSERT_FALSE(localFileSystem.exists(sidecarFilename));
+}
+
+/**
+ * Get the expected color of the test animation.
+ *
+ * @param[in] frameIdx  Frame index
+ * @param[in] x         x-coordinate
+ * @param[in] y         y-coordinate
+ *
+ * @return Color
+ */
+static Color getAnimationColor(uint16_t frameIdx, int16_t x, int16_t y)
+{
+    Color color;
+
+    if (2 > y)
+    {
+        color.set((0U == frameIdx) ? 255U : 0U, (1U == frameIdx) ? 255U : 0U, (2U == frameIdx) ? 255U : 0U);
+    }
+    else if (7 == x)
+    {
+        color.set(0U, 0U, 0U);
+    }
+    else
+    {
+        color.set(x * 32U, y * 64U, frameIdx * 100U);
+    }
+
+    return color;
+}
@@ -36,8 +36,12 @@
 #include <unity.h>
 #include <TWTokenizer.h>
 #include <TextWidget.h>
+#include <TextStrip.h>
 #include <YAGfxBrush.h>
+#include <YAGfxBitmap.h>
+#include <YAGfxText.h>
 #include <Util.h>
+#include <Arduino.h>
 
 #include "../common/YAGfxTest.hpp"
 
@@ -59,6 +63,8 @@
 
 static void testTokenizer();
 static void testTextWidget();
+static void testTextWidgetScrolling();
+static void testTextStrip();
 
 /******************************************************************************
  * Local Variables
@@ -95,6 +101,8 @@ extern int main(int argc, char** argv)
 
     RUN_TEST(testTokenizer);
     RUN_TEST(testTextWidget);
+    RUN_TEST(testTextWidgetScrolling);
+    RUN_TEST(testTextStrip);
 
     return UNITY_END();
 }
@@ -257,7 +265,7 @@ static void testTextWidget()
     TEST_ASSERT_EQUAL_STRING(testStr.c_str(), textWidget.getStr().c_str());
 
     /* Default string color */
-    TEST_ASSERT_EQUAL_UINT32(TextWidget::DEFAULT_TEXT_COLOR, dynamic_cast<YAGfxSolidBrush&>(textWidget.getBrush()).getColor());
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Color(TextWidget::DEFAULT_TEXT_COLOR)), dynamic_cast<YAGfxSolidBrush&>(textWidget.getBrush()).getColor());
 
     /* Set/Get text color */
     dynamic_cast<YAGfxSolidBrush&>(textWidget.getBrush()).setColor(TEXT_COLOR);
@@ -308,4 +316,131 @@ static void testTextWidget()
     /* Set text with character coe format keyword and get text without format keyword back. */
     textWidget.setFormatStr("{0x41} Hello World!");
     TEST_ASSERT_EQUAL_STRING("A Hello World!", textWidget.getStr().c_str());
+
+    /* Character code format keyword beyond ASCII results in UTF-8 encoded character. */
+    textWidget.setFormatStr("20{0xB0}C {0x20AC}");
+    TEST_ASSERT_EQUAL_STRING("20\xC2\xB0""C \xE2\x82\xAC", textWidget.getStr().c_str());
+
+    /* UTF-8 text is kept, except control characters and invalid sequences. */
+    textWidget.setFormatStr("\xCE\xA9\x01\xC2\x85\xF0\x9F\x8C\xA7\xE2\x82");
+    TEST_ASSERT_EQUAL_STRING("\xCE\xA9\xF0\x9F\x8C\xA7", textWidget.getStr().c_str());
+}
+
+/**
+ * Test that a scrolling text is shown the same, independent of whether it
+ * is blended from the pre-rendered text strip or rendered every frame.
+ */
+static void testTextWidgetScrolling()
+{
+    const char*              TEXT          = "Scrolling news ticker";
+    const Color              TEXT_COLOR    = ColorDef::YELLOW;
+    const uint8_t            FRAME_COUNT   = 8U;
+    const uint32_t           SCROLL_PAUSE  = 20U; /* ms */
+    const uint32_t           DEFAULT_PAUSE = ScrollController::getScrollPause();
+    YAGfxTest                testGfx;
+    TextWidget               textWidget(YAGfxTest::WIDTH, YAGfxTest::HEIGHT);
+    YAGfxSolidBrush          brush(TEXT_COLOR);
+    YAGfxLinearGradientBrush gradientBrush(TEXT_COLOR, TEXT_COLOR, 0, YAGfxTest::WIDTH, false);
+    YAGfxText                gfxText(TextWidget::DEFAULT_FONT, brush);
+    YAGfxDynamicBitmap       expected;
+    uint16_t                 textWidth  = 0U;
+    uint16_t                 textHeight = 0U;
+    uint8_t                  frame;
+
+    TEST_ASSERT_TRUE(expected.create(YAGfxTest::WIDTH, YAGfxTest::HEIGHT));
+    TEST_ASSERT_TRUE(gfxText.getTextBoundingBox(YAGfxTest::WIDTH, TEXT, textWidth, textHeight));
+    TEST_ASSERT_TRUE(YAGfxTest::WIDTH < textWidth);
+    TEST_ASSERT_TRUE(TextWidget::setScrollPause(SCROLL_PAUSE));
+
+    textWidget.disableFadeEffect();
+    textWidget.setSolidBrush(TEXT_COLOR);
+    textWidget.setFormatStr(TEXT);
+
+    for (frame = 0U; frame < (2U * FRAME_COUNT); ++frame)
+    {
+        uint32_t timestamp = millis();
+        int16_t  offset    = 0;
+        bool     isEqual   = false;
+
+        /* Second half of the frames is rendered every frame, because a
+         * horizontal gradient can't be pre-rendered.
+         */
+        if (FRAME_COUNT == frame)
+        {
+            textWidget.setBrush(gradientBrush);
+        }
+
+        /* Wait until the text moved. */
+        while (SCROLL_PAUSE >= (millis() - timestamp))
+        {
+            ;
+        }
+
+        testGfx.fill(ColorDef::BLACK);
+        testGfx.setCallCounterDrawPixel(0U);
+        textWidget.update(testGfx);
+
+        if (FRAME_COUNT > frame)
+        {
+            TEST_ASSERT_EQUAL_UINT32(0U, testGfx.getCallCounterDrawPixel());
+        }
+
+        /* The scroll offset is not known, search for the matching one. */
+        for (offset = -static_cast<int16_t>(textWidth); (offset <= YAGfxTest::WIDTH) && (false == isEqual); ++offset)
+        {
+            int16_t x;
+            int16_t y;
+
+            expected.fillScreen(ColorDef::BLACK);
+            gfxText.setTextCursorPos(offset, TextWidget::DEFAULT_FONT.getHeight() - 1);
+            gfxText.drawText(expected, TEXT);
+
+            isEqual = true;
+
+            for (y = 0; (y < YAGfxTest::HEIGHT) && (true == isEqual); ++y)
+            {
+                for (x = 0; (x < YAGfxTest::WIDTH) && (true == isEqual); ++x)
+                {
+                    isEqual = (expected.getColor(x, y) == testGfx.getColor(x, y));
+                }
+            }
+        }
+
+        TEST_ASSERT_TRUE(isEqual);
+    }
+
+    TEST_ASSERT_TRUE(TextWidget::setScrollPause(DEFAULT_PAUSE));
+}
+
+/**
+ * Test the alpha channel handling of the text strip.
+ */
+static void testTextStrip()
+{
+    TextStrip strip;
+
+    TEST_ASSERT_TRUE(strip.create(4U, 1U));
+
+    /* All pixels are transparent after creation. */
+    TEST_ASSERT_EQUAL_UINT8(0U, strip.getAlpha(0, 0));
+    TEST_ASSERT_EQUAL_UINT8(0U, strip.getAlpha(3, 0));
+
+    /* Drawn pixels are opaque. */
+    strip.drawPixel(0, 0, ColorDef::RED);
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, strip.getAlpha(0, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::RED) == strip.getColor(0, 0));
+
+    /* Blended pixels keep the coverage and the color. */
+    strip.blendPixel(1, 0, ColorDef::GREEN, 128U);
+    TEST_ASSERT_EQUAL_UINT8(128U, strip.getAlpha(1, 0));
+    TEST_ASSERT_TRUE(Color(ColorDef::GREEN) == strip.getColor(1, 0));
+
+    /* Blending again increases the coverage. */
+    strip.blendPixel(1, 0, ColorDef::GREEN, 128U);
+    TEST_ASSERT_EQUAL_UINT8(191U, strip.getAlpha(1, 0));
+
+    /* Pixels outside are skipped. */
+    strip.blendPixel(4, 0, ColorDef::GREEN, 128U);
+    strip.blendPixel(-1, 0, ColorDef::GREEN, 128U);
+    TEST_ASSERT_EQUAL_UINT8(0U, strip.getAlpha(3, 0));
 }
@@ -275,6 +275,19 @@ static void testColorHtml(void)
     Color   color;
     String  htmlColor;
 
+    /* The 5-6-5 RGB format widens 128 to 0x84 for red/blue and 0x82 for green. */
+#if (CONFIG_COLOR_DEPTH == 16)
+    const char* EXPECTED_GRAY       = "#848284";
+    const char* EXPECTED_DARK_RED   = "#840000";
+    const char* EXPECTED_DARK_GREEN = "#008200";
+    const char* EXPECTED_DARK_BLUE  = "#000084";
+#else
+    const char* EXPECTED_GRAY       = "#808080";
+    const char* EXPECTED_DARK_RED   = "#800000";
+    const char* EXPECTED_DARK_GREEN = "#008000";
+    const char* EXPECTED_DARK_BLUE  = "#000080";
+#endif
+
     /* Test black color */
     color.set(0, 0, 0);
     htmlColor = Util::colorToHtml(color);
@@ -318,22 +331,22 @@ static void testColorHtml(void)
     /* Test gray color */
     color.set(128, 128, 128);
     htmlColor = Util::colorToHtml(color);
-    TEST_ASSERT_EQUAL_STRING("#808080", htmlColor.c_str());
+    TEST_ASSERT_EQUAL_STRING(EXPECTED_GRAY, htmlColor.c_str());
 
     /* Test dark red color */
     color.set(128, 0, 0);
     htmlColor = Util::colorToHtml(color);
-    TEST_ASSERT_EQUAL_STRING("#800000", htmlColor.c_str());
+    TEST_ASSERT_EQUAL_STRING(EXPECTED_DARK_RED, htmlColor.c_str());
 
     /* Test dark green color */
     color.set(0, 128, 0);
     htmlColor = Util::colorToHtml(color);
-    TEST_ASSERT_EQUAL_STRING("#008000", htmlColor.c_str());
+    TEST_ASSERT_EQUAL_STRING(EXPECTED_DARK_GREEN, htmlColor.c_str());
 
     /* Test dark blue color */
     color.set(0, 0, 128);
     htmlColor = Util::colorToHtml(color);
-    TEST_ASSERT_EQUAL_STRING("#000080", htmlColor.c_str());
+    TEST_ASSERT_EQUAL_STRING(EXPECTED_DARK_BLUE, htmlColor.c_str());
 }
 
 /**